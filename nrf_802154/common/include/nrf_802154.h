@@ -42,6 +42,7 @@
 #define NRF_802154_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "nrf_802154_callouts.h"
@@ -1066,6 +1067,50 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
  */
 void nrf_802154_ack_data_remove_all(bool extended, nrf_802154_ack_data_t data_type);
 
+#if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
+/**
+ * @brief Gets the size of the memory needed by the list of peers with ACK data or pending bits.
+ *
+ * @param[in]  extended       If the list is for extended MAC addresses or short MAC addresses.
+ * @param[in]  num_addresses  Maximum number of addresses in the list.
+ *
+ * @returns  Size of the memory in bytes, to be passed to @ref nrf_802154_ack_data_memory_set.
+ */
+size_t nrf_802154_ack_data_memory_size_get(bool extended, uint16_t num_addresses);
+
+/**
+ * @brief Sets the memory of the list of peers with ACK data or pending bits.
+ *
+ * By default, the lists are stored in static memory sized with
+ * @ref NRF_802154_PENDING_SHORT_ADDRESSES and @ref NRF_802154_PENDING_EXTENDED_ADDRESSES.
+ * This function moves a list to the memory provided by the caller, so that the number of peers
+ * can be chosen at runtime. All addresses of the given length are removed from the list.
+ * The memory is used until this function is called again, also after @ref nrf_802154_reinit.
+ *
+ * @note This function is to be called after the driver initialization, but before the transceiver
+ *       is enabled, or in the sleep state.
+ *
+ * @note This function is available only on the core that runs the driver, as the memory must be
+ *       accessible to the driver. It is not serialized.
+ *
+ * @param[in]  extended       If the list is for extended MAC addresses or short MAC addresses.
+ * @param[in]  p_memory       Pointer to the memory aligned to 4 bytes, or NULL to restore
+ *                            the default static memory.
+ * @param[in]  memory_size    Size of @p p_memory in bytes. Ignored if @p p_memory is NULL.
+ * @param[in]  num_addresses  Maximum number of addresses in the list. Must be less than
+ *                            @c UINT16_MAX / 2 . Ignored if @p p_memory is NULL.
+ *
+ * @retval true   The memory is set.
+ * @retval false  The memory is not aligned or is smaller than
+ *                @ref nrf_802154_ack_data_memory_size_get returns for @p num_addresses.
+ */
+bool nrf_802154_ack_data_memory_set(bool     extended,
+                                    void   * p_memory,
+                                    size_t   memory_size,
+                                    uint16_t num_addresses);
+
+#endif // !NRF_802154_SERIALIZATION_HOST
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -1400,6 +1445,28 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
  */
 void nrf_802154_stat_counters_reset(void);
 
+/**
+ * @brief Gets the number of receive buffers holding frames not yet freed by the higher layer.
+ *
+ * @returns  Current occupancy of the receive buffers.
+ */
+uint32_t nrf_802154_stat_rx_buffer_occupancy_get(void);
+
+/**
+ * @brief Gets the highest occupancy of the receive buffers observed since the last reset.
+ *
+ * When the high-water mark reaches @ref NRF_802154_RX_BUFFERS, the receiver may have been left
+ * without a free buffer. Such events are counted by the @c rx_buffer_starvations stat counter.
+ *
+ * @returns  High-water mark of the receive buffers occupancy.
+ */
+uint32_t nrf_802154_stat_rx_buffer_high_water_get(void);
+
+/**
+ * @brief Resets the high-water mark of the receive buffers occupancy to the current occupancy.
+ */
+void nrf_802154_stat_rx_buffer_high_water_reset(void);
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -208,6 +208,34 @@ extern void nrf_802154_transmit_failed(uint8_t
                                        nrf_802154_tx_error_t                       error,
                                        const nrf_802154_transmit_done_metadata_t * p_metadata);
 
+#if (!NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED) || defined(DOXYGEN)
+/**
+ * @brief Notifies about a batch of received frames and transmission results.
+ *
+ * This function is called instead of @ref nrf_802154_received_raw,
+ * @ref nrf_802154_transmitted_raw and @ref nrf_802154_transmit_failed when
+ * @ref NRF_802154_NOTIFICATION_BATCH_ENABLED is set. It allows the higher layer to process
+ * several notifications at once, for example to send them to another core in a single
+ * transport frame.
+ *
+ * The notifications are ordered as they occurred. The higher layer takes over the ownership of
+ * the buffers in the same way as in the callouts it replaces, so every received frame and every
+ * received ACK must be released with @ref nrf_802154_buffer_free_raw .
+ *
+ * @note Default implementation of this function provided by the nRF 802.15.4 Radio Driver
+ *       calls the callout corresponding to each notification. A received frame is passed to
+ *       @ref nrf_802154_received_timestamp_raw with the timestamp stored in the batch, as the last
+ *       RX timestamp may already belong to a later frame.
+ *
+ * @param[in]  p_ntfs  Pointer to an array of notifications. The array is valid only during
+ *                     the call.
+ * @param[in]  count   Number of notifications in the array, at least 1 and at most
+ *                     @ref NRF_802154_NOTIFICATION_BATCH_SIZE.
+ */
+extern void nrf_802154_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count);
+
+#endif // !NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 /**
  * @brief Perform some additional operations during initialization of the RADIO peripheral.
@@ -198,6 +198,9 @@ extern "C" {
  * @def NRF_802154_PENDING_SHORT_ADDRESSES
  *
  * The number of slots containing short addresses of nodes for which the pending data is stored.
+ * The time needed to look up an address does not depend on this value.
+ * The slots are allocated statically. To choose the number of slots at runtime, use
+ * @ref nrf_802154_ack_data_memory_set.
  *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
@@ -208,6 +211,9 @@ extern "C" {
  * @def NRF_802154_PENDING_EXTENDED_ADDRESSES
  *
  * The number of slots containing extended addresses of nodes for which the pending data is stored.
+ * The time needed to look up an address does not depend on this value.
+ * The slots are allocated statically. To choose the number of slots at runtime, use
+ * @ref nrf_802154_ack_data_memory_set.
  *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
@@ -287,6 +293,21 @@ extern "C" {
 #endif
 #endif /* NRF_802154_DELAYED_TRX_ENABLED */
 
+/**
+ * @def NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE
+ *
+ * Number of receive windows that can be requested on top of the delayed reception timeslots
+ * provided by the radio scheduler, see @ref NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS.
+ *
+ * The receive windows that do not fit in the timeslots of the radio scheduler are kept ordered by
+ * their start time and are passed to the radio scheduler as soon as its timeslots are released.
+ * A receive window requested earlier than the windows already passed to the radio scheduler takes
+ * the timeslot of the latest of them. Setting this option to 0 disables the backlog.
+ */
+#ifndef NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE
+#define NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE 0
+#endif
+
 /**
  * @def NRF_802154_TEST_MODES_ENABLED
  *
@@ -540,6 +561,35 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_trace Trace configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TRACE_ENABLED
+ *
+ * Configures if the stage transitions of the RX/TX state machine are recorded with timestamps
+ * in the trace ring. The ring can be dumped from the memory and decoded into per-stage latency
+ * histograms.
+ */
+#ifndef NRF_802154_TRACE_ENABLED
+#define NRF_802154_TRACE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRACE_BUFFER_LEN
+ *
+ * Configures the number of entries in the trace ring. When the ring is full, the oldest entries
+ * are overwritten. Each entry occupies 8 bytes.
+ *
+ * @note This value must be a power of 2.
+ */
+#ifndef NRF_802154_TRACE_BUFFER_LEN
+#define NRF_802154_TRACE_BUFFER_LEN 256U
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_security Security configuration
@@ -640,6 +690,37 @@ extern "C" {
 #define NRF_802154_NOTIFICATION_IMPL NRF_802154_NOTIFICATION_IMPL_SWI
 #endif
 
+/**
+ * @def NRF_802154_NOTIFICATION_BATCH_ENABLED
+ *
+ * Enables the delivery of notifications in batches.
+ *
+ * When this option is enabled, the consecutive notifications about received frames, transmitted
+ * frames and failed transmissions that are pending in the notification queue are passed to
+ * the higher layer in a single call to @ref nrf_802154_notifications_batch. The other
+ * notifications are delivered by their own callouts, preserving the order of the queue.
+ *
+ * This option requires @ref NRF_802154_NOTIFICATION_IMPL to be set to
+ * @ref NRF_802154_NOTIFICATION_IMPL_SWI.
+ */
+#ifndef NRF_802154_NOTIFICATION_BATCH_ENABLED
+#define NRF_802154_NOTIFICATION_BATCH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_BATCH_SIZE
+ *
+ * Maximum number of notifications passed in a single call to @ref nrf_802154_notifications_batch.
+ */
+#ifndef NRF_802154_NOTIFICATION_BATCH_SIZE
+#define NRF_802154_NOTIFICATION_BATCH_SIZE 8
+#endif
+
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED && \
+    (NRF_802154_NOTIFICATION_IMPL != NRF_802154_NOTIFICATION_IMPL_SWI)
+#error "Batched notifications require the SWI notification implementation."
+#endif
+
 /**
  * @def NRF_802154_REQUEST_IMPL_DIRECT
  *
@@ -668,6 +749,19 @@ extern "C" {
 #define NRF_802154_REQUEST_IMPL NRF_802154_REQUEST_IMPL_SWI
 #endif
 
+/**
+ * @def NRF_802154_REQUEST_QUEUE_SIZE
+ *
+ * Number of requests that can be issued concurrently through the SWI "request" module.
+ *
+ * A request is issued without disabling interrupts, so a request issued from a given interrupt
+ * priority can preempt a request being issued from a lower priority. This option must be at least
+ * the number of distinct priorities below the SWI priority that call the driver's API.
+ */
+#ifndef NRF_802154_REQUEST_QUEUE_SIZE
+#define NRF_802154_REQUEST_QUEUE_SIZE 4
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_tx_timestamp_provider Transmit Timestamp configuration
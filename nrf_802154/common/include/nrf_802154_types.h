@@ -314,6 +314,9 @@ typedef struct
     uint32_t coex_granted_requests;   /**< Number of coex requests issued to coex arbiter that have been granted. */
     uint32_t coex_denied_requests;    /**< Number of coex requests issued to coex arbiter that have been denied. */
     uint32_t coex_unsolicited_grants; /**< Number of coex grant activations that have been not requested. */
+    uint32_t request_inversions;      /**< Number of requests that overtook a request preempted while being issued. */
+    uint32_t delayed_rx_missed;       /**< Number of backlogged receive windows that could not be scheduled before their start. */
+    uint32_t rx_buffer_starvations;   /**< Number of times the receiver was left without a free buffer for incoming frames. */
 } nrf_802154_stat_counters_t;
 
 /**
@@ -491,6 +494,47 @@ typedef struct
     int8_t ed_dbm; /**< Maximum detected ED in dBm. */
 } nrf_802154_energy_detected_t;
 
+/**
+ * @brief Types of notifications delivered in batches.
+ */
+typedef uint8_t nrf_802154_batch_ntf_type_t;
+
+#define NRF_802154_BATCH_NTF_RECEIVED        0x00 /**< Frame received, see @ref nrf_802154_received_raw. */
+#define NRF_802154_BATCH_NTF_TRANSMITTED     0x01 /**< Frame transmitted, see @ref nrf_802154_transmitted_raw. */
+#define NRF_802154_BATCH_NTF_TRANSMIT_FAILED 0x02 /**< Frame not transmitted, see @ref nrf_802154_transmit_failed. */
+
+/**
+ * @brief Structure that holds a single notification of a batch.
+ */
+typedef struct
+{
+    nrf_802154_batch_ntf_type_t type; /**< Type of the notification. */
+
+    union
+    {
+        struct
+        {
+            uint8_t * p_data; /**< Pointer to a buffer that contains PHR and PSDU of the received frame. */
+            int8_t    power;  /**< RSSI of the received frame. */
+            uint8_t   lqi;    /**< LQI of the received frame. */
+            uint64_t  time;   /**< Timestamp taken when the last symbol of the frame was received or @ref NRF_802154_NO_TIMESTAMP. */
+        } received;           /**< Details of a received frame. */
+
+        struct
+        {
+            uint8_t                           * p_frame;  /**< Pointer to a buffer that contains PHR and PSDU of the transmitted frame. */
+            nrf_802154_transmit_done_metadata_t metadata; /**< Metadata structure describing @ref p_frame. */
+        } transmitted;                                    /**< Details of a transmitted frame. */
+
+        struct
+        {
+            uint8_t                           * p_frame;  /**< Pointer to a buffer that contains PHR and PSDU of the frame that was not transmitted. */
+            nrf_802154_tx_error_t               error;    /**< Reason of the failure. */
+            nrf_802154_transmit_done_metadata_t metadata; /**< Metadata structure describing @ref p_frame. */
+        } transmit_failed;                                /**< Details of a failed transmission. */
+    } data;                                               /**< Notification data depending on its type. */
+} nrf_802154_batch_ntf_t;
+
 /**
  *@}
  **/
@@ -45,38 +45,82 @@
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame.h"
-#include "nrf_802154_bsmap.h"
+#include "mac_features/nrf_802154_ie_writer.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_hmap.h"
 
 /** Maximum number of Short Addresses of nodes for which there is ACK data to set. */
 #define NUM_SHORT_ADDRESSES    NRF_802154_PENDING_SHORT_ADDRESSES
 /** Maximum number of Extended Addresses of nodes for which there is ACK data to set. */
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
 
-#define BSMAP_PEER_AUX_MEM_SIZE                              \
-    NRF_802154_BSMAP_AUX_MEMORY_SIZE(                        \
-        NRFX_MAX(EXTENDED_ADDRESS_SIZE, SHORT_ADDRESS_SIZE), \
-        sizeof(nrf_802154_peer_rec_t))
+/** Number of words of memory needed by a peer table. */
+#define PEER_TABLE_MEMORY_WORDS(addr_size, num_addresses)          \
+    ((NRF_802154_HMAP_MEMORY_SIZE((addr_size),                     \
+                                  sizeof(nrf_802154_peer_rec_t),   \
+                                  (num_addresses)) +               \
+      sizeof(uint32_t) - 1U) / sizeof(uint32_t))
 
-static nrf_802154_bsmap_t m_bsmap_shortaddr;
-static uint8_t m_bsmap_shortaddr_mem[NRF_802154_BSMAP_MEMORY_SIZE(
-                                         SHORT_ADDRESS_SIZE,
-                                         sizeof(nrf_802154_peer_rec_t),
-                                         NUM_SHORT_ADDRESSES)];
+/** @brief Peer table and the memory it is stored in. */
+typedef struct
+{
+    nrf_802154_hmap_t hmap;          ///< Hash map of the peer records.
+    void            * p_memory;      ///< Memory of the hash map.
+    uint16_t          num_addresses; ///< Maximum number of peers in the hash map.
+} peer_table_t;
+
+static uint32_t m_shortaddr_default_mem[PEER_TABLE_MEMORY_WORDS(SHORT_ADDRESS_SIZE,
+                                                                NUM_SHORT_ADDRESSES)];
+static uint32_t m_extaddr_default_mem[PEER_TABLE_MEMORY_WORDS(EXTENDED_ADDRESS_SIZE,
+                                                              NUM_EXTENDED_ADDRESSES)];
 
-static nrf_802154_bsmap_t m_bsmap_extaddr;
-static uint8_t            m_bsmap_extaddr_mem[NRF_802154_BSMAP_MEMORY_SIZE(
-                                                  EXTENDED_ADDRESS_SIZE,
-                                                  sizeof(nrf_802154_peer_rec_t),
-                                                  NUM_EXTENDED_ADDRESSES)];
+static peer_table_t m_peer_table_shortaddr =
+{
+    .p_memory      = m_shortaddr_default_mem,
+    .num_addresses = NUM_SHORT_ADDRESSES,
+};
+
+static peer_table_t m_peer_table_extaddr =
+{
+    .p_memory      = m_extaddr_default_mem,
+    .num_addresses = NUM_EXTENDED_ADDRESSES,
+};
 
 static bool                        m_pending_bit_enabled;
 static nrf_802154_src_addr_match_t m_src_matching_method;
 
-static inline nrf_802154_bsmap_t * peer_bsmap_get(bool extended)
+static inline peer_table_t * peer_table_get(bool extended)
+{
+    return extended ? &m_peer_table_extaddr : &m_peer_table_shortaddr;
+}
+
+static inline nrf_802154_hmap_t * peer_hmap_get(bool extended)
+{
+    return &peer_table_get(extended)->hmap;
+}
+
+/**
+ * @brief Initialize a peer table in the memory currently assigned to it.
+ *
+ * The ACK generator reads the peer tables when a frame is received, so a table can be initialized
+ * only when the receiver is disabled.
+ *
+ * @param[in]  extended  Selects peer table.
+ */
+static void peer_table_init(bool extended)
 {
-    return extended ? &m_bsmap_extaddr : &m_bsmap_shortaddr;
+    peer_table_t * p_table = peer_table_get(extended);
+    radio_state_t  state   = nrf_802154_core_state_get();
+
+    NRF_802154_ASSERT((state == RADIO_STATE_SLEEP) || (state == RADIO_STATE_FALLING_ASLEEP));
+
+    nrf_802154_hmap_init(&p_table->hmap,
+                         extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE,
+                         sizeof(nrf_802154_peer_rec_t),
+                         p_table->num_addresses,
+                         p_table->p_memory);
 }
 
 /**
@@ -217,24 +261,78 @@ static bool ie_data_set(nrf_802154_peer_ie_data_t * p_ie_data,
     return true;
 }
 
+/**
+ * @brief Finds the layout of the IE data of a peer.
+ *
+ * The layout is found when the IE data is set, so that the IE writer does not need to parse
+ * the IE data while the ACK frame is being prepared.
+ *
+ * @param[inout]  p_ie_data  Pointer to the IE data of the peer.
+ */
+static void ie_data_layout_update(nrf_802154_peer_ie_data_t * p_ie_data)
+{
+#if NRF_802154_IE_WRITER_ENABLED
+
+    nrf_802154_ie_writer_layout_get(p_ie_data->data,
+                                    &p_ie_data->data[p_ie_data->len],
+                                    &p_ie_data->layout);
+
+#else /* NRF_802154_IE_WRITER_ENABLED */
+
+    (void)p_ie_data;
+
+#endif /* NRF_802154_IE_WRITER_ENABLED */
+}
+
 void nrf_802154_ack_data_init(void)
 {
-    nrf_802154_bsmap_init(&m_bsmap_shortaddr,
-                          SHORT_ADDRESS_SIZE,
-                          sizeof(nrf_802154_peer_rec_t),
-                          NUM_SHORT_ADDRESSES,
-                          m_bsmap_shortaddr_mem);
-
-    nrf_802154_bsmap_init(&m_bsmap_extaddr,
-                          EXTENDED_ADDRESS_SIZE,
-                          sizeof(nrf_802154_peer_rec_t),
-                          NUM_EXTENDED_ADDRESSES,
-                          m_bsmap_extaddr_mem);
+    peer_table_init(false);
+    peer_table_init(true);
 
     m_pending_bit_enabled = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
+size_t nrf_802154_ack_data_peer_table_memory_size_get(bool extended, uint16_t num_addresses)
+{
+    size_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    return PEER_TABLE_MEMORY_WORDS(addr_size, (size_t)num_addresses) * sizeof(uint32_t);
+}
+
+bool nrf_802154_ack_data_peer_table_memory_set(bool     extended,
+                                               void   * p_memory,
+                                               size_t   memory_size,
+                                               uint16_t num_addresses)
+{
+    peer_table_t * p_table = peer_table_get(extended);
+    size_t         required_size;
+
+    if (p_memory == NULL)
+    {
+        p_memory      = extended ? m_extaddr_default_mem : m_shortaddr_default_mem;
+        num_addresses = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
+    }
+    else
+    {
+        required_size = nrf_802154_ack_data_peer_table_memory_size_get(extended, num_addresses);
+
+        if ((num_addresses >= (UINT16_MAX / 2U)) ||
+            (memory_size < required_size) ||
+            (((uintptr_t)p_memory % sizeof(uint32_t)) != 0U))
+        {
+            return false;
+        }
+    }
+
+    p_table->p_memory      = p_memory;
+    p_table->num_addresses = num_addresses;
+
+    peer_table_init(extended);
+
+    return true;
+}
+
 void nrf_802154_ack_data_enable(bool enabled)
 {
     m_pending_bit_enabled = enabled;
@@ -244,35 +342,33 @@ bool nrf_802154_peer_rec_get(const uint8_t         * p_addr,
                              bool                    extended,
                              nrf_802154_peer_rec_t * p_peer_rec)
 {
-    const nrf_802154_bsmap_t * p_bsmap = peer_bsmap_get(extended);
+    const nrf_802154_hmap_t * p_hmap = peer_hmap_get(extended);
 
-    return nrf_802154_bsmap_rec_get(p_bsmap, p_addr, p_peer_rec);
+    return nrf_802154_hmap_rec_get(p_hmap, p_addr, p_peer_rec);
 }
 
 bool nrf_802154_peer_rec_write(const uint8_t               * p_addr,
                                bool                          extended,
                                const nrf_802154_peer_rec_t * p_peer_rec)
 {
-    nrf_802154_bsmap_t * p_bsmap = peer_bsmap_get(extended);
-    uint8_t              aux_mem[BSMAP_PEER_AUX_MEM_SIZE];
+    nrf_802154_hmap_t * p_hmap = peer_hmap_get(extended);
 
-    return nrf_802154_bsmap_rec_write(p_bsmap, p_addr, p_peer_rec, aux_mem);
+    return nrf_802154_hmap_rec_write(p_hmap, p_addr, p_peer_rec);
 }
 
 bool nrf_802154_peer_rec_delete(const uint8_t * p_addr,
                                 bool            extended)
 {
-    nrf_802154_bsmap_t * p_bsmap = peer_bsmap_get(extended);
-    uint8_t              aux_mem[BSMAP_PEER_AUX_MEM_SIZE];
+    nrf_802154_hmap_t * p_hmap = peer_hmap_get(extended);
 
-    return nrf_802154_bsmap_rec_delete(p_bsmap, p_addr, aux_mem);
+    return nrf_802154_hmap_rec_delete(p_hmap, p_addr);
 }
 
 void nrf_802154_peer_table_clear(bool extended)
 {
-    nrf_802154_bsmap_t * p_bsmap = peer_bsmap_get(extended);
+    nrf_802154_hmap_t * p_hmap = peer_hmap_get(extended);
 
-    nrf_802154_bsmap_clear(p_bsmap);
+    nrf_802154_hmap_clear(p_hmap);
 }
 
 /**
@@ -350,12 +446,11 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
                                       const void          * p_data,
                                       uint8_t               data_len)
 {
-    nrf_802154_bsmap_t  * p_bsmap = peer_bsmap_get(extended);
+    nrf_802154_hmap_t   * p_hmap = peer_hmap_get(extended);
     nrf_802154_peer_rec_t peer_rec;
-    uint8_t               aux_mem[BSMAP_PEER_AUX_MEM_SIZE];
     bool                  found = true;
 
-    if (!nrf_802154_bsmap_rec_get(p_bsmap, p_addr, &peer_rec))
+    if (!nrf_802154_hmap_rec_get(p_hmap, p_addr, &peer_rec))
     {
         /* Record does not exist yet, make a default one */
         peer_rec_fill_defaults_that_could_be_deleted(&peer_rec);
@@ -369,6 +464,7 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
             {
                 return false;
             }
+            ie_data_layout_update(&peer_rec.ie_data);
             break;
 
         case NRF_802154_ACK_DATA_PENDING_BIT:
@@ -386,7 +482,7 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
     {
         if (found)
         {
-            result = nrf_802154_bsmap_rec_delete(p_bsmap, p_addr, aux_mem);
+            result = nrf_802154_hmap_rec_delete(p_hmap, p_addr);
             /* As we found it shall be possible to remove. */
             NRF_802154_ASSERT(result);
         }
@@ -397,7 +493,7 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
     }
     else
     {
-        result = nrf_802154_bsmap_rec_write(p_bsmap, p_addr, &peer_rec, aux_mem);
+        result = nrf_802154_hmap_rec_write(p_hmap, p_addr, &peer_rec);
     }
 
     return result;
@@ -426,11 +522,10 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type)
 {
-    nrf_802154_bsmap_t  * p_bsmap = peer_bsmap_get(extended);
+    nrf_802154_hmap_t   * p_hmap = peer_hmap_get(extended);
     nrf_802154_peer_rec_t peer_rec;
-    uint8_t               aux_mem[BSMAP_PEER_AUX_MEM_SIZE];
 
-    if (!nrf_802154_bsmap_rec_get(p_bsmap, p_addr, &peer_rec))
+    if (!nrf_802154_hmap_rec_get(p_hmap, p_addr, &peer_rec))
     {
         return false;
     }
@@ -441,11 +536,11 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
 
     if (peer_rec_can_be_deleted(&peer_rec))
     {
-        result = nrf_802154_bsmap_rec_delete(p_bsmap, p_addr, aux_mem);
+        result = nrf_802154_hmap_rec_delete(p_hmap, p_addr);
     }
     else
     {
-        result = nrf_802154_bsmap_rec_write(p_bsmap, p_addr, &peer_rec, aux_mem);
+        result = nrf_802154_hmap_rec_write(p_hmap, p_addr, &peer_rec);
     }
 
     /* As we found it shall be possible to delete or write. */
@@ -463,35 +558,29 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
      * record deleting the record if peer_rec_can_be_deleted allows.
      */
 
-    nrf_802154_bsmap_t        * p_bsmap = peer_bsmap_get(extended);
-    nrf_802154_bsmap_iterator_t iter;
-    nrf_802154_peer_rec_t       peer_rec;
-    uint8_t                     aux_mem[BSMAP_PEER_AUX_MEM_SIZE];
+    nrf_802154_hmap_t        * p_hmap = peer_hmap_get(extended);
+    nrf_802154_hmap_iterator_t iter;
+    nrf_802154_peer_rec_t      peer_rec;
 
-    /* Backward iteration will likely result in deleting records which are
-     * the last one without moving data.
-     */
-    nrf_802154_bsmap_iterator_begin(p_bsmap, &iter, false);
+    nrf_802154_hmap_iterator_begin(p_hmap, &iter);
 
-    while (nrf_802154_bsmap_iterator_is_valid(&iter))
+    while (nrf_802154_hmap_iterator_is_valid(&iter))
     {
-        nrf_802154_bsmap_iterator_rec_value_get(&iter, &peer_rec);
+        nrf_802154_hmap_iterator_rec_value_get(&iter, &peer_rec);
 
         peer_rec_by_data_type_clear(&peer_rec, data_type);
 
         if (peer_rec_can_be_deleted(&peer_rec))
         {
-            nrf_802154_bsmap_iterator_rec_delete(&iter, aux_mem);
+            nrf_802154_hmap_iterator_rec_delete(&iter);
         }
         else
         {
-            nrf_802154_bsmap_iterator_rec_value_write(&iter, &peer_rec, aux_mem);
+            nrf_802154_hmap_iterator_rec_value_write(&iter, &peer_rec);
         }
 
-        nrf_802154_bsmap_iterator_next(&iter);
+        nrf_802154_hmap_iterator_next(&iter);
     }
-
-    nrf_802154_bsmap_iterator_finish(&iter);
 }
 
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
@@ -42,16 +42,19 @@
 #define NRF_802154_ACK_DATA_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "nrf_802154_types.h"
 #include "mac_features/nrf_802154_frame.h"
+#include "mac_features/nrf_802154_ie_writer.h"
 
 /** @brief Structure representing a single IE record for a peer. */
 typedef struct
 {
-    uint8_t data[NRF_802154_MAX_ACK_IE_SIZE]; /**< IE data buffer. */
-    uint8_t len;                              /**< Length of the buffer. */
+    uint8_t                       data[NRF_802154_MAX_ACK_IE_SIZE]; /**< IE data buffer. */
+    uint8_t                       len;                              /**< Length of the buffer. */
+    nrf_802154_ie_writer_layout_t layout;                           /**< Layout of the IE data found when the IE data was set. */
 } nrf_802154_peer_ie_data_t;
 
 /** @brief Information record about a peer. */
@@ -68,6 +71,42 @@ typedef struct
  */
 void nrf_802154_ack_data_init(void);
 
+/**
+ * @brief Get the size of the memory needed by a peer table.
+ *
+ * @param[in]  extended       Selects peer table.
+ *                            @c false for the short address peer table.
+ *                            @c true for the extended address peer table.
+ * @param[in]  num_addresses  Maximum number of peers in the table.
+ *
+ * @returns  Size of the memory in bytes.
+ */
+size_t nrf_802154_ack_data_peer_table_memory_size_get(bool extended, uint16_t num_addresses);
+
+/**
+ * @brief Set the memory a peer table is stored in.
+ *
+ * The peer table is initialized in the new memory, all its records are removed. The memory
+ * is kept by subsequent calls to @ref nrf_802154_ack_data_init.
+ *
+ * @param[in]  extended       Selects peer table.
+ *                            @c false for the short address peer table.
+ *                            @c true for the extended address peer table.
+ * @param[in]  p_memory       Pointer to the memory aligned to 4 bytes, or NULL to restore
+ *                            the static memory sized with @ref NRF_802154_PENDING_SHORT_ADDRESSES
+ *                            or @ref NRF_802154_PENDING_EXTENDED_ADDRESSES.
+ * @param[in]  memory_size    Size of @p p_memory in bytes. Ignored if @p p_memory is NULL.
+ * @param[in]  num_addresses  Maximum number of peers in the table. Must be less than
+ *                            @c UINT16_MAX / 2 . Ignored if @p p_memory is NULL.
+ *
+ * @retval true   The memory is set.
+ * @retval false  The memory is too small for @p num_addresses peers or is not aligned.
+ */
+bool nrf_802154_ack_data_peer_table_memory_set(bool     extended,
+                                               void   * p_memory,
+                                               size_t   memory_size,
+                                               uint16_t num_addresses);
+
 /**
  * @brief Enable or disable the ACK data generator module.
  *
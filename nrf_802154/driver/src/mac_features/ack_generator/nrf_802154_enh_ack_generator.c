@@ -68,6 +68,8 @@ static nrf_802154_frame_t m_ack_data;
 static const uint8_t    * mp_ie_data;
 static uint8_t            m_ie_data_len;
 
+static const nrf_802154_ie_writer_layout_t * mp_ie_layout;
+
 static void ack_state_set(ack_state_t state_to_set)
 {
     m_ack_state = state_to_set;
@@ -396,9 +398,10 @@ static bool security_header_set(const nrf_802154_frame_t * p_frame_data,
  * @section Information Elements
  **************************************************************************************************/
 
-static void ie_header_set(const uint8_t      * p_ie_data,
-                          uint8_t              ie_data_len,
-                          nrf_802154_frame_t * p_ack_data)
+static void ie_header_set(const uint8_t                       * p_ie_data,
+                          uint8_t                               ie_data_len,
+                          const nrf_802154_ie_writer_layout_t * p_ie_layout,
+                          nrf_802154_frame_t                  * p_ack_data)
 {
     uint8_t   ie_offset = p_ack_data->helper.aux_sec_hdr_end_offset;
     uint8_t * p_ack_ie;
@@ -416,7 +419,12 @@ static void ie_header_set(const uint8_t      * p_ie_data,
 
 #if NRF_802154_IE_WRITER_ENABLED
 
-    nrf_802154_ie_writer_prepare(p_ack_ie, p_ack_ie + ie_data_len);
+    /* The IE data was parsed when it was set for the peer. */
+    nrf_802154_ie_writer_layout_prepare(p_ack_ie, p_ie_layout);
+
+#else /* NRF_802154_IE_WRITER_ENABLED */
+
+    (void)p_ie_layout;
 
 #endif /* NRF_802154_IE_WRITER_ENABLED */
 }
@@ -484,11 +492,13 @@ static void addr_end_process(const nrf_802154_frame_t    * p_frame_data,
     {
         mp_ie_data    = &p_peer_rec->ie_data.data[0];
         m_ie_data_len = p_peer_rec->ie_data.len;
+        mp_ie_layout  = &p_peer_rec->ie_data.layout;
     }
     else
     {
         mp_ie_data    = NULL;
         m_ie_data_len = 0U;
+        mp_ie_layout  = NULL;
     }
 
     /* Update the IE present bit in Frame Control field knowing if IEs should be present. */
@@ -526,7 +536,7 @@ static bool aux_sec_hdr_process(const nrf_802154_frame_t * p_frame_data)
 static void ie_process(const nrf_802154_frame_t * p_frame_data)
 {
     /* Set IE header. */
-    ie_header_set(mp_ie_data, m_ie_data_len, &m_ack_data);
+    ie_header_set(mp_ie_data, m_ie_data_len, mp_ie_layout, &m_ack_data);
     m_ack[PHR_OFFSET] += m_ie_data_len;
 
     /* Add space for the FCS field. */
@@ -640,6 +650,7 @@ void nrf_802154_enh_ack_generator_reset(void)
     (void)nrf_802154_frame_parser_data_init(m_ack, 0U, PARSE_LEVEL_NONE, &m_ack_data);
     mp_ie_data    = 0U;
     m_ie_data_len = 0U;
+    mp_ie_layout  = NULL;
     m_ack_state   = ACK_STATE_RESET;
 }
 
@@ -55,7 +55,9 @@
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_hmap.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_tx_power.h"
 #include "rsch/nrf_802154_rsch.h"
@@ -116,6 +118,7 @@ typedef struct
 typedef struct
 {
     nrf_802154_sl_timer_t            timeout_timer;   ///< Timer for delayed RX timeout handling.
+    uint64_t                         rx_time;         ///< Requested start time of RX window.
     uint32_t                         timeout_length;  ///< Requested length [us] of RX window plus RX_RAMP_UP_TIME.
     volatile delayed_rx_frame_data_t extension_frame; ///< Data of frame that caused extension of RX window.
     uint8_t                          channel;         ///< Channel number on which reception should be performed.
@@ -162,6 +165,7 @@ static void delayed_tx_started(const nrf_802154_tx_client_t * p_client);
 static void delayed_tx_done(uint8_t                                   * p_frame,
                             const nrf_802154_transmit_done_metadata_t * p_metadata,
                             const nrf_802154_tx_client_t              * p_client);
+static void dly_rx_backlog_process(void);
 
 static const nrf_802154_tx_client_interface_t m_delayed_trx_tx_client_iface = {
     .can_abort = delayed_tx_can_abort,
@@ -190,6 +194,294 @@ static nrf_802154_queue_t m_dly_rx_id_q;
  */
 static dly_op_data_t * m_dly_rx_id_q_mem[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
 
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+
+#define DLY_RX_BACKLOG_RETRY_DELAY 1000u ///< Delay [us] of the next attempt to report missed RX windows if the notification queue is full.
+
+/**
+ * @brief RX window waiting for a slot for RX delayed operations.
+ */
+typedef struct
+{
+    uint64_t rx_time;  ///< Requested start time of RX window.
+    uint32_t timeout;  ///< Requested length of RX window.
+    uint32_t id;       ///< Identifier of RX window.
+    uint16_t heap_pos; ///< Position of the window in the backlog heap.
+    uint8_t  channel;  ///< Channel number on which reception should be performed.
+} dly_rx_backlog_entry_t;
+
+/**
+ * @brief Storage for RX windows waiting for a slot.
+ */
+static dly_rx_backlog_entry_t m_dly_rx_backlog[NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE];
+
+/**
+ * @brief Binary min-heap of indexes of the waiting RX windows, ordered by their start time.
+ */
+static uint16_t m_dly_rx_backlog_heap[NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE];
+
+/**
+ * @brief Number of RX windows in @ref m_dly_rx_backlog_heap.
+ */
+static uint16_t m_dly_rx_backlog_len;
+
+/**
+ * @brief Stack of indexes of unused entries of @ref m_dly_rx_backlog.
+ */
+static uint16_t m_dly_rx_backlog_free[NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE];
+
+/**
+ * @brief Number of indexes in @ref m_dly_rx_backlog_free.
+ */
+static uint16_t m_dly_rx_backlog_free_cnt;
+
+/**
+ * @brief Timer retrying to report missed RX windows when the notification queue was full.
+ */
+static nrf_802154_sl_timer_t m_dly_rx_backlog_retry_timer;
+
+/**
+ * @brief Index mapping the identifier of a waiting RX window to its entry in @ref m_dly_rx_backlog.
+ */
+static nrf_802154_hmap_t m_dly_rx_backlog_index;
+static uint16_t          m_dly_rx_backlog_index_mem[(NRF_802154_HMAP_MEMORY_SIZE(
+                                                         sizeof(uint32_t),
+                                                         sizeof(uint16_t),
+                                                         NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE) +
+                                                     sizeof(uint16_t) - 1U) / sizeof(uint16_t)];
+
+/**
+ * @brief Check if the RX window at a position of the backlog heap starts earlier than another.
+ */
+static bool dly_rx_backlog_heap_less(uint16_t pos_a, uint16_t pos_b)
+{
+    return m_dly_rx_backlog[m_dly_rx_backlog_heap[pos_a]].rx_time <
+           m_dly_rx_backlog[m_dly_rx_backlog_heap[pos_b]].rx_time;
+}
+
+/**
+ * @brief Swap two positions of the backlog heap.
+ */
+static void dly_rx_backlog_heap_swap(uint16_t pos_a, uint16_t pos_b)
+{
+    uint16_t idx_a = m_dly_rx_backlog_heap[pos_a];
+    uint16_t idx_b = m_dly_rx_backlog_heap[pos_b];
+
+    m_dly_rx_backlog_heap[pos_a]     = idx_b;
+    m_dly_rx_backlog_heap[pos_b]     = idx_a;
+    m_dly_rx_backlog[idx_b].heap_pos = pos_a;
+    m_dly_rx_backlog[idx_a].heap_pos = pos_b;
+}
+
+/**
+ * @brief Restore the order of the backlog heap after the RX window at given position has changed.
+ *
+ * @param[in]  pos  Position of the RX window in the backlog heap.
+ */
+static void dly_rx_backlog_heap_fix(uint16_t pos)
+{
+    while ((pos > 0U) && dly_rx_backlog_heap_less(pos, (pos - 1U) / 2U))
+    {
+        dly_rx_backlog_heap_swap(pos, (pos - 1U) / 2U);
+        pos = (pos - 1U) / 2U;
+    }
+
+    while (true)
+    {
+        uint16_t child = 2U * pos + 1U;
+
+        if (child >= m_dly_rx_backlog_len)
+        {
+            break;
+        }
+
+        if (((child + 1U) < m_dly_rx_backlog_len) && dly_rx_backlog_heap_less(child + 1U, child))
+        {
+            child++;
+        }
+
+        if (!dly_rx_backlog_heap_less(child, pos))
+        {
+            break;
+        }
+
+        dly_rx_backlog_heap_swap(pos, child);
+        pos = child;
+    }
+}
+
+/**
+ * @brief Remove an RX window from the backlog. Must be called in a critical section.
+ *
+ * @param[in]  idx  Index of the RX window entry in @ref m_dly_rx_backlog.
+ */
+static void dly_rx_backlog_entry_remove(uint16_t idx)
+{
+    uint16_t pos  = m_dly_rx_backlog[idx].heap_pos;
+    uint16_t last = m_dly_rx_backlog_len - 1U;
+
+    (void)nrf_802154_hmap_rec_delete(&m_dly_rx_backlog_index, &m_dly_rx_backlog[idx].id);
+
+    if (pos != last)
+    {
+        dly_rx_backlog_heap_swap(pos, last);
+    }
+
+    m_dly_rx_backlog_len--;
+
+    if (pos != last)
+    {
+        dly_rx_backlog_heap_fix(pos);
+    }
+
+    m_dly_rx_backlog_free[m_dly_rx_backlog_free_cnt++] = idx;
+}
+
+/**
+ * @brief Add an RX window to the backlog.
+ *
+ * @param[in]  rx_time  Requested start time of RX window.
+ * @param[in]  timeout  Requested length of RX window.
+ * @param[in]  channel  Channel number on which reception should be performed.
+ * @param[in]  id       Identifier of RX window.
+ *
+ * @retval true   The window was added to the backlog.
+ * @retval false  The backlog is full.
+ */
+static bool dly_rx_backlog_push(uint64_t rx_time, uint32_t timeout, uint8_t channel, uint32_t id)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    mcu_cs = nrf_802154_mcu_critical_enter();
+
+    if (m_dly_rx_backlog_free_cnt > 0U)
+    {
+        uint16_t idx = m_dly_rx_backlog_free[m_dly_rx_backlog_free_cnt - 1U];
+
+        if (nrf_802154_hmap_rec_write(&m_dly_rx_backlog_index, &id, &idx))
+        {
+            uint16_t pos = m_dly_rx_backlog_len++;
+
+            m_dly_rx_backlog_free_cnt--;
+
+            m_dly_rx_backlog[idx].rx_time  = rx_time;
+            m_dly_rx_backlog[idx].timeout  = timeout;
+            m_dly_rx_backlog[idx].channel  = channel;
+            m_dly_rx_backlog[idx].id       = id;
+            m_dly_rx_backlog[idx].heap_pos = pos;
+            m_dly_rx_backlog_heap[pos]     = idx;
+
+            dly_rx_backlog_heap_fix(pos);
+
+            result = true;
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Remove the earliest RX window from the backlog.
+ *
+ * @param[out]  p_entry  Copy of the removed RX window.
+ *
+ * @retval true   The earliest window was removed.
+ * @retval false  The backlog is empty.
+ */
+static bool dly_rx_backlog_pop(dly_rx_backlog_entry_t * p_entry)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    mcu_cs = nrf_802154_mcu_critical_enter();
+
+    if (m_dly_rx_backlog_len > 0U)
+    {
+        uint16_t idx = m_dly_rx_backlog_heap[0];
+
+        *p_entry = m_dly_rx_backlog[idx];
+        dly_rx_backlog_entry_remove(idx);
+
+        result = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Remove the RX window with given ID from the backlog.
+ *
+ * @param[in]  id  Identifier of RX window.
+ *
+ * @retval true   The window was found and removed.
+ * @retval false  The window is not in the backlog.
+ */
+static bool dly_rx_backlog_remove(uint32_t id)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint16_t                        idx;
+    bool                            result;
+
+    mcu_cs = nrf_802154_mcu_critical_enter();
+
+    result = nrf_802154_hmap_rec_get(&m_dly_rx_backlog_index, &id, &idx);
+
+    if (result)
+    {
+        dly_rx_backlog_entry_remove(idx);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Check if the RX window with given ID is in the backlog.
+ *
+ * @param[in]  id  Identifier of RX window.
+ */
+static bool dly_rx_backlog_contains(uint32_t id)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    mcu_cs = nrf_802154_mcu_critical_enter();
+    result = nrf_802154_hmap_rec_get(&m_dly_rx_backlog_index, &id, NULL);
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Remove all RX windows from the backlog.
+ */
+static void dly_rx_backlog_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    mcu_cs = nrf_802154_mcu_critical_enter();
+
+    nrf_802154_hmap_clear(&m_dly_rx_backlog_index);
+
+    m_dly_rx_backlog_len      = 0U;
+    m_dly_rx_backlog_free_cnt = NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE;
+
+    for (uint16_t i = 0U; i < NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE; i++)
+    {
+        m_dly_rx_backlog_free[i] = NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE - 1U - i;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif /* NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0 */
+
 /**
  * @brief Search for a RX delayed operation with given ID.
  *
@@ -500,6 +792,8 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
         {
             (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
         }
+
+        dly_rx_backlog_process();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -632,6 +926,7 @@ static void dly_rx_result_notify(bool result)
         uint64_t now;
 
         dly_rx_all_ongoing_abort();
+        dly_rx_backlog_process();
 
         now = nrf_802154_sl_timer_current_time_get();
         uint32_t tout_len = p_dly_op_data->rx.timeout_length;
@@ -794,11 +1089,191 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
                                   DELAYED_TRX_OP_STATE_STOPPED);
         NRF_802154_ASSERT(result);
         (void)result;
+
+        dly_rx_backlog_process();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+/**
+ * Request a delayed RX timeslot for an RX window.
+ *
+ * @param[inout]  p_dly_rx_data  Slot for RX delayed operation, in the pending state.
+ * @param[in]     rx_time        Requested start time of RX window.
+ * @param[in]     timeout        Requested length of RX window.
+ * @param[in]     channel        Channel number on which reception should be performed.
+ * @param[in]     id             Identifier of RX window.
+ *
+ * @retval true   The timeslot was requested.
+ * @retval false  The timeslot could not be requested. The slot was released.
+ */
+static bool dly_rx_schedule(dly_op_data_t * p_dly_rx_data,
+                            uint64_t        rx_time,
+                            uint32_t        timeout,
+                            uint8_t         channel,
+                            uint32_t        id)
+{
+    p_dly_rx_data->op = RSCH_DLY_TS_OP_DRX;
+
+    p_dly_rx_data->rx.rx_time        = rx_time;
+    p_dly_rx_data->rx.timeout_length = timeout + RX_RAMP_UP_TIME +
+                                       RX_SETUP_TIME_MAX;
+    p_dly_rx_data->rx.timeout_timer.action.callback.callback = notify_rx_timeout;
+
+    p_dly_rx_data->rx.channel = channel;
+    p_dly_rx_data->id         = id;
+
+    rx_time -= RX_SETUP_TIME_MAX;
+    rx_time -= RX_RAMP_UP_TIME;
+
+    rsch_dly_ts_param_t dly_ts_param =
+    {
+        .trigger_time     = rx_time,
+        .ppi_trigger_en   = true,
+        .ppi_trigger_dly  = RX_SETUP_TIME_MAX,
+        .prio             = RSCH_PRIO_IDLE_LISTENING,
+        .op               = RSCH_DLY_TS_OP_DRX,
+        .type             = RSCH_DLY_TS_TYPE_PRECISE,
+        .started_callback = rx_timeslot_started_callback,
+        .id               = id,
+    };
+
+    return dly_op_request(&dly_ts_param, p_dly_rx_data);
+}
+
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+
+/**
+ * Pass the earliest RX windows waiting in the backlog to the released slots for RX delayed
+ * operations.
+ *
+ * A window that cannot be scheduled anymore because its start time has passed is reported
+ * as denied and counted as missed.
+ */
+static void dly_rx_backlog_process(void)
+{
+    dly_rx_backlog_entry_t entry;
+    dly_op_data_t        * p_dly_rx_data;
+
+    while ((p_dly_rx_data = available_dly_rx_slot_get()) != NULL)
+    {
+        if (!dly_rx_backlog_pop(&entry))
+        {
+            // No window is waiting. Release the slot
+            bool result = dly_op_state_set(p_dly_rx_data,
+                                           DELAYED_TRX_OP_STATE_PENDING,
+                                           DELAYED_TRX_OP_STATE_STOPPED);
+
+            NRF_802154_ASSERT(result);
+            (void)result;
+            break;
+        }
+
+        if (dly_rx_schedule(p_dly_rx_data, entry.rx_time, entry.timeout, entry.channel, entry.id))
+        {
+            continue;
+        }
+
+        if (!nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
+                                              entry.id,
+                                              false))
+        {
+            // Retry once the notification queue is drained
+            nrf_802154_sl_timer_ret_t ret;
+
+            (void)dly_rx_backlog_push(entry.rx_time, entry.timeout, entry.channel, entry.id);
+            (void)nrf_802154_sl_timer_remove(&m_dly_rx_backlog_retry_timer);
+
+            m_dly_rx_backlog_retry_timer.trigger_time = nrf_802154_sl_timer_current_time_get() +
+                                                        DLY_RX_BACKLOG_RETRY_DELAY;
+
+            ret = nrf_802154_sl_timer_add(&m_dly_rx_backlog_retry_timer);
+            NRF_802154_ASSERT(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+            (void)ret;
+            break;
+        }
+
+        nrf_802154_stat_counter_increment_delayed_rx_missed();
+    }
+}
+
+/**
+ * Retry processing the backlog.
+ *
+ * @param[in]  p_timer  Not used.
+ */
+static void dly_rx_backlog_retry(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    dly_rx_backlog_process();
+}
+
+/**
+ * Take the slot of the latest pending RX window that starts later than a new RX window.
+ *
+ * The displaced window is moved to the backlog.
+ *
+ * @param[in]  rx_time  Requested start time of the new RX window.
+ *
+ * @return Pointer to the taken slot in the pending state or NULL if no slot can be taken.
+ */
+static dly_op_data_t * dly_rx_pending_displace(uint64_t rx_time)
+{
+    dly_op_data_t * p_latest = NULL;
+
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_dly_rx_data); i++)
+    {
+        if ((m_dly_rx_data[i].state == DELAYED_TRX_OP_STATE_PENDING) &&
+            (m_dly_rx_data[i].rx.rx_time > rx_time) &&
+            ((p_latest == NULL) || (m_dly_rx_data[i].rx.rx_time > p_latest->rx.rx_time)))
+        {
+            p_latest = &m_dly_rx_data[i];
+        }
+    }
+
+    if ((p_latest == NULL) || (m_dly_rx_backlog_free_cnt == 0U))
+    {
+        return NULL;
+    }
+
+    if (!nrf_802154_rsch_delayed_timeslot_cancel(p_latest->id, false))
+    {
+        // The timeslot of the window has already started
+        return NULL;
+    }
+
+    uint32_t id      = p_latest->id;
+    uint32_t timeout = p_latest->rx.timeout_length - RX_RAMP_UP_TIME - RX_SETUP_TIME_MAX;
+
+    p_latest->id = NRF_802154_RESERVED_INVALID_ID;
+
+    if (!dly_rx_backlog_push(p_latest->rx.rx_time, timeout, p_latest->rx.channel, id))
+    {
+        bool notified = nrf_802154_notify_receive_failed(
+            NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
+            id,
+            false);
+
+        NRF_802154_ASSERT(notified);
+        (void)notified;
+
+        nrf_802154_stat_counter_increment_delayed_rx_missed();
+    }
+
+    return p_latest;
+}
+
+#else
+
+static void dly_rx_backlog_process(void)
+{
+    // Intentionally empty
+}
+
+#endif /* NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0 */
+
 #ifdef TEST
 #include "string.h"
 void nrf_802154_delayed_trx_module_reset(void)
@@ -807,6 +1282,10 @@ void nrf_802154_delayed_trx_module_reset(void)
     memset(m_dly_tx_data, 0, sizeof(m_dly_tx_data));
     memset(&m_dly_rx_id_q, 0, sizeof(m_dly_rx_id_q));
     memset(m_dly_rx_id_q_mem, 0, sizeof(m_dly_rx_id_q_mem));
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    memset(m_dly_rx_backlog, 0, sizeof(m_dly_rx_backlog));
+    memset(m_dly_rx_backlog_heap, 0, sizeof(m_dly_rx_backlog_heap));
+#endif
 }
 
 #endif // TEST
@@ -818,6 +1297,19 @@ void nrf_802154_delayed_trx_init(void)
                           sizeof(m_dly_rx_id_q_mem),
                           sizeof(m_dly_rx_id_q_mem[0]));
 
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    nrf_802154_hmap_init(&m_dly_rx_backlog_index,
+                         sizeof(uint32_t),
+                         sizeof(uint16_t),
+                         NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE,
+                         m_dly_rx_backlog_index_mem);
+    dly_rx_backlog_clear();
+
+    nrf_802154_sl_timer_init(&m_dly_rx_backlog_retry_timer);
+    m_dly_rx_backlog_retry_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_dly_rx_backlog_retry_timer.action.callback.callback = dly_rx_backlog_retry;
+#endif
+
     for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_dly_rx_data); i++)
     {
         m_dly_rx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
@@ -835,6 +1327,10 @@ void nrf_802154_delayed_trx_init(void)
 
 void nrf_802154_delayed_trx_deinit(void)
 {
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    nrf_802154_sl_timer_deinit(&m_dly_rx_backlog_retry_timer);
+#endif
+
     for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_dly_rx_data); i++)
     {
         nrf_802154_sl_timer_deinit(&m_dly_rx_data[i].rx.timeout_timer);
@@ -911,36 +1407,38 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
         return false;
     }
 
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    if (dly_rx_backlog_contains(id))
+    {
+        /* DRX with given id is already waiting in the backlog. */
+        return false;
+    }
+#endif
+
     dly_op_data_t * p_dly_rx_data = available_dly_rx_slot_get();
     bool            result        = false;
 
-    if (p_dly_rx_data != NULL)
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    if (p_dly_rx_data == NULL)
     {
-        rx_time -= RX_SETUP_TIME_MAX;
-        rx_time -= RX_RAMP_UP_TIME;
-
-        p_dly_rx_data->op = RSCH_DLY_TS_OP_DRX;
+        p_dly_rx_data = dly_rx_pending_displace(rx_time);
+    }
 
-        p_dly_rx_data->rx.timeout_length = timeout + RX_RAMP_UP_TIME +
-                                           RX_SETUP_TIME_MAX;
-        p_dly_rx_data->rx.timeout_timer.action.callback.callback = notify_rx_timeout;
+    if (p_dly_rx_data == NULL)
+    {
+        /* All slots are taken by earlier windows. Wait for a slot to be released. */
+        result = dly_rx_backlog_push(rx_time, timeout, channel, id);
 
-        p_dly_rx_data->rx.channel = channel;
-        p_dly_rx_data->id         = id;
+        // A slot could have been released before the window was added to the backlog
+        dly_rx_backlog_process();
 
-        rsch_dly_ts_param_t dly_ts_param =
-        {
-            .trigger_time     = rx_time,
-            .ppi_trigger_en   = true,
-            .ppi_trigger_dly  = RX_SETUP_TIME_MAX,
-            .prio             = RSCH_PRIO_IDLE_LISTENING,
-            .op               = RSCH_DLY_TS_OP_DRX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = rx_timeslot_started_callback,
-            .id               = id,
-        };
+        return result;
+    }
+#endif
 
-        result = dly_op_request(&dly_ts_param, p_dly_rx_data);
+    if (p_dly_rx_data != NULL)
+    {
+        result = dly_rx_schedule(p_dly_rx_data, rx_time, timeout, channel, id);
     }
 
     return result;
@@ -976,7 +1474,11 @@ bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
     if (p_dly_op_data == NULL)
     {
         // Delayed receive window with provided ID could not be found.
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+        return dly_rx_backlog_remove(id);
+#else
         return false;
+#endif
     }
 
     bool result      = nrf_802154_rsch_delayed_timeslot_cancel(id, false);
@@ -993,6 +1495,8 @@ bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
 
         nrf_802154_sl_atomic_store_u8((uint8_t *)&p_dly_op_data->state,
                                       DELAYED_TRX_OP_STATE_STOPPED);
+
+        dly_rx_backlog_process();
     }
 
     return stopped;
@@ -1005,6 +1509,9 @@ bool nrf_802154_delayed_trx_receive_scheduled_cancel(uint32_t id)
     if (p_dly_op_data == NULL)
     {
         // Delayed receive window with provided ID could not be found.
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+        (void)dly_rx_backlog_remove(id);
+#endif
         return true;
     }
 
@@ -1023,6 +1530,8 @@ bool nrf_802154_delayed_trx_receive_scheduled_cancel(uint32_t id)
 
         nrf_802154_sl_atomic_store_u8((uint8_t *)&p_dly_op_data->state,
                                       DELAYED_TRX_OP_STATE_STOPPED);
+
+        dly_rx_backlog_process();
     }
 
     return result;
@@ -1032,6 +1541,10 @@ bool nrf_802154_delayed_trx_receive_scheduled_cancel(uint32_t id)
 
 void nrf_802154_delayed_trx_receive_cancel_all(void)
 {
+#if NRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE > 0
+    dly_rx_backlog_clear();
+#endif
+
     for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_dly_rx_data); i++)
     {
         dly_op_data_t  * p_dly_op_data = &m_dly_rx_data[i];
@@ -1070,6 +1583,7 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     }
 
     dly_rx_all_ongoing_abort();
+    dly_rx_backlog_process();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
     return true;
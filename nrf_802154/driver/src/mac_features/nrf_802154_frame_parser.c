@@ -53,134 +53,139 @@
 
 // Addressing
 
-static bool src_addr_is_present(const nrf_802154_frame_t * p_parser_data)
-{
-    return nrf_802154_frame_src_addr_type_get(p_parser_data) != SRC_ADDR_TYPE_NONE;
-}
-
-static uint8_t src_addr_size_get(const nrf_802154_frame_t * p_parser_data)
+/**
+ * @brief Layout of the addressing fields of the MAC header.
+ *
+ * All offsets are relative to the end of the Sequence Number field (or the end of the Frame
+ * Control Field if the sequence number is suppressed). Fields that are not present in the frame
+ * are set to @ref NRF_802154_FRAME_INVALID_OFFSET. Sizes are set to
+ * @ref NRF_802154_FRAME_INVALID_OFFSET if the addressing mode is reserved.
+ */
+typedef struct
 {
-    uint8_t addr_type = nrf_802154_frame_src_addr_type_get(p_parser_data);
-
-    switch (addr_type)
-    {
-        case SRC_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
-
-        case SRC_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
+    uint8_t dst_panid_offset;          ///< Destination PAN ID offset.
+    uint8_t dst_addr_offset;           ///< Destination address offset.
+    uint8_t dst_addr_size;             ///< Destination address size.
+    uint8_t dst_addressing_end_offset; ///< Destination addressing end offset.
+    uint8_t src_panid_offset;          ///< Source PAN ID offset.
+    uint8_t src_addr_offset;           ///< Source address offset.
+    uint8_t src_addr_size;             ///< Source address size.
+    uint8_t addressing_end_offset;     ///< Addressing end offset.
+} addressing_layout_t;
+
+/* The layout table is indexed by the PAN ID Compression bit (bit 0) and by the addressing mode
+ * and frame version bits of the second octet of the Frame Control Field shifted right by one,
+ * which gives in order: the destination addressing mode (bits 1-2), the frame version (bits 3-4)
+ * and the source addressing mode (bits 5-6). The table entries are computed at build time from
+ * the rules given in IEEE Std 802.15.4-2015, Section 7.2.1.5 (PAN ID Compression field).
+ */
+#define LAYOUT_IDX_PANID_COMP(idx) ((idx) & 0x01)
+#define LAYOUT_IDX_DST_MODE(idx)   (((idx) >> 1) & 0x03)
+#define LAYOUT_IDX_VERSION(idx)    (((idx) >> 3) & 0x03)
+#define LAYOUT_IDX_SRC_MODE(idx)   (((idx) >> 5) & 0x03)
+
+#define LAYOUT_ADDR_MODE_NONE      0x00
+#define LAYOUT_ADDR_MODE_SHORT     0x02
+#define LAYOUT_ADDR_MODE_EXTENDED  0x03
+
+#define LAYOUT_ADDR_SIZE(mode)                                                                     \
+    (((mode) == LAYOUT_ADDR_MODE_EXTENDED) ? EXTENDED_ADDRESS_SIZE :                               \
+     ((mode) == LAYOUT_ADDR_MODE_SHORT) ? SHORT_ADDRESS_SIZE :                                     \
+     ((mode) == LAYOUT_ADDR_MODE_NONE) ? 0 : NRF_802154_FRAME_INVALID_OFFSET)
+
+#define LAYOUT_IS_VALID(idx)                                                                       \
+    ((LAYOUT_ADDR_SIZE(LAYOUT_IDX_DST_MODE(idx)) != NRF_802154_FRAME_INVALID_OFFSET) &&            \
+     (LAYOUT_ADDR_SIZE(LAYOUT_IDX_SRC_MODE(idx)) != NRF_802154_FRAME_INVALID_OFFSET))
+
+#define LAYOUT_DST_ADDR_PRESENT(idx) (LAYOUT_IDX_DST_MODE(idx) != LAYOUT_ADDR_MODE_NONE)
+#define LAYOUT_SRC_ADDR_PRESENT(idx) (LAYOUT_IDX_SRC_MODE(idx) != LAYOUT_ADDR_MODE_NONE)
+#define LAYOUT_BOTH_ADDR_EXTENDED(idx)                                                             \
+    ((LAYOUT_IDX_DST_MODE(idx) == LAYOUT_ADDR_MODE_EXTENDED) &&                                    \
+     (LAYOUT_IDX_SRC_MODE(idx) == LAYOUT_ADDR_MODE_EXTENDED))
+
+#define LAYOUT_DST_PANID_PRESENT(idx)                                                              \
+    ((LAYOUT_IDX_VERSION(idx) < (FRAME_VERSION_2 >> 4)) ?                                          \
+     LAYOUT_DST_ADDR_PRESENT(idx) :                                                                \
+     LAYOUT_BOTH_ADDR_EXTENDED(idx) ? !LAYOUT_IDX_PANID_COMP(idx) :                                \
+     (LAYOUT_SRC_ADDR_PRESENT(idx) && LAYOUT_DST_ADDR_PRESENT(idx)) ? 1 :                          \
+     LAYOUT_SRC_ADDR_PRESENT(idx) ? 0 :                                                            \
+     LAYOUT_DST_ADDR_PRESENT(idx) ? !LAYOUT_IDX_PANID_COMP(idx) :                                  \
+     LAYOUT_IDX_PANID_COMP(idx))
+
+#define LAYOUT_SRC_PANID_PRESENT(idx)                                                              \
+    ((LAYOUT_IDX_VERSION(idx) < (FRAME_VERSION_2 >> 4)) ?                                          \
+     (LAYOUT_SRC_ADDR_PRESENT(idx) && !LAYOUT_IDX_PANID_COMP(idx)) :                               \
+     LAYOUT_BOTH_ADDR_EXTENDED(idx) ? 0 :                                                          \
+     (LAYOUT_SRC_ADDR_PRESENT(idx) && !LAYOUT_IDX_PANID_COMP(idx)))
+
+#define LAYOUT_DST_END(idx)                                                                        \
+    (LAYOUT_DST_PANID_PRESENT(idx) * PAN_ID_SIZE + LAYOUT_ADDR_SIZE(LAYOUT_IDX_DST_MODE(idx)))
+
+#define LAYOUT_END(idx)                                                                            \
+    (LAYOUT_DST_END(idx) + LAYOUT_SRC_PANID_PRESENT(idx) * PAN_ID_SIZE +                           \
+     LAYOUT_ADDR_SIZE(LAYOUT_IDX_SRC_MODE(idx)))
+
+#define LAYOUT_FIELD(idx, present, value)                                                          \
+    ((LAYOUT_IS_VALID(idx) && (present)) ? (value) : NRF_802154_FRAME_INVALID_OFFSET)
+
+#define LAYOUT_ENTRY(idx)                                                                          \
+    {                                                                                              \
+        .dst_panid_offset          = LAYOUT_FIELD(idx, LAYOUT_DST_PANID_PRESENT(idx), 0),          \
+        .dst_addr_offset           = LAYOUT_FIELD(idx,                                             \
+                                                  LAYOUT_DST_ADDR_PRESENT(idx),                    \
+                                                  LAYOUT_DST_PANID_PRESENT(idx) * PAN_ID_SIZE),    \
+        .dst_addr_size             = LAYOUT_FIELD(idx,                                             \
+                                                  1,                                               \
+                                                  LAYOUT_ADDR_SIZE(LAYOUT_IDX_DST_MODE(idx))),     \
+        .dst_addressing_end_offset = LAYOUT_FIELD(idx, 1, LAYOUT_DST_END(idx)),                    \
+        .src_panid_offset          = LAYOUT_FIELD(idx,                                             \
+                                                  LAYOUT_SRC_PANID_PRESENT(idx),                   \
+                                                  LAYOUT_DST_END(idx)),                            \
+        .src_addr_offset           = LAYOUT_FIELD(idx,                                             \
+                                                  LAYOUT_SRC_ADDR_PRESENT(idx),                    \
+                                                  LAYOUT_DST_END(idx) +                            \
+                                                  LAYOUT_SRC_PANID_PRESENT(idx) * PAN_ID_SIZE),    \
+        .src_addr_size             = LAYOUT_FIELD(idx,                                             \
+                                                  1,                                               \
+                                                  LAYOUT_ADDR_SIZE(LAYOUT_IDX_SRC_MODE(idx))),     \
+        .addressing_end_offset     = LAYOUT_FIELD(idx, 1, LAYOUT_END(idx)),                        \
+    }
 
-        case SRC_ADDR_TYPE_NONE:
-            return 0;
+#define LAYOUT_ENTRIES_8(idx)                                                                      \
+    LAYOUT_ENTRY((idx) + 0), LAYOUT_ENTRY((idx) + 1), LAYOUT_ENTRY((idx) + 2),                     \
+    LAYOUT_ENTRY((idx) + 3), LAYOUT_ENTRY((idx) + 4), LAYOUT_ENTRY((idx) + 5),                     \
+    LAYOUT_ENTRY((idx) + 6), LAYOUT_ENTRY((idx) + 7)
 
-        default:
-            return NRF_802154_FRAME_INVALID_OFFSET;
-    }
-}
+#define LAYOUT_ENTRIES_32(idx)                                                                     \
+    LAYOUT_ENTRIES_8((idx) + 0), LAYOUT_ENTRIES_8((idx) + 8),                                      \
+    LAYOUT_ENTRIES_8((idx) + 16), LAYOUT_ENTRIES_8((idx) + 24)
 
-static bool dst_addr_is_present(const nrf_802154_frame_t * p_parser_data)
+static const addressing_layout_t m_addressing_layouts[] =
 {
-    return nrf_802154_frame_dst_addr_type_get(p_parser_data) != DEST_ADDR_TYPE_NONE;
-}
+    LAYOUT_ENTRIES_32(0),
+    LAYOUT_ENTRIES_32(32),
+    LAYOUT_ENTRIES_32(64),
+    LAYOUT_ENTRIES_32(96),
+};
 
-static uint8_t dst_addr_size_get(const nrf_802154_frame_t * p_parser_data)
+static const addressing_layout_t * addressing_layout_get(const nrf_802154_frame_t * p_parser_data)
 {
-    uint8_t addr_type = nrf_802154_frame_dst_addr_type_get(p_parser_data);
+    uint8_t idx = (p_parser_data->p_frame[DEST_ADDR_TYPE_OFFSET] & (DEST_ADDR_TYPE_MASK |
+                                                                     FRAME_VERSION_MASK |
+                                                                     SRC_ADDR_TYPE_MASK)) >> 1;
 
-    switch (addr_type)
+    if (nrf_802154_frame_panid_compression_is_set(p_parser_data))
     {
-        case DEST_ADDR_TYPE_EXTENDED:
-            return EXTENDED_ADDRESS_SIZE;
-
-        case DEST_ADDR_TYPE_SHORT:
-            return SHORT_ADDRESS_SIZE;
-
-        case DEST_ADDR_TYPE_NONE:
-            return 0;
-
-        default:
-            return NRF_802154_FRAME_INVALID_OFFSET;
+        idx |= 0x01;
     }
-}
-
-// PAN ID
-static bool dst_panid_is_present(const nrf_802154_frame_t * p_parser_data)
-{
-    bool panid_compression = nrf_802154_frame_panid_compression_is_set(p_parser_data);
 
-    switch (nrf_802154_frame_version_get(p_parser_data))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!dst_addr_is_present(p_parser_data))
-            {
-                return false;
-            }
-
-            return true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_dst_addr_is_extended(p_parser_data) &&
-                nrf_802154_frame_src_addr_is_extended(p_parser_data))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_parser_data) && dst_addr_is_present(p_parser_data))
-            {
-                return true;
-            }
-
-            if (src_addr_is_present(p_parser_data))
-            {
-                return false;
-            }
-
-            if (dst_addr_is_present(p_parser_data))
-            {
-                return panid_compression ? false : true;
-            }
-
-            return panid_compression ? true : false;
-    }
+    return &m_addressing_layouts[idx];
 }
 
-static bool src_panid_is_present(const nrf_802154_frame_t * p_parser_data)
+static uint8_t layout_offset_get(uint8_t base, uint8_t layout_offset)
 {
-    bool panid_compression = nrf_802154_frame_panid_compression_is_set(p_parser_data);
-
-    switch (nrf_802154_frame_version_get(p_parser_data))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!src_addr_is_present(p_parser_data))
-            {
-                return false;
-            }
-
-            return panid_compression ? false : true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_dst_addr_is_extended(p_parser_data) &&
-                nrf_802154_frame_src_addr_is_extended(p_parser_data))
-            {
-                return false;
-            }
-
-            if (src_addr_is_present(p_parser_data) && dst_addr_is_present(p_parser_data))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_parser_data))
-            {
-                return panid_compression ? false : true;
-            }
-
-            return false;
-    }
+    return (layout_offset == NRF_802154_FRAME_INVALID_OFFSET) ?
+           NRF_802154_FRAME_INVALID_OFFSET : (uint8_t)(base + layout_offset);
 }
 
 // Security
@@ -207,25 +212,20 @@ uint8_t key_source_size_get(uint8_t key_id_mode)
     }
 }
 
-static uint8_t mic_size_get(const nrf_802154_frame_t * p_parser_data)
+static const uint8_t m_mic_sizes[SECURITY_LEVEL_MASK + 1] =
 {
-    switch (nrf_802154_frame_sec_ctrl_sec_lvl_get(p_parser_data))
-    {
-        case SECURITY_LEVEL_MIC_32:
-        case SECURITY_LEVEL_ENC_MIC_32:
-            return MIC_32_SIZE;
-
-        case SECURITY_LEVEL_MIC_64:
-        case SECURITY_LEVEL_ENC_MIC_64:
-            return MIC_64_SIZE;
-
-        case SECURITY_LEVEL_MIC_128:
-        case SECURITY_LEVEL_ENC_MIC_128:
-            return MIC_128_SIZE;
+    [SECURITY_LEVEL_NONE]        = 0,
+    [SECURITY_LEVEL_MIC_32]      = MIC_32_SIZE,
+    [SECURITY_LEVEL_MIC_64]      = MIC_64_SIZE,
+    [SECURITY_LEVEL_MIC_128]     = MIC_128_SIZE,
+    [SECURITY_LEVEL_ENC_MIC_32]  = MIC_32_SIZE,
+    [SECURITY_LEVEL_ENC_MIC_64]  = MIC_64_SIZE,
+    [SECURITY_LEVEL_ENC_MIC_128] = MIC_128_SIZE,
+};
 
-        default:
-            return 0;
-    }
+static uint8_t mic_size_get(const nrf_802154_frame_t * p_parser_data)
+{
+    return m_mic_sizes[nrf_802154_frame_sec_ctrl_sec_lvl_get(p_parser_data) & SECURITY_LEVEL_MASK];
 }
 
 /***************************************************************************************************
@@ -234,8 +234,8 @@ static uint8_t mic_size_get(const nrf_802154_frame_t * p_parser_data)
 
 static bool fcf_parse(nrf_802154_frame_t * p_parser_data)
 {
-    uint8_t offset = PHR_SIZE + FCF_SIZE;
-    uint8_t addr_size;
+    uint8_t                     offset = PHR_SIZE + FCF_SIZE;
+    const addressing_layout_t * p_layout;
 
     if (offset > p_parser_data->valid_data_len)
     {
@@ -249,55 +249,29 @@ static bool fcf_parse(nrf_802154_frame_t * p_parser_data)
         return true;
     }
 
-    if (nrf_802154_frame_dsn_suppress_bit_is_set(p_parser_data) == false)
-    {
-        offset += DSN_SIZE;
-    }
-
-    if (dst_panid_is_present(p_parser_data))
-    {
-        p_parser_data->mhr.dst.panid_offset = offset;
-        offset                             += PAN_ID_SIZE;
-    }
-
-    if (dst_addr_is_present(p_parser_data))
-    {
-        p_parser_data->mhr.dst.addr_offset = offset;
-    }
-
-    addr_size = dst_addr_size_get(p_parser_data);
+    p_layout = addressing_layout_get(p_parser_data);
 
-    if (addr_size == NRF_802154_FRAME_INVALID_OFFSET)
+    if ((p_layout->dst_addr_size == NRF_802154_FRAME_INVALID_OFFSET) ||
+        (p_layout->src_addr_size == NRF_802154_FRAME_INVALID_OFFSET))
     {
+        // Reserved addressing mode
         return false;
     }
 
-    p_parser_data->helper.dst_addr_size             = addr_size;
-    offset                                         += addr_size;
-    p_parser_data->helper.dst_addressing_end_offset = offset;
-
-    if (src_panid_is_present(p_parser_data))
-    {
-        p_parser_data->mhr.src.panid_offset = offset;
-        offset                             += PAN_ID_SIZE;
-    }
-
-    if (src_addr_is_present(p_parser_data))
-    {
-        p_parser_data->mhr.src.addr_offset = offset;
-    }
-
-    addr_size = src_addr_size_get(p_parser_data);
-
-    if (addr_size == NRF_802154_FRAME_INVALID_OFFSET)
+    if (nrf_802154_frame_dsn_suppress_bit_is_set(p_parser_data) == false)
     {
-        return false;
+        offset += DSN_SIZE;
     }
 
-    p_parser_data->helper.src_addr_size = addr_size;
-    offset                             += addr_size;
+    p_parser_data->mhr.dst.panid_offset = layout_offset_get(offset, p_layout->dst_panid_offset);
+    p_parser_data->mhr.dst.addr_offset  = layout_offset_get(offset, p_layout->dst_addr_offset);
+    p_parser_data->mhr.src.panid_offset = layout_offset_get(offset, p_layout->src_panid_offset);
+    p_parser_data->mhr.src.addr_offset  = layout_offset_get(offset, p_layout->src_addr_offset);
 
-    p_parser_data->helper.addressing_end_offset = offset;
+    p_parser_data->helper.dst_addr_size             = p_layout->dst_addr_size;
+    p_parser_data->helper.src_addr_size             = p_layout->src_addr_size;
+    p_parser_data->helper.dst_addressing_end_offset = offset + p_layout->dst_addressing_end_offset;
+    p_parser_data->helper.addressing_end_offset     = offset + p_layout->addressing_end_offset;
 
     return true;
 }
@@ -384,7 +358,7 @@ static bool full_parse(nrf_802154_frame_t * p_parser_data)
         p_parser_data->mhr.header_ie_offset = offset;
 
         p_ie_header = &p_parser_data->p_frame[offset];
-        p_end_addr  = nrf_802154_frame_mfr_get(p_parser_data) - mic_size_get(p_parser_data);
+        p_end_addr  = nrf_802154_frame_mfr_get(p_parser_data) - p_parser_data->helper.mic_size;
         p_iterator  = nrf_802154_frame_header_ie_iterator_begin(p_ie_header);
 
         while (!nrf_802154_frame_ie_iterator_end(p_iterator, p_end_addr))
@@ -67,6 +67,22 @@ typedef enum
 
 static writer_state_t m_writer_state = IE_WRITER_RESET; ///< IE writer state
 
+/**
+ * @brief Gets the offset of an Information Element field from the beginning of header IEs.
+ */
+static uint8_t field_offset_get(const uint8_t * p_ie_header, const uint8_t * p_field)
+{
+    return (uint8_t)(p_field - p_ie_header);
+}
+
+/**
+ * @brief Gets the address of an Information Element field described by its offset.
+ */
+static uint8_t * field_addr_get(uint8_t * p_ie_header, uint8_t offset)
+{
+    return (offset == NRF_802154_IE_WRITER_FIELD_NONE) ? NULL : (p_ie_header + offset);
+}
+
 #if NRF_802154_DELAYED_TRX_ENABLED
 
 static uint8_t * mp_csl_phase_addr;     ///< Cached CSL information element phase field address
@@ -211,14 +227,18 @@ static void csl_ie_write_commit(bool * p_written)
 }
 
 /**
- * @brief Finds and prepare memory address where CSL phase will be written.
+ * @brief Finds the offset of the CSL phase field.
  *
- * @param[in]  p_iterator  Information Element parser iterator.
+ * @param[in]   p_iterator   Information Element parser iterator.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[out]  p_layout     Layout to store the offset in.
  *
  * @retval  true  The write prepare operation to CSL IE was successful.
  * @retval  false An improperly formatted CSL IE was detected.
  */
-static bool csl_ie_write_prepare(const uint8_t * p_iterator)
+static bool csl_ie_write_prepare(const uint8_t                 * p_iterator,
+                                 const uint8_t                 * p_ie_header,
+                                 nrf_802154_ie_writer_layout_t * p_layout)
 {
     NRF_802154_ASSERT(p_iterator != NULL);
 
@@ -228,12 +248,24 @@ static bool csl_ie_write_prepare(const uint8_t * p_iterator)
         return false;
     }
 
-    mp_csl_phase_addr  = (uint8_t *)nrf_802154_frame_ie_content_address_get(p_iterator);
-    mp_csl_period_addr = mp_csl_phase_addr + sizeof(uint16_t);
+    p_layout->csl_phase = field_offset_get(p_ie_header,
+                                           nrf_802154_frame_ie_content_address_get(p_iterator));
 
     return true;
 }
 
+/**
+ * @brief Latches memory addresses where CSL phase and period will be written.
+ *
+ * @param[in]  p_ie_header  Pointer to the beginning of header IEs.
+ * @param[in]  p_layout     Layout of the header IEs.
+ */
+static void csl_ie_write_arm(uint8_t * p_ie_header, const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    mp_csl_phase_addr  = field_addr_get(p_ie_header, p_layout->csl_phase);
+    mp_csl_period_addr = (mp_csl_phase_addr != NULL) ? (mp_csl_phase_addr + sizeof(uint16_t)) : NULL;
+}
+
 /**
  * @brief Resets CSL writer to pristine state.
  */
@@ -279,14 +311,18 @@ static void cst_ie_write_commit(bool * p_written)
 }
 
 /**
- * @brief Finds and prepare memory address where CST phase will be written.
+ * @brief Finds the offset of the CST phase field.
  *
- * @param[in]  p_iterator  Information Element parser iterator.
+ * @param[in]   p_iterator   Information Element parser iterator.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[out]  p_layout     Layout to store the offset in.
  *
  * @retval  true  The write prepare operation to CST IE was successful.
  * @retval  false An improperly formatted CST IE was detected.
  */
-static bool cst_ie_write_prepare(const uint8_t * p_iterator)
+static bool cst_ie_write_prepare(const uint8_t                 * p_iterator,
+                                 const uint8_t                 * p_ie_header,
+                                 nrf_802154_ie_writer_layout_t * p_layout)
 {
     NRF_802154_ASSERT(p_iterator != NULL);
 
@@ -296,13 +332,25 @@ static bool cst_ie_write_prepare(const uint8_t * p_iterator)
         return false;
     }
 
-    mp_cst_phase_addr = (uint8_t *)nrf_802154_frame_ie_vendor_thread_data_addr_get(
-        p_iterator);
-    mp_cst_period_addr = mp_cst_phase_addr + sizeof(uint16_t);
+    p_layout->cst_phase = field_offset_get(
+        p_ie_header,
+        nrf_802154_frame_ie_vendor_thread_data_addr_get(p_iterator));
 
     return true;
 }
 
+/**
+ * @brief Latches memory addresses where CST phase and period will be written.
+ *
+ * @param[in]  p_ie_header  Pointer to the beginning of header IEs.
+ * @param[in]  p_layout     Layout of the header IEs.
+ */
+static void cst_ie_write_arm(uint8_t * p_ie_header, const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    mp_cst_phase_addr  = field_addr_get(p_ie_header, p_layout->cst_phase);
+    mp_cst_period_addr = (mp_cst_phase_addr != NULL) ? (mp_cst_phase_addr + sizeof(uint16_t)) : NULL;
+}
+
 /**
  * @brief Resets CST writer to pristine state.
  */
@@ -324,19 +372,31 @@ static void csl_ie_write_commit(bool * p_written)
 }
 
 /**
- * @brief Finds and prepare memory address where CSL phase will be written.
+ * @brief Finds the offset of the CSL phase field.
  *
- * @param[in]  p_iterator  Information Element parser iterator.
+ * @param[in]   p_iterator   Information Element parser iterator.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[out]  p_layout     Layout to store the offset in.
  *
  * @retval  true  The write prepare operation to CSL IE was successful.
  * @retval  false An improperly formatted CSL IE was detected.
  */
-static bool csl_ie_write_prepare(const uint8_t * p_iterator)
+static bool csl_ie_write_prepare(const uint8_t                 * p_iterator,
+                                 const uint8_t                 * p_ie_header,
+                                 nrf_802154_ie_writer_layout_t * p_layout)
 {
     // Intentionally empty
     return true;
 }
 
+/**
+ * @brief Latches memory addresses where CSL phase and period will be written.
+ */
+static void csl_ie_write_arm(uint8_t * p_ie_header, const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    // Intentionally empty
+}
+
 /**
  * @brief Resets CSL writer to pristine state.
  */
@@ -358,19 +418,31 @@ static void cst_ie_write_commit(bool * p_written)
 }
 
 /**
- * @brief Finds and prepare memory address where CST phase will be written.
+ * @brief Finds the offset of the CST phase field.
  *
- * @param[in]  p_iterator  Information Element parser iterator.
+ * @param[in]   p_iterator   Information Element parser iterator.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[out]  p_layout     Layout to store the offset in.
  *
  * @retval  true  The write prepare operation to CST IE was successful.
  * @retval  false An improperly formatted CST IE was detected.
  */
-static bool cst_ie_write_prepare(const uint8_t * p_iterator)
+static bool cst_ie_write_prepare(const uint8_t                 * p_iterator,
+                                 const uint8_t                 * p_ie_header,
+                                 nrf_802154_ie_writer_layout_t * p_layout)
 {
     // Intentionally empty
     return true;
 }
 
+/**
+ * @brief Latches memory addresses where CST phase and period will be written.
+ */
+static void cst_ie_write_arm(uint8_t * p_ie_header, const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    // Intentionally empty
+}
+
 /**
  * @brief Resets CST writer to pristine state.
  */
@@ -457,21 +529,25 @@ static void link_metrics_ie_write_commit(bool * p_written)
 }
 
 /**
- * @brief Finds and prepare memory addresses where link metrics will be written.
+ * @brief Finds the offsets of the link metrics fields.
  *
- * @param[in]  p_iterator  Information Element parser iterator.
+ * @param[in]   p_iterator   Information Element parser iterator.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[out]  p_layout     Layout to store the offsets in.
  *
  * @retval  true  The write prepare operation for link metrics was successful.
  * @retval  false An improperly formatted link metrics IE was detected.
  */
-static bool link_metrics_ie_write_prepare(const uint8_t * p_iterator)
+static bool link_metrics_ie_write_prepare(const uint8_t                 * p_iterator,
+                                          const uint8_t                 * p_ie_header,
+                                          nrf_802154_ie_writer_layout_t * p_layout)
 {
     NRF_802154_ASSERT(p_iterator != NULL);
 
     // Initialize the iterator at the start of IE content
-    uint8_t * p_content_iterator =
-        (uint8_t *)nrf_802154_frame_ie_vendor_thread_data_addr_get(p_iterator);
-    uint8_t * ie_end = (uint8_t *)nrf_802154_frame_ie_iterator_next(p_iterator);
+    const uint8_t * p_content_iterator = nrf_802154_frame_ie_vendor_thread_data_addr_get(
+        p_iterator);
+    const uint8_t * ie_end = nrf_802154_frame_ie_iterator_next(p_iterator);
 
     if (nrf_802154_frame_ie_length_get(p_iterator) < IE_VENDOR_THREAD_ACK_SIZE_MIN ||
         nrf_802154_frame_ie_length_get(p_iterator) > IE_VENDOR_THREAD_ACK_SIZE_MAX)
@@ -484,27 +560,27 @@ static bool link_metrics_ie_write_prepare(const uint8_t * p_iterator)
         switch (*p_content_iterator)
         {
             case IE_VENDOR_THREAD_RSSI_TOKEN:
-                if (mp_lm_rssi_addr != NULL)
+                if (p_layout->lm_rssi != NRF_802154_IE_WRITER_FIELD_NONE)
                 {
                     return false;
                 }
-                mp_lm_rssi_addr = p_content_iterator;
+                p_layout->lm_rssi = field_offset_get(p_ie_header, p_content_iterator);
                 break;
 
             case IE_VENDOR_THREAD_MARGIN_TOKEN:
-                if (mp_lm_margin_addr != NULL)
+                if (p_layout->lm_margin != NRF_802154_IE_WRITER_FIELD_NONE)
                 {
                     return false;
                 }
-                mp_lm_margin_addr = p_content_iterator;
+                p_layout->lm_margin = field_offset_get(p_ie_header, p_content_iterator);
                 break;
 
             case IE_VENDOR_THREAD_LQI_TOKEN:
-                if (mp_lm_lqi_addr != NULL)
+                if (p_layout->lm_lqi != NRF_802154_IE_WRITER_FIELD_NONE)
                 {
                     return false;
                 }
-                mp_lm_lqi_addr = p_content_iterator;
+                p_layout->lm_lqi = field_offset_get(p_ie_header, p_content_iterator);
                 break;
 
             default:
@@ -517,6 +593,20 @@ static bool link_metrics_ie_write_prepare(const uint8_t * p_iterator)
     return true;
 }
 
+/**
+ * @brief Latches memory addresses where link metrics will be written.
+ *
+ * @param[in]  p_ie_header  Pointer to the beginning of header IEs.
+ * @param[in]  p_layout     Layout of the header IEs.
+ */
+static void link_metrics_ie_write_arm(uint8_t                             * p_ie_header,
+                                      const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    mp_lm_rssi_addr   = field_addr_get(p_ie_header, p_layout->lm_rssi);
+    mp_lm_margin_addr = field_addr_get(p_ie_header, p_layout->lm_margin);
+    mp_lm_lqi_addr    = field_addr_get(p_ie_header, p_layout->lm_lqi);
+}
+
 /**
  * @brief Resets the prepared addresses for injecting link metrics into a frame.
  */
@@ -528,25 +618,27 @@ static void link_metrics_ie_write_reset(void)
 }
 
 /**
- * @brief Performs IE write preparations.
+ * @brief Finds the layout of all recognized information elements.
  *
- * This function prepares the write operation for all recognized information elements and
- * sets the state to IE_WRITER_PREPARE.
+ * This function does not modify the state of the module.
  *
  * If any of the information elements fails the boundary check or is not properly formatted,
- * the writer state shall be set to IE_WRITER_RESET.
+ * the layout shall be marked as invalid.
  *
- * @param[in]  p_ie_header  Pointer to the beginning of header IEs.
- * @param[in]  p_end_addr   Pointer to the first invalid address after p_ie_header.
+ * @param[in]   p_ie_header  Pointer to the beginning of header IEs.
+ * @param[in]   p_end_addr   Pointer to the first invalid address after p_ie_header.
+ * @param[out]  p_layout     Layout of the header IEs.
  */
-static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
+static void ie_writer_layout_get(const uint8_t                 * p_ie_header,
+                                 const uint8_t                 * p_end_addr,
+                                 nrf_802154_ie_writer_layout_t * p_layout)
 {
-    NRF_802154_ASSERT(m_writer_state == IE_WRITER_RESET);
-    m_writer_state = IE_WRITER_PREPARE;
-
     const uint8_t * p_iterator = nrf_802154_frame_header_ie_iterator_begin(p_ie_header);
     bool            result     = true;
 
+    *p_layout       = (nrf_802154_ie_writer_layout_t){0};
+    p_layout->valid = true;
+
     while (nrf_802154_frame_ie_iterator_end(p_iterator, p_end_addr) == false)
     {
         switch (nrf_802154_frame_ie_id_get(p_iterator))
@@ -559,11 +651,13 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
                     switch (nrf_802154_frame_ie_vendor_thread_subtype_get(p_iterator))
                     {
                         case IE_VENDOR_THREAD_ACK_PROBING_ID:
-                            result = link_metrics_ie_write_prepare(p_iterator);
+                            result = link_metrics_ie_write_prepare(p_iterator,
+                                                                   p_ie_header,
+                                                                   p_layout);
                             break;
 
                         case IE_VENDOR_THREAD_CST_ID:
-                            result = cst_ie_write_prepare(p_iterator);
+                            result = cst_ie_write_prepare(p_iterator, p_ie_header, p_layout);
                             break;
 
                         default:
@@ -573,7 +667,7 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
                 break;
 
             case IE_CSL_ID:
-                result = csl_ie_write_prepare(p_iterator);
+                result = csl_ie_write_prepare(p_iterator, p_ie_header, p_layout);
                 break;
 
             default:
@@ -582,7 +676,7 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
 
         if (result == false)
         {
-            nrf_802154_ie_writer_reset();
+            p_layout->valid = false;
             return;
         }
 
@@ -590,6 +684,33 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
     }
 }
 
+/**
+ * @brief Performs IE write preparations.
+ *
+ * This function latches the addresses of all recognized information elements and
+ * sets the state to IE_WRITER_PREPARE.
+ *
+ * If the layout is invalid, the writer state shall remain IE_WRITER_RESET.
+ *
+ * @param[in]  p_ie_header  Pointer to the beginning of header IEs.
+ * @param[in]  p_layout     Layout of the header IEs.
+ */
+static void ie_writer_arm(uint8_t * p_ie_header, const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    NRF_802154_ASSERT(m_writer_state == IE_WRITER_RESET);
+
+    if (!p_layout->valid)
+    {
+        return;
+    }
+
+    m_writer_state = IE_WRITER_PREPARE;
+
+    csl_ie_write_arm(p_ie_header, p_layout);
+    cst_ie_write_arm(p_ie_header, p_layout);
+    link_metrics_ie_write_arm(p_ie_header, p_layout);
+}
+
 /**
  * @brief Commits data to recognized information elements.
  *
@@ -616,11 +737,32 @@ void nrf_802154_ie_writer_reset(void)
 }
 
 void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
+{
+    nrf_802154_ie_writer_layout_t layout;
+
+    NRF_802154_ASSERT(p_ie_header != NULL);
+    NRF_802154_ASSERT(p_ie_header < p_end_addr);
+
+    ie_writer_layout_get(p_ie_header, p_end_addr, &layout);
+    ie_writer_arm(p_ie_header, &layout);
+}
+
+void nrf_802154_ie_writer_layout_get(const uint8_t                 * p_ie_header,
+                                     const uint8_t                 * p_end_addr,
+                                     nrf_802154_ie_writer_layout_t * p_layout)
 {
     NRF_802154_ASSERT(p_ie_header != NULL);
     NRF_802154_ASSERT(p_ie_header < p_end_addr);
 
-    ie_writer_prepare(p_ie_header, p_end_addr);
+    ie_writer_layout_get(p_ie_header, p_end_addr, p_layout);
+}
+
+void nrf_802154_ie_writer_layout_prepare(uint8_t                             * p_ie_header,
+                                         const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    NRF_802154_ASSERT(p_ie_header != NULL);
+
+    ie_writer_arm(p_ie_header, p_layout);
 }
 
 nrf_802154_tx_error_t nrf_802154_ie_writer_tx_setup(
@@ -47,6 +47,24 @@
  * @brief Information element writer module.
  */
 
+/** @brief Offset value indicating that a field is not present in the header IEs. */
+#define NRF_802154_IE_WRITER_FIELD_NONE 0U
+
+/**
+ * @brief Layout of the header IE fields written by the IE writer module.
+ *
+ * The offsets are counted from the beginning of the header IEs.
+ */
+typedef struct
+{
+    uint8_t csl_phase; ///< Offset of the CSL phase field, followed by the CSL period field.
+    uint8_t cst_phase; ///< Offset of the CST phase field, followed by the CST period field.
+    uint8_t lm_rssi;   ///< Offset of the link metrics RSSI field.
+    uint8_t lm_margin; ///< Offset of the link metrics link margin field.
+    uint8_t lm_lqi;    ///< Offset of the link metrics LQI field.
+    bool    valid;     ///< False if a malformed header IE was detected.
+} nrf_802154_ie_writer_layout_t;
+
 /**
  * @brief Resets the IE writer module to pristine state.
  */
@@ -75,6 +93,35 @@ void nrf_802154_ie_writer_reset(void);
  */
 void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr);
 
+/**
+ * @brief Finds the layout of the header IEs recognized by the module.
+ *
+ * This function parses the header IEs in the same way as @ref nrf_802154_ie_writer_prepare,
+ * but it stores the offsets of recognized Information Element values instead of arming the module.
+ * The state of the module is not modified, so the function can be called from any context to
+ * parse header IEs in advance.
+ *
+ * @param[in]   p_ie_header  Address of the IE header.
+ * @param[in]   p_end_addr   First invalid address after p_ie_header.
+ * @param[out]  p_layout     Layout of the header IEs.
+ */
+void nrf_802154_ie_writer_layout_get(const uint8_t                 * p_ie_header,
+                                     const uint8_t                 * p_end_addr,
+                                     nrf_802154_ie_writer_layout_t * p_layout);
+
+/**
+ * @brief Prepares to write Information Element data using a layout found in advance.
+ *
+ * This function is equivalent to @ref nrf_802154_ie_writer_prepare, but it does not parse
+ * the header IEs. The header IEs at @p p_ie_header must be a copy of the header IEs
+ * that @p p_layout was obtained for with @ref nrf_802154_ie_writer_layout_get.
+ *
+ * @param[in]  p_ie_header  Address of the IE header.
+ * @param[in]  p_layout     Layout of the header IEs.
+ */
+void nrf_802154_ie_writer_layout_prepare(uint8_t                             * p_ie_header,
+                                         const nrf_802154_ie_writer_layout_t * p_layout);
+
 /**
  * @brief Transmission setup hook for the IE writer module.
  *
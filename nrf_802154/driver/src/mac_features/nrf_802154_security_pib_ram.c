@@ -36,12 +36,23 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_hmap.h"
 #include "nrf_802154_sl_atomics.h"
 
 #include <string.h>
 #include <stdbool.h>
 #include "nrf_802154_assert.h"
 
+/** Size of the key index key: the key identifier mode followed by the key identifier. */
+#define KEY_INDEX_KEY_SIZE         (1U + KEY_ID_MODE_3_SIZE)
+
+/** Smallest key storage in which keys are looked up with the key index. Smaller storages are
+ *  scanned, which is faster than hashing the key identifier.
+ */
+#define KEY_INDEX_MIN_STORAGE_SIZE 8U
+
+#define KEY_INDEX_ENABLED          (NRF_802154_SECURITY_KEY_STORAGE_SIZE >= KEY_INDEX_MIN_STORAGE_SIZE)
+
 typedef struct
 {
     uint8_t                  key[AES_CCM_KEY_SIZE];
@@ -55,6 +66,20 @@ typedef struct
 static table_entry_t m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
 static uint32_t      m_global_frame_counter;
 
+#if KEY_INDEX_ENABLED
+
+/* Index mapping the key identifier mode and the key identifier to the position of the key
+ * in m_key_storage, so that keys are found in constant time.
+ */
+static nrf_802154_hmap_t m_key_index;
+static uint16_t          m_key_index_mem[(NRF_802154_HMAP_MEMORY_SIZE(
+                                              KEY_INDEX_KEY_SIZE,
+                                              sizeof(uint16_t),
+                                              NRF_802154_SECURITY_KEY_STORAGE_SIZE) +
+                                          sizeof(uint16_t) - 1U) / sizeof(uint16_t)];
+
+#endif /* KEY_INDEX_ENABLED */
+
 static bool mode_is_valid(nrf_802154_key_id_mode_t mode)
 {
     switch (mode)
@@ -88,52 +113,105 @@ static int id_length_get(nrf_802154_key_id_mode_t mode)
     }
 }
 
-static bool key_matches(table_entry_t * p_key, nrf_802154_key_id_t * p_id)
+/**
+ * @brief Prepare the key of the key index for the given key identifier.
+ *
+ * @param[in]  p_id         Key identifier.
+ * @param[out] p_index_key  Buffer of @ref KEY_INDEX_KEY_SIZE bytes to be filled.
+ *
+ * @retval true   The key of the key index is prepared.
+ * @retval false  The key identifier cannot match any stored key.
+ */
+static bool key_index_key_make(const nrf_802154_key_id_t * p_id, uint8_t * p_index_key)
 {
-    if (!p_key->taken)
-    {
-        return false;
-    }
+    int id_length = id_length_get(p_id->mode);
 
-    if (p_key->mode != p_id->mode)
+    if (!mode_is_valid(p_id->mode) || ((id_length != 0) && (p_id->p_key_id == NULL)))
     {
         return false;
     }
 
-    if (p_id->mode == KEY_ID_MODE_0)
+    memset(p_index_key, 0, KEY_INDEX_KEY_SIZE);
+    p_index_key[0] = (uint8_t)p_id->mode;
+
+    if (id_length != 0)
     {
-        return true;
+        memcpy(&p_index_key[1], p_id->p_key_id, id_length);
     }
-    else if ((p_id->p_key_id == NULL) ||
-             (memcmp(p_id->p_key_id, p_key->id, id_length_get(p_id->mode)) != 0))
+
+    return true;
+}
+
+/**
+ * @brief Find the storage entry of the key with the given key index key.
+ *
+ * @param[in]  p_index_key  Key index key prepared by @ref key_index_key_make.
+ *
+ * @returns  Pointer to the storage entry, or NULL if there is no such key.
+ */
+static table_entry_t * key_entry_find(const uint8_t * p_index_key)
+{
+#if KEY_INDEX_ENABLED
+    uint16_t index;
+
+    if (!nrf_802154_hmap_rec_get(&m_key_index, p_index_key, &index))
     {
-        return false;
+        return NULL;
     }
-    else
+
+    return &m_key_storage[index];
+#else /* KEY_INDEX_ENABLED */
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
-        return true;
+        table_entry_t * p_entry = &m_key_storage[i];
+
+        if (p_entry->taken &&
+            ((uint8_t)p_entry->mode == p_index_key[0]) &&
+            (memcmp(p_entry->id, &p_index_key[1], sizeof(p_entry->id)) == 0))
+        {
+            return p_entry;
+        }
     }
+
+    return NULL;
+#endif /* KEY_INDEX_ENABLED */
 }
 
-static bool key_is_present(nrf_802154_key_id_t * p_id)
+static table_entry_t * key_find(const nrf_802154_key_id_t * p_id)
 {
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    uint8_t index_key[KEY_INDEX_KEY_SIZE];
+
+    if (!key_index_key_make(p_id, index_key))
     {
-        if (key_matches(&m_key_storage[i], p_id))
-        {
-            return true;
-        }
+        return NULL;
     }
 
-    return false;
+    return key_entry_find(index_key);
 }
 
-nrf_802154_security_error_t nrf_802154_security_pib_init(void)
+static void key_storage_clear(void)
 {
+#if KEY_INDEX_ENABLED
+    nrf_802154_hmap_clear(&m_key_index);
+#endif /* KEY_INDEX_ENABLED */
+
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
         m_key_storage[i].taken = false;
     }
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_init(void)
+{
+#if KEY_INDEX_ENABLED
+    nrf_802154_hmap_init(&m_key_index,
+                         KEY_INDEX_KEY_SIZE,
+                         sizeof(uint16_t),
+                         NRF_802154_SECURITY_KEY_STORAGE_SIZE,
+                         m_key_index_mem);
+#endif /* KEY_INDEX_ENABLED */
+
+    key_storage_clear();
 
     return NRF_802154_SECURITY_ERROR_NONE;
 }
@@ -147,22 +225,24 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
 {
     NRF_802154_ASSERT(p_key != NULL);
 
+    uint8_t index_key[KEY_INDEX_KEY_SIZE];
+
     if (p_key->type != NRF_802154_KEY_CLEARTEXT)
     {
         return NRF_802154_SECURITY_ERROR_TYPE_NOT_SUPPORTED;
     }
 
-    if (!mode_is_valid(p_key->id.mode))
+    if (!key_index_key_make(&p_key->id, index_key))
     {
         return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
     }
 
-    if (key_is_present(&p_key->id))
+    if (key_entry_find(index_key) != NULL)
     {
         return NRF_802154_SECURITY_ERROR_ALREADY_PRESENT;
     }
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    for (uint16_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
         if (m_key_storage[i].taken == false)
         {
@@ -170,13 +250,25 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
                    p_key->value.p_cleartext_key,
                    sizeof(m_key_storage[i].key));
             m_key_storage[i].mode = p_key->id.mode;
-            memcpy(m_key_storage[i].id, p_key->id.p_key_id, id_length_get(p_key->id.mode));
+            memcpy(m_key_storage[i].id, &index_key[1], sizeof(m_key_storage[i].id));
             m_key_storage[i].frame_counter            = p_key->frame_counter;
             m_key_storage[i].use_global_frame_counter = p_key->use_global_frame_counter;
 
+#if KEY_INDEX_ENABLED
+            m_key_storage[i].taken = true;
+
+            /* The index publishes the entry only after it is completely written. */
+            if (!nrf_802154_hmap_rec_write(&m_key_index, index_key, &i))
+            {
+                m_key_storage[i].taken = false;
+                break;
+            }
+#else /* KEY_INDEX_ENABLED */
             __DMB();
 
             m_key_storage[i].taken = true;
+#endif /* KEY_INDEX_ENABLED */
+
             return NRF_802154_SECURITY_ERROR_NONE;
         }
     }
@@ -188,24 +280,32 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id
 {
     NRF_802154_ASSERT(p_id != NULL);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    uint8_t         index_key[KEY_INDEX_KEY_SIZE];
+    table_entry_t * p_entry;
+
+    if (!key_index_key_make(p_id, index_key))
     {
-        if (key_matches(&m_key_storage[i], p_id))
-        {
-            m_key_storage[i].taken = false;
-            return NRF_802154_SECURITY_ERROR_NONE;
-        }
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    p_entry = key_entry_find(index_key);
+
+    if (p_entry == NULL)
+    {
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
 
-    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+#if KEY_INDEX_ENABLED
+    (void)nrf_802154_hmap_rec_delete(&m_key_index, index_key);
+#endif /* KEY_INDEX_ENABLED */
+    p_entry->taken = false;
+
+    return NRF_802154_SECURITY_ERROR_NONE;
 }
 
 void nrf_802154_security_pib_key_remove_all(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
-    {
-        m_key_storage[i].taken = false;
-    }
+    key_storage_clear();
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t * p_id,
@@ -214,16 +314,16 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t
     NRF_802154_ASSERT(destination != NULL);
     NRF_802154_ASSERT(p_id != NULL);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    const table_entry_t * p_entry = key_find(p_id);
+
+    if (p_entry == NULL)
     {
-        if (key_matches(&m_key_storage[i], p_id))
-        {
-            memcpy((uint8_t *)destination, m_key_storage[i].key, sizeof(m_key_storage[i].key));
-            return NRF_802154_SECURITY_ERROR_NONE;
-        }
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
 
-    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    memcpy((uint8_t *)destination, p_entry->key, sizeof(p_entry->key));
+
+    return NRF_802154_SECURITY_ERROR_NONE;
 }
 
 void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
@@ -248,6 +348,36 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
     while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, frame_counter));
 }
 
+/**
+ * @brief Atomically take the current value of a frame counter and increment it.
+ *
+ * @param[inout] p_counter  Frame counter to take the value from.
+ * @param[out]   p_value    Taken value of the frame counter.
+ *
+ * @retval true   The value is taken.
+ * @retval false  The frame counter is exhausted.
+ */
+static bool frame_counter_take(uint32_t * p_counter, uint32_t * p_value)
+{
+    uint32_t fc;
+
+    do
+    {
+        fc = __LDREXW(p_counter);
+
+        if (fc == UINT32_MAX)
+        {
+            __CLREX();
+            return false;
+        }
+    }
+    while (__STREXW(fc + 1, p_counter));
+
+    *p_value = fc;
+
+    return true;
+}
+
 nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
     uint32_t            * p_frame_counter,
     nrf_802154_key_id_t * p_id)
@@ -255,44 +385,28 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
     NRF_802154_ASSERT(p_frame_counter != NULL);
     NRF_802154_ASSERT(p_id != NULL);
 
-    uint32_t * p_frame_counter_to_use = NULL;
-    uint32_t   fc;
+    table_entry_t * p_entry = key_find(p_id);
+    uint32_t      * p_frame_counter_to_use;
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
-    {
-        if (key_matches(&m_key_storage[i], p_id))
-        {
-            if (m_key_storage[i].use_global_frame_counter)
-            {
-                p_frame_counter_to_use = &m_global_frame_counter;
-            }
-            else
-            {
-                p_frame_counter_to_use = &m_key_storage[i].frame_counter;
-            }
-            break;
-        }
-    }
-
-    if (p_frame_counter_to_use == NULL)
+    if (p_entry == NULL)
     {
         /* No proper key found. */
         return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
 
-    do
+    if (p_entry->use_global_frame_counter)
     {
-        fc = __LDREXW(p_frame_counter_to_use);
-
-        if (fc == UINT32_MAX)
-        {
-            __CLREX();
-            return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
-        }
+        p_frame_counter_to_use = &m_global_frame_counter;
+    }
+    else
+    {
+        p_frame_counter_to_use = &p_entry->frame_counter;
     }
-    while (__STREXW(fc + 1, p_frame_counter_to_use));
 
-    *p_frame_counter = *p_frame_counter_to_use - 1;
+    if (!frame_counter_take(p_frame_counter_to_use, p_frame_counter))
+    {
+        return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
+    }
 
     return NRF_802154_SECURITY_ERROR_NONE;
 }
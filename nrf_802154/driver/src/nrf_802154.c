@@ -724,11 +724,18 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
     NRF_802154_ASSERT(p_buffer->free == false);
-    (void)p_buffer;
 
-    result = nrf_802154_request_buffer_free(p_data);
-    NRF_802154_ASSERT(result);
-    (void)result;
+    nrf_802154_rx_buffer_release(p_buffer);
+
+    /* Make the released buffer visible to the core before checking if it awaits one. */
+    __DMB();
+
+    if (nrf_802154_core_rx_buffer_is_awaited())
+    {
+        result = nrf_802154_request_buffer_free(p_data);
+        NRF_802154_ASSERT(result);
+        (void)result;
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -821,6 +828,22 @@ void nrf_802154_ack_data_remove_all(bool extended, nrf_802154_ack_data_t data_ty
     nrf_802154_ack_data_reset(extended, data_type);
 }
 
+size_t nrf_802154_ack_data_memory_size_get(bool extended, uint16_t num_addresses)
+{
+    return nrf_802154_ack_data_peer_table_memory_size_get(extended, num_addresses);
+}
+
+bool nrf_802154_ack_data_memory_set(bool     extended,
+                                    void   * p_memory,
+                                    size_t   memory_size,
+                                    uint16_t num_addresses)
+{
+    return nrf_802154_ack_data_peer_table_memory_set(extended,
+                                                     p_memory,
+                                                     memory_size,
+                                                     num_addresses);
+}
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ack_data_enable(enabled);
@@ -1126,6 +1149,42 @@ __WEAK void nrf_802154_transmit_failed(uint8_t
     (void)p_metadata;
 }
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+
+__WEAK void nrf_802154_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const nrf_802154_batch_ntf_t * p_ntf = &p_ntfs[i];
+
+        switch (p_ntf->type)
+        {
+            case NRF_802154_BATCH_NTF_RECEIVED:
+                nrf_802154_received_timestamp_raw(p_ntf->data.received.p_data,
+                                                  p_ntf->data.received.power,
+                                                  p_ntf->data.received.lqi,
+                                                  p_ntf->data.received.time);
+                break;
+
+            case NRF_802154_BATCH_NTF_TRANSMITTED:
+                nrf_802154_transmitted_raw(p_ntf->data.transmitted.p_frame,
+                                           &p_ntf->data.transmitted.metadata);
+                break;
+
+            case NRF_802154_BATCH_NTF_TRANSMIT_FAILED:
+                nrf_802154_transmit_failed(p_ntf->data.transmit_failed.p_frame,
+                                           p_ntf->data.transmit_failed.error,
+                                           &p_ntf->data.transmit_failed.metadata);
+                break;
+
+            default:
+                NRF_802154_ASSERT(false);
+        }
+    }
+}
+
+#endif // NRF_802154_NOTIFICATION_BATCH_ENABLED
+
 __WEAK void nrf_802154_energy_detected(const nrf_802154_energy_detected_t * p_result)
 {
     (void)p_result;
@@ -39,6 +39,7 @@
 
 #include <nrfx.h>
 #include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_aes_ccm_acc_ecb.h"
 
 #include "nrf_802154_assert.h"
 #include <string.h>
@@ -51,8 +52,6 @@
 #include "hal/nrf_ecb.h"
 #endif
 
-#define NRF_802154_AES_CCM_BLOCK_SIZE             16     // Annex B4 Specification of generic CCM* a)
-
 #define NRF_802154_AES_CCM_ADATA_AUTH_FLAG        (0x40) // Annex B4.1.2 - Adata flag for authentication transform
 #define NRF_802154_AES_CCM_M_BITS_AUTH_FLAG       3      // Annex B4.1.2 - Nr of bits for MIC flag for authentication transform
 
@@ -74,41 +73,20 @@ typedef enum
     CALCULATE_ENCRYPTED_TAG
 } ccm_steps_t;
 
-/**
- * @brief Actual state of perfomed AES-CCM* algorithm.
- */
-typedef struct
-{
-    ccm_steps_t transformation;                                                    // Actual step of transformation
-    uint8_t     iteration;                                                         // Iteration of actual step of transformation
-} ccm_state_t;
-
-static nrf_802154_aes_ccm_data_t m_aes_ccm_data;                                   ///< AES CCM Frame
-static uint8_t                   m_x[NRF_802154_AES_CCM_BLOCK_SIZE];               ///< CBC-MAC value - Annex B4.1.2 d)
-static uint8_t                   m_b[NRF_802154_AES_CCM_BLOCK_SIZE];               ///< B[i] octet for Authorization Transformatino - Annex B4.1.2 b)
-static uint8_t                   m_m[NRF_802154_AES_CCM_BLOCK_SIZE];               ///< M[i] octet as parsed plaintext blocks - Annex B4.1.3 c)
-static uint8_t                   m_a[NRF_802154_AES_CCM_BLOCK_SIZE];               ///< A[i] octet for Encryption Transformation - Annex B4.1.3 b)
-static ccm_state_t               m_state;                                          ///< State of AES-CCM* transformation
-static uint8_t                   m_auth_tag[MIC_128_SIZE];                         ///< Authorization Tag
-static uint8_t                 * mp_ciphertext;                                    ///< Pointer to ciphertext destination buffer.
-static uint8_t                 * mp_work_buffer;                                   ///< Pointer to work buffer that stores the frame being transformed.
+typedef nrf_802154_aes_ccm_ctx_t ccm_ctx_t;
 
 static const uint8_t m_mic_size[] = { 0, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE }; ///< Security level - 802.15.4-2015 Standard Table 9.6
 
-typedef struct
-{
-    uint32_t key[NRF_802154_AES_CCM_BLOCK_SIZE / sizeof(uint32_t)];
-    uint8_t  cleartext[NRF_802154_AES_CCM_BLOCK_SIZE];
-    uint8_t  ciphertext[NRF_802154_AES_CCM_BLOCK_SIZE];
-} nrf_802154_hal_ecb_data_t;
+/* Context of the transformations performed through the nrf_802154_aes_ccm.h API. The frames it
+ * secures (transmitted frames and enhanced ACKs) share the transmit work buffer and are never
+ * transmitted at the same time.
+ */
+static ccm_ctx_t m_ctx;
 
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/
 
-static nrf_802154_hal_ecb_data_t m_ecb_hal_data;
-static bool                      m_ecb_hal_req_run;
-
 #if defined(CONFIG_MPSL)
 static inline void ecb_block_encrypt(nrf_802154_hal_ecb_data_t * p_ecb_data)
 {
@@ -188,19 +166,19 @@ static void ecb_block_encrypt(nrf_802154_hal_ecb_data_t * p_ecb_data)
 
 #endif /* defined(CONFIG_MPSL) */
 
-static inline uint8_t * ecb_hal_cleartext_ptr_get(void)
+static inline uint8_t * ecb_hal_cleartext_ptr_get(ccm_ctx_t * p_ctx)
 {
-    return (uint8_t *)m_ecb_hal_data.cleartext;
+    return (uint8_t *)p_ctx->ecb_data.cleartext;
 }
 
-static inline uint8_t * ecb_hal_ciphertext_ptr_get(void)
+static inline uint8_t * ecb_hal_ciphertext_ptr_get(ccm_ctx_t * p_ctx)
 {
-    return (uint8_t *)m_ecb_hal_data.ciphertext;
+    return (uint8_t *)p_ctx->ecb_data.ciphertext;
 }
 
-static void ecb_hal_key_set(const uint8_t * p_key)
+static void ecb_hal_key_set(ccm_ctx_t * p_ctx, const uint8_t * p_key)
 {
-    memcpy(m_ecb_hal_data.key, p_key, NRF_802154_AES_CCM_BLOCK_SIZE);
+    memcpy(p_ctx->ecb_data.key, p_key, NRF_802154_AES_CCM_BLOCK_SIZE);
 }
 
 /******************************************************************************/
@@ -373,135 +351,149 @@ static bool plain_text_data_get(const nrf_802154_aes_ccm_data_t * p_frame,
 
 /**
  * @brief Block of Authorization Transformation iteration
+ *
+ * @param[inout] p_ctx  Transformation context.
  */
-static inline void process_ecb_auth_iteration(void)
+static inline void process_ecb_auth_iteration(ccm_ctx_t * p_ctx)
 {
-    m_state.iteration++;
-    two_blocks_xor(ecb_hal_ciphertext_ptr_get(), m_b, NRF_802154_AES_CCM_BLOCK_SIZE);
-    memcpy(ecb_hal_cleartext_ptr_get(),
-           ecb_hal_ciphertext_ptr_get(),
+    p_ctx->state.iteration++;
+    two_blocks_xor(ecb_hal_ciphertext_ptr_get(p_ctx), p_ctx->b, NRF_802154_AES_CCM_BLOCK_SIZE);
+    memcpy(ecb_hal_cleartext_ptr_get(p_ctx),
+           ecb_hal_ciphertext_ptr_get(p_ctx),
            NRF_802154_AES_CCM_BLOCK_SIZE);
-    m_ecb_hal_req_run = true;
+    p_ctx->ecb_req_run = true;
 }
 
 /**
  * @brief Block of Encryption Transformation iteration
+ *
+ * @param[inout] p_ctx  Transformation context.
  */
-static inline void process_ecb_encrypt_iteration(void)
+static inline void process_ecb_encrypt_iteration(ccm_ctx_t * p_ctx)
 {
-    ai_format(&m_aes_ccm_data, m_state.iteration, m_a);
-    memcpy(ecb_hal_cleartext_ptr_get(), m_a, NRF_802154_AES_CCM_BLOCK_SIZE);
-    m_ecb_hal_req_run = true;
+    ai_format(&p_ctx->aes_ccm_data, p_ctx->state.iteration, p_ctx->a);
+    memcpy(ecb_hal_cleartext_ptr_get(p_ctx), p_ctx->a, NRF_802154_AES_CCM_BLOCK_SIZE);
+    p_ctx->ecb_req_run = true;
 }
 
 /**
  * @brief helper function for plain text encryption in ECB IRQ
+ *
+ * @param[inout] p_ctx  Transformation context.
  */
-static void perform_plain_text_encryption(void)
+static void perform_plain_text_encryption(ccm_ctx_t * p_ctx)
 {
-    memcpy(m_auth_tag, ecb_hal_ciphertext_ptr_get(), m_mic_size[m_aes_ccm_data.mic_level]);
+    uint8_t mic_size = m_mic_size[p_ctx->aes_ccm_data.mic_level];
+
+    memcpy(p_ctx->auth_tag, ecb_hal_ciphertext_ptr_get(p_ctx), mic_size);
 
-    m_state.iteration      = 0;
-    m_state.transformation = PLAIN_TEXT_ENCRYPT;
+    p_ctx->state.iteration      = 0;
+    p_ctx->state.transformation = PLAIN_TEXT_ENCRYPT;
 
-    if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_m))
+    if (plain_text_data_get(&p_ctx->aes_ccm_data, p_ctx->state.iteration, p_ctx->m))
     {
-        m_state.iteration++;
-        process_ecb_encrypt_iteration();
+        p_ctx->state.iteration++;
+        process_ecb_encrypt_iteration(p_ctx);
     }
     else
     {
-        if (m_mic_size[m_aes_ccm_data.mic_level] != 0)
+        if (mic_size != 0)
         {
-            process_ecb_encrypt_iteration();
-            m_state.transformation = CALCULATE_ENCRYPTED_TAG;
+            process_ecb_encrypt_iteration(p_ctx);
+            p_ctx->state.transformation = CALCULATE_ENCRYPTED_TAG;
         }
     }
 }
 
 /**
  * @brief helper function for plain text auth in ECB IRQ
+ *
+ * @param[inout] p_ctx  Transformation context.
  */
-static void perform_plain_text_authorization(void)
+static void perform_plain_text_authorization(ccm_ctx_t * p_ctx)
 {
-    if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
+    if (plain_text_data_get(&p_ctx->aes_ccm_data, p_ctx->state.iteration, p_ctx->b))
     {
-        process_ecb_auth_iteration();
+        process_ecb_auth_iteration(p_ctx);
     }
     else
     {
-        perform_plain_text_encryption();
+        perform_plain_text_encryption(p_ctx);
     }
 }
 
-static void transformation_finished(void)
+static void transformation_finished(ccm_ctx_t * p_ctx)
 {
-    nrf_802154_tx_work_buffer_is_secured_set();
-    m_aes_ccm_data.raw_frame = NULL;
+    if (p_ctx->tx_work_buffer_used)
+    {
+        nrf_802154_tx_work_buffer_is_secured_set();
+    }
+
+    p_ctx->aes_ccm_data.raw_frame = NULL;
+    p_ctx->secured                = true;
 }
 
-static void ecb_hal_block_encrypted_handler(void)
+static void ecb_hal_block_encrypted_handler(ccm_ctx_t * p_ctx)
 {
-    uint8_t len = 0;
+    uint8_t mic_size = m_mic_size[p_ctx->aes_ccm_data.mic_level];
+    uint8_t len      = 0;
     uint8_t offset;
 
-    switch (m_state.transformation)
+    switch (p_ctx->state.transformation)
     {
         case ADD_AUTH_DATA_AUTH:
-            if (add_auth_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
+            if (add_auth_data_get(&p_ctx->aes_ccm_data, p_ctx->state.iteration, p_ctx->b))
             {
-                process_ecb_auth_iteration();
+                process_ecb_auth_iteration(p_ctx);
             }
             else
             {
-                m_state.iteration      = 0;
-                m_state.transformation = PLAIN_TEXT_AUTH;
-                perform_plain_text_authorization();
+                p_ctx->state.iteration      = 0;
+                p_ctx->state.transformation = PLAIN_TEXT_AUTH;
+                perform_plain_text_authorization(p_ctx);
             }
             break;
 
         case PLAIN_TEXT_AUTH:
-            perform_plain_text_authorization();
+            perform_plain_text_authorization(p_ctx);
             break;
 
         case PLAIN_TEXT_ENCRYPT:
-            two_blocks_xor(m_m, ecb_hal_ciphertext_ptr_get(), NRF_802154_AES_CCM_BLOCK_SIZE);
+            two_blocks_xor(p_ctx->m,
+                           ecb_hal_ciphertext_ptr_get(p_ctx),
+                           NRF_802154_AES_CCM_BLOCK_SIZE);
 
-            offset = (m_state.iteration - 1) * NRF_802154_AES_CCM_BLOCK_SIZE;
-            len    = NRFX_MIN(m_aes_ccm_data.plain_text_data_len - offset,
+            offset = (p_ctx->state.iteration - 1) * NRF_802154_AES_CCM_BLOCK_SIZE;
+            len    = NRFX_MIN(p_ctx->aes_ccm_data.plain_text_data_len - offset,
                               NRF_802154_AES_CCM_BLOCK_SIZE);
-            memcpy(mp_ciphertext + offset, m_m, len);
-            if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_m))
+            memcpy(p_ctx->p_ciphertext + offset, p_ctx->m, len);
+            if (plain_text_data_get(&p_ctx->aes_ccm_data, p_ctx->state.iteration, p_ctx->m))
             {
-                m_state.iteration++;
-                process_ecb_encrypt_iteration();
+                p_ctx->state.iteration++;
+                process_ecb_encrypt_iteration(p_ctx);
             }
             else
             {
-                if (m_mic_size[m_aes_ccm_data.mic_level] != 0)
+                if (mic_size != 0)
                 {
-                    m_state.iteration      = 0;
-                    m_state.transformation = CALCULATE_ENCRYPTED_TAG;
-                    process_ecb_encrypt_iteration();
+                    p_ctx->state.iteration      = 0;
+                    p_ctx->state.transformation = CALCULATE_ENCRYPTED_TAG;
+                    process_ecb_encrypt_iteration(p_ctx);
                 }
                 else
                 {
-                    transformation_finished();
+                    transformation_finished(p_ctx);
                 }
             }
             break;
 
         case CALCULATE_ENCRYPTED_TAG:
-            two_blocks_xor(m_auth_tag,
-                           ecb_hal_ciphertext_ptr_get(),
-                           m_mic_size[m_aes_ccm_data.mic_level]);
-            memcpy(mp_work_buffer +
-                   (mp_work_buffer[PHR_OFFSET] - FCS_SIZE -
-                    m_mic_size[m_aes_ccm_data.mic_level] +
-                    PHR_SIZE),
-                   m_auth_tag,
-                   m_mic_size[m_aes_ccm_data.mic_level]);
-            transformation_finished();
+            two_blocks_xor(p_ctx->auth_tag, ecb_hal_ciphertext_ptr_get(p_ctx), mic_size);
+            memcpy(p_ctx->p_work_buffer +
+                   (p_ctx->p_work_buffer[PHR_OFFSET] - FCS_SIZE - mic_size + PHR_SIZE),
+                   p_ctx->auth_tag,
+                   mic_size);
+            transformation_finished(p_ctx);
             break;
 
         default:
@@ -511,29 +503,34 @@ static void ecb_hal_block_encrypted_handler(void)
 
 /**
  * @brief Start AES-CCM* Authorization Transformation
+ *
+ * @param[inout] p_ctx  Transformation context.
  */
-static void start_ecb_auth_transformation(void)
+static void start_ecb_auth_transformation(ccm_ctx_t * p_ctx)
 {
-    ecb_hal_key_set(m_aes_ccm_data.key);
-    memcpy(ecb_hal_cleartext_ptr_get(), m_x, NRF_802154_AES_CCM_BLOCK_SIZE);
-    m_state.iteration      = 0;
-    m_state.transformation = ADD_AUTH_DATA_AUTH;
-    m_ecb_hal_req_run      = true;
+    ecb_hal_key_set(p_ctx, p_ctx->aes_ccm_data.key);
+    memcpy(ecb_hal_cleartext_ptr_get(p_ctx), p_ctx->x, NRF_802154_AES_CCM_BLOCK_SIZE);
+    p_ctx->state.iteration      = 0;
+    p_ctx->state.transformation = ADD_AUTH_DATA_AUTH;
+    p_ctx->ecb_req_run          = true;
 
-    while (m_ecb_hal_req_run)
+    while (p_ctx->ecb_req_run)
     {
-        m_ecb_hal_req_run = false;
-        ecb_block_encrypt(&m_ecb_hal_data);
-        ecb_hal_block_encrypted_handler();
+        p_ctx->ecb_req_run = false;
+        ecb_block_encrypt(&p_ctx->ecb_data);
+        ecb_hal_block_encrypted_handler(p_ctx);
     }
 }
 
-void nrf_802154_aes_ccm_transform_reset(void)
+void nrf_802154_aes_ccm_ctx_reset(ccm_ctx_t * p_ctx)
 {
-    m_aes_ccm_data.raw_frame = NULL;
+    p_ctx->aes_ccm_data.raw_frame = NULL;
+    p_ctx->secured                = false;
 }
 
-bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_aes_ccm_data)
+bool nrf_802154_aes_ccm_ctx_transform_prepare(ccm_ctx_t                       * p_ctx,
+                                              const nrf_802154_aes_ccm_data_t * p_aes_ccm_data,
+                                              uint8_t                         * p_work_buffer)
 {
     // Verify that all necessary data is available
     if (p_aes_ccm_data->raw_frame == NULL)
@@ -555,7 +552,7 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
     }
 
     // Store the encryption data for future use
-    memcpy(&m_aes_ccm_data, p_aes_ccm_data, sizeof(nrf_802154_aes_ccm_data_t));
+    memcpy(&p_ctx->aes_ccm_data, p_aes_ccm_data, sizeof(nrf_802154_aes_ccm_data_t));
 
     ptrdiff_t offset = p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE;
 
@@ -566,49 +563,77 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
 
     NRF_802154_ASSERT((offset >= 0) && (offset <= MAX_PACKET_SIZE + PHR_SIZE));
 
-    nrf_802154_tx_work_buffer_plain_text_offset_set(offset);
-    mp_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
-    mp_ciphertext  = mp_work_buffer + offset;
+    p_ctx->tx_work_buffer_used = (p_work_buffer == NULL);
+
+    if (p_ctx->tx_work_buffer_used)
+    {
+        nrf_802154_tx_work_buffer_plain_text_offset_set(offset);
+        p_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
+    }
+
+    p_ctx->p_work_buffer = p_work_buffer;
+    p_ctx->p_ciphertext  = p_ctx->p_work_buffer + offset;
+    p_ctx->secured       = false;
 
-    memcpy(mp_work_buffer, p_aes_ccm_data->raw_frame, offset);
-    memset(mp_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
+    memcpy(p_ctx->p_work_buffer, p_aes_ccm_data->raw_frame, offset);
+    memset(p_ctx->p_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
 
     return true;
 }
 
-void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
+bool nrf_802154_aes_ccm_ctx_transform_start(ccm_ctx_t * p_ctx, uint8_t * p_frame)
 {
     // Verify that the algorithm's inputs were prepared properly
-    if ((p_frame != m_aes_ccm_data.raw_frame) || (m_aes_ccm_data.raw_frame == NULL))
+    if ((p_frame != p_ctx->aes_ccm_data.raw_frame) || (p_ctx->aes_ccm_data.raw_frame == NULL))
     {
-        return;
+        return false;
     }
 
-    uint8_t   auth_flags = auth_flags_format(&m_aes_ccm_data);
-    uint8_t * p_x        = m_x;
-    uint8_t * p_b        = m_b;
-    ptrdiff_t offset     = mp_ciphertext - mp_work_buffer;
+    uint8_t   auth_flags = auth_flags_format(&p_ctx->aes_ccm_data);
+    ptrdiff_t offset     = p_ctx->p_ciphertext - p_ctx->p_work_buffer;
 
     // Copy updated part of the frame
-    memcpy(mp_work_buffer, p_frame, offset);
+    memcpy(p_ctx->p_work_buffer, p_frame, offset);
 
     // initial settings
-    memset(p_x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
-    b0_format(&m_aes_ccm_data, auth_flags, p_b);
+    memset(p_ctx->x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
+    b0_format(&p_ctx->aes_ccm_data, auth_flags, p_ctx->b);
 
-    two_blocks_xor(p_x, p_b, NRF_802154_AES_CCM_BLOCK_SIZE);
-    start_ecb_auth_transformation();
+    two_blocks_xor(p_ctx->x, p_ctx->b, NRF_802154_AES_CCM_BLOCK_SIZE);
+    start_ecb_auth_transformation(p_ctx);
+
+    return p_ctx->secured;
 }
 
-void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
+void nrf_802154_aes_ccm_ctx_transform_abort(ccm_ctx_t * p_ctx, uint8_t * p_frame)
 {
     // Verify that the encryption of the correct frame is being aborted.
-    if (p_frame != m_aes_ccm_data.raw_frame)
+    if (p_frame != p_ctx->aes_ccm_data.raw_frame)
     {
         return;
     }
 
-    m_aes_ccm_data.raw_frame = NULL;
+    p_ctx->aes_ccm_data.raw_frame = NULL;
+}
+
+void nrf_802154_aes_ccm_transform_reset(void)
+{
+    nrf_802154_aes_ccm_ctx_reset(&m_ctx);
+}
+
+bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_aes_ccm_data)
+{
+    return nrf_802154_aes_ccm_ctx_transform_prepare(&m_ctx, p_aes_ccm_data, NULL);
+}
+
+void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
+{
+    (void)nrf_802154_aes_ccm_ctx_transform_start(&m_ctx, p_frame);
+}
+
+void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
+{
+    nrf_802154_aes_ccm_ctx_transform_abort(&m_ctx, p_frame);
 }
 
 #endif /* NRF_802154_ENCRYPTION_ENABLED && defined(NRF_802154_ENCRYPTION_ACCELERATOR_ECB) */
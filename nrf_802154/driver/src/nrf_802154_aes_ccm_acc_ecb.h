@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file defines transformation contexts of the AES-CCM* implementation that uses
+ *   the ECB peripheral.
+ *
+ * The API declared in nrf_802154_aes_ccm.h secures frames in the transmit work buffer using
+ * a single context. The functions declared here allow several frames to be secured independently,
+ * each in its own context and into its own work buffer. A context can be prepared while another
+ * one holds a prepared frame. The block encryption is not reentrant, so a transformation must not
+ * be started while another one is running.
+ */
+
+#ifndef NRF_802154_AES_CCM_ACC_ECB_H_
+#define NRF_802154_AES_CCM_ACC_ECB_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_const.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_802154_AES_CCM_BLOCK_SIZE 16 // Annex B4 Specification of generic CCM* a)
+
+/**
+ * @brief Data block processed by the ECB peripheral.
+ */
+typedef struct
+{
+    uint32_t key[NRF_802154_AES_CCM_BLOCK_SIZE / sizeof(uint32_t)];
+    uint8_t  cleartext[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t  ciphertext[NRF_802154_AES_CCM_BLOCK_SIZE];
+} nrf_802154_hal_ecb_data_t;
+
+/**
+ * @brief Actual state of perfomed AES-CCM* algorithm.
+ */
+typedef struct
+{
+    uint8_t transformation; ///< Actual step of transformation
+    uint8_t iteration;      ///< Iteration of actual step of transformation
+} nrf_802154_aes_ccm_state_t;
+
+/**
+ * @brief Context of a single AES-CCM* transformation.
+ *
+ * The context holds all the state of the transformation of one frame, including the data block
+ * processed by the ECB peripheral.
+ *
+ * @note Do not modify the fields directly, use the API functions only.
+ */
+typedef struct
+{
+    nrf_802154_hal_ecb_data_t  ecb_data;                         ///< ECB key, input block and output block
+    nrf_802154_aes_ccm_data_t  aes_ccm_data;                     ///< AES CCM Frame
+    uint8_t                    x[NRF_802154_AES_CCM_BLOCK_SIZE]; ///< CBC-MAC value - Annex B4.1.2 d)
+    uint8_t                    b[NRF_802154_AES_CCM_BLOCK_SIZE]; ///< B[i] octet for Authorization Transformatino - Annex B4.1.2 b)
+    uint8_t                    m[NRF_802154_AES_CCM_BLOCK_SIZE]; ///< M[i] octet as parsed plaintext blocks - Annex B4.1.3 c)
+    uint8_t                    a[NRF_802154_AES_CCM_BLOCK_SIZE]; ///< A[i] octet for Encryption Transformation - Annex B4.1.3 b)
+    nrf_802154_aes_ccm_state_t state;                            ///< State of AES-CCM* transformation
+    uint8_t                    auth_tag[MIC_128_SIZE];           ///< Authorization Tag
+    uint8_t                  * p_ciphertext;                     ///< Pointer to ciphertext destination buffer.
+    uint8_t                  * p_work_buffer;                    ///< Pointer to work buffer that stores the frame being transformed.
+    bool                       tx_work_buffer_used;              ///< Indicates that the work buffer is the transmit work buffer.
+    bool                       ecb_req_run;                      ///< Indicates that the next block is to be encrypted.
+    bool                       secured;                          ///< Indicates that the last transformation completed.
+} nrf_802154_aes_ccm_ctx_t;
+
+/**
+ * @brief Resets the AES-CCM* transformation of the given context.
+ *
+ * @param[out] p_ctx  Transformation context.
+ */
+void nrf_802154_aes_ccm_ctx_reset(nrf_802154_aes_ccm_ctx_t * p_ctx);
+
+/**
+ * @brief Prepares an AES-CCM* transformation in the given context.
+ *
+ * The part of the frame that is not encrypted is copied to the work buffer and the encrypted part
+ * of the work buffer is cleared.
+ *
+ * @param[inout] p_ctx           Transformation context.
+ * @param[in]    p_aes_ccm_data  Data to be used for the AES-CCM* transformation.
+ * @param[out]   p_work_buffer   Buffer of at least @c MAX_PACKET_SIZE + @c PHR_SIZE bytes to store
+ *                               the secured frame, or NULL to use the transmit work buffer.
+ *
+ * @retval  true   The transformation was prepared successfully and can be performed.
+ * @retval  false  Provided parameters do not allow for successful transformation.
+ */
+bool nrf_802154_aes_ccm_ctx_transform_prepare(nrf_802154_aes_ccm_ctx_t        * p_ctx,
+                                              const nrf_802154_aes_ccm_data_t * p_aes_ccm_data,
+                                              uint8_t                         * p_work_buffer);
+
+/**
+ * @brief Performs a prepared AES-CCM* transformation in the given context.
+ *
+ * The secured frame is stored in the work buffer passed to
+ * @ref nrf_802154_aes_ccm_ctx_transform_prepare.
+ *
+ * @param[inout] p_ctx    Transformation context.
+ * @param[in]    p_frame  Pointer to the buffer that contains the frame passed as @c raw_frame
+ *                        to @ref nrf_802154_aes_ccm_ctx_transform_prepare.
+ *
+ * @retval  true   The frame is secured.
+ * @retval  false  The transformation was not prepared for @p p_frame.
+ */
+bool nrf_802154_aes_ccm_ctx_transform_start(nrf_802154_aes_ccm_ctx_t * p_ctx, uint8_t * p_frame);
+
+/**
+ * @brief Aborts a prepared AES-CCM* transformation in the given context.
+ *
+ * @param[inout] p_ctx    Transformation context.
+ * @param[in]    p_frame  Pointer to the buffer that contains the frame being transformed.
+ */
+void nrf_802154_aes_ccm_ctx_transform_abort(nrf_802154_aes_ccm_ctx_t * p_ctx, uint8_t * p_frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_AES_CCM_ACC_ECB_H_
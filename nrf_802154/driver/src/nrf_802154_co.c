@@ -113,3 +113,14 @@ void nrf_802154_co_transmit_failed(uint8_t                                   * p
     nrf_802154_transmit_failed(p_frame, error, p_metadata);
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
+
+#if !NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED
+
+void nrf_802154_co_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+    nrf_802154_notifications_batch(p_ntfs, count);
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif // !NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED
@@ -92,3 +92,12 @@ void nrf_802154_co_transmitted_raw(uint8_t                                   * p
 void nrf_802154_co_transmit_failed(uint8_t                                   * p_frame,
                                    nrf_802154_tx_error_t                       error,
                                    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
+#if !NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED
+
+/** @brief Calls @ref nrf_802154_notifications_batch.
+ *  @note See @ref nrf_802154_notifications_batch for documentation of parameters.
+ */
+void nrf_802154_co_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count);
+
+#endif // !NRF_802154_SERIALIZATION_HOST && NRF_802154_NOTIFICATION_BATCH_ENABLED
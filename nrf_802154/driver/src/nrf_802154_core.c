@@ -874,7 +874,7 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_TX_ACK:
-            mp_current_rx_buffer->free = false;
+            nrf_802154_rx_buffer_take(mp_current_rx_buffer);
             nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_ABORTED);
             received_frame_notify(mp_current_rx_buffer->data);
             break;
@@ -1086,14 +1086,48 @@ static nrf_802154_trx_transmit_notifications_t make_trx_frame_transmit_notificat
     return result;
 }
 
-static void notify_no_rx_buffer(void)
+/**
+ * @brief Find a free rx buffer and notify the higher layer if there is none.
+ *
+ * Buffers are released by the higher layer without entering the core. The higher layer requests
+ * @ref nrf_802154_core_notify_buffer_free only when the core awaits a buffer, so the flag is set
+ * before the last search to make sure that a buffer released in the meantime is not missed.
+ *
+ * @returns Pointer to a free rx buffer or NULL if rx buffer is not available.
+ */
+static rx_buffer_t * rx_buffer_free_find_or_await(void)
 {
-    uint8_t old_value = 0U;
+    rx_buffer_t * p_rx_buffer = nrf_802154_rx_buffer_free_find();
+    uint8_t       old_value   = 0U;
+    bool          first_miss;
+
+    if (p_rx_buffer != NULL)
+    {
+        return p_rx_buffer;
+    }
+
+    first_miss = nrf_802154_sl_atomic_cas_u8(&m_no_rx_buffer_notified, &old_value, 1U);
+
+    __DMB();
+
+    p_rx_buffer = nrf_802154_rx_buffer_free_find();
 
-    if (nrf_802154_sl_atomic_cas_u8(&m_no_rx_buffer_notified, &old_value, 1U))
+    if (p_rx_buffer != NULL)
     {
-        receive_failed_notify(NRF_802154_RX_ERROR_NO_BUFFER);
+        /* A buffer was released concurrently. */
+        nrf_802154_sl_atomic_store_u8(&m_no_rx_buffer_notified, 0U);
     }
+    else
+    {
+        nrf_802154_stat_counter_increment_rx_buffer_starvations();
+
+        if (first_miss)
+        {
+            receive_failed_notify(NRF_802154_RX_ERROR_NO_BUFFER);
+        }
+    }
+
+    return p_rx_buffer;
 }
 
 static void rx_init_free_buffer_find_and_update(bool free_buffer)
@@ -1101,16 +1135,8 @@ static void rx_init_free_buffer_find_and_update(bool free_buffer)
     if (!free_buffer)
     {
         /* If no buffer was available, then find a new one. */
-        rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
-
-        uint8_t * rx_buffer = rx_buffer_get();
-
-        nrf_802154_trx_receive_buffer_set(rx_buffer);
-
-        if (NULL == rx_buffer)
-        {
-            notify_no_rx_buffer();
-        }
+        rx_buffer_in_use_set(rx_buffer_free_find_or_await());
+        nrf_802154_trx_receive_buffer_set(rx_buffer_get());
     }
 }
 
@@ -1473,7 +1499,7 @@ static void on_timeslot_ended(void)
 
             case RADIO_STATE_TX_ACK:
                 state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_take(mp_current_rx_buffer);
                 nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_TIMESLOT_ENDED);
                 received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
                 break;
@@ -2002,6 +2028,10 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_BCMATCH,
+                                bcc);
+
     uint8_t                         next_bcc;
     nrf_802154_filter_mode_t        filter_mode;
     bool                            parse_result;
@@ -2084,6 +2114,10 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         }
     }
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_FILTER,
+                                filter_result);
+
     if (filter_result != NRF_802154_RX_ERROR_NONE)
     {
         nrf_802154_trx_abort();
@@ -2159,8 +2193,16 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         nrf_802154_frame_ar_bit_is_set(&m_current_rx_frame_data) &&
         nrf_802154_pib_auto_ack_get())
     {
+        nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_ACK_GEN_START,
+                                    0);
+
         curr_peer_rec_update();
         mp_ack = nrf_802154_ack_generator_create(&m_current_rx_frame_data, curr_peer_rec_get());
+
+        nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_ACK_GEN_END,
+                                    mp_ack != NULL);
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2218,6 +2260,10 @@ void nrf_802154_trx_receive_frame_received(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_RX_END,
+                                0);
+
     uint8_t             * p_received_data = mp_current_rx_buffer->data;
     nrf_802154_rx_error_t filter_result   = NRF_802154_RX_ERROR_RUNTIME;
 
@@ -2332,7 +2378,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 }
                 else
                 {
-                    mp_current_rx_buffer->free = false;
+                    nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
                     switch_to_idle();
 
@@ -2347,7 +2393,7 @@ void nrf_802154_trx_receive_frame_received(void)
                     nrf_802154_stat_counter_increment_coex_denied_requests();
                 }
 
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
                 switch_to_idle();
 
@@ -2362,7 +2408,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 nrf_802154_pib_promiscuous_get())
             {
                 /* Current buffer will be passed to the application. */
-                mp_current_rx_buffer->free = false;
+                nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
                 switch_to_idle();
 
@@ -2411,6 +2457,10 @@ void nrf_802154_trx_transmit_frame_started(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_START,
+                                0);
+
     NRF_802154_ASSERT((m_state == RADIO_STATE_TX) || (m_state == RADIO_STATE_CCA_TX));
     if (tx_started_core_hooks_will_fit_within_timeslot(m_tx.frame.p_frame))
     {
@@ -2435,6 +2485,10 @@ void nrf_802154_trx_transmit_ack_started(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_START,
+                                1);
+
     NRF_802154_ASSERT(m_state == RADIO_STATE_TX_ACK);
     if (tx_started_core_hooks_will_fit_within_timeslot(mp_ack))
     {
@@ -2445,7 +2499,7 @@ void nrf_802154_trx_transmit_ack_started(void)
         uint8_t * p_received_data = mp_current_rx_buffer->data;
 
         nrf_802154_trx_abort();
-        mp_current_rx_buffer->free = false;
+        nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
         nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_RX_ERROR_TIMESLOT_ENDED);
         switch_to_idle();
@@ -2459,12 +2513,16 @@ void nrf_802154_trx_transmit_ack_transmitted(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_END,
+                                1);
+
     NRF_802154_ASSERT(m_state == RADIO_STATE_TX_ACK);
 
     uint8_t * p_received_data = mp_current_rx_buffer->data;
 
     /* Current buffer used for receive operation will be passed to the application. */
-    mp_current_rx_buffer->free = false;
+    nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
     switch_to_idle();
 
@@ -2477,6 +2535,10 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_END,
+                                0);
+
 #if NRF_802154_FRAME_TIMESTAMP_ENABLED
 
     uint64_t ts = timer_coord_timestamp_get();
@@ -2655,7 +2717,7 @@ void nrf_802154_trx_receive_ack_received(void)
 
         rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
 
-        mp_current_rx_buffer->free = false;
+        nrf_802154_rx_buffer_take(mp_current_rx_buffer);
 
         /* Detect Frame Pending field set to one on Ack frame received after a Data Request Command. */
         bool should_receive = false;
@@ -2697,6 +2759,10 @@ void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_CCA,
+                                channel_was_idle);
+
     switch_to_idle();
 
     cca_notify(channel_was_idle);
@@ -2716,6 +2782,10 @@ void nrf_802154_trx_transmit_frame_ccaidle(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_CCA,
+                                1);
+
     NRF_802154_ASSERT(m_state == RADIO_STATE_CCA_TX);
     NRF_802154_ASSERT(m_trx_transmit_frame_notifications_mask & TRX_TRANSMIT_NOTIFICATION_CCAIDLE);
 
@@ -2744,6 +2814,10 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_CCA,
+                                0);
+
     nrf_802154_stat_counter_increment_cca_failed_attempts();
 
     switch_to_idle();
@@ -2834,6 +2908,11 @@ void nrf_802154_core_deinit(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+bool nrf_802154_core_rx_buffer_is_awaited(void)
+{
+    return nrf_802154_sl_atomic_load_u8(&m_no_rx_buffer_notified) != 0U;
+}
+
 radio_state_t nrf_802154_core_state_get(void)
 {
     return m_state;
@@ -3217,17 +3296,18 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
-    bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
+    bool in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
-    nrf_802154_sl_atomic_store_u8(&m_no_rx_buffer_notified, 0U);
+    /* The buffer has already been released by the higher layer. */
+    (void)p_data;
 
     if (in_crit_sect)
     {
+        nrf_802154_sl_atomic_store_u8(&m_no_rx_buffer_notified, 0U);
+
         if (timeslot_is_granted() && nrf_802154_trx_receive_is_buffer_missing())
         {
-            rx_buffer_in_use_set(p_buffer);
+            rx_buffer_in_use_set(rx_buffer_free_find_or_await());
             nrf_802154_trx_receive_buffer_set(rx_buffer_get());
         }
 
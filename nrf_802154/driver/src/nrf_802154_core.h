@@ -105,6 +105,16 @@ void nrf_802154_core_deinit(void);
  */
 radio_state_t nrf_802154_core_state_get(void);
 
+/**
+ * @brief Check if the core awaits a free rx buffer.
+ *
+ * This function can be called from any context.
+ *
+ * @retval true   The core ran out of free rx buffers and awaits @ref nrf_802154_core_notify_buffer_free.
+ * @retval false  The core does not need to be notified about released rx buffers.
+ */
+bool nrf_802154_core_rx_buffer_is_awaited(void);
+
 /***************************************************************************************************
  * @section State machine transition requests
  **************************************************************************************************/
@@ -246,6 +256,10 @@ bool nrf_802154_core_modulated_carrier(nrf_802154_term_t term_lvl,
  * If the core receives this notification, it changes the internal state to make sure
  * the receiver is started if requested.
  *
+ * The buffer must be released with @ref nrf_802154_rx_buffer_release before this notification
+ * is issued. The notification is needed only if @ref nrf_802154_core_rx_buffer_is_awaited
+ * returns true after the release.
+ *
  * @param[in]  p_data  Pointer to buffer that has been freed.
  */
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
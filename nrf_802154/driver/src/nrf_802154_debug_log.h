@@ -38,6 +38,7 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_sl_log.h"
 #include "nrf_802154_debug_log_codes.h"
+#include "nrf_802154_trace.h"
 
 /**@brief Records log about entry to a function.
  * @param verbosity     Verbosity level of the module in which log is recorded required to emit log.
@@ -67,8 +68,16 @@
  * @param global_event_id   Event identifier whose meaning is defined globally. Possible values 0...63
  * @param param_u16         Additional parameter to be logged with event. Meaning
  *                          of the parameter is defined by value of global_event_id.
+ *
+ * Global events that are stage transitions of the RX/TX state machine are also recorded
+ * in the trace ring, regardless of @p verbosity. See @ref nrf_802154_trace.h.
  */
-#define nrf_802154_log_global_event(verbosity, global_event_id, param_u16) \
-    nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16)
+#define nrf_802154_log_global_event(verbosity, global_event_id, param_u16)     \
+    do                                                                         \
+    {                                                                          \
+        nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16); \
+        nrf_802154_trace_global_event(global_event_id, param_u16);             \
+    }                                                                          \
+    while (0)
 
 #endif /* NRF_802154_DEBUG_LOG_H_ */
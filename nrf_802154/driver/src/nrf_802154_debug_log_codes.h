@@ -98,8 +98,33 @@ typedef enum
  */
 typedef enum
 {
-    NRF_802154_LOG_GLOBAL_EVENT_ID_RADIO_RESET = 1U
+    NRF_802154_LOG_GLOBAL_EVENT_ID_RADIO_RESET = 1U,
  // Possible "RADIO_RESET" parameter values are : 0 (the only possible value)
+
+ // Stage transitions of the RX/TX state machine, recorded also in the trace ring (nrf_802154_trace.h)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_BCMATCH = 16U,
+ // "STAGE_BCMATCH" parameter is the number of bytes received when the BCMATCH event occurred
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_FILTER = 17U,
+ // "STAGE_FILTER" parameter is the filtering verdict (nrf_802154_rx_error_t)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_ACK_GEN_START = 18U,
+ // Possible "STAGE_ACK_GEN_START" parameter values are : 0 (the only possible value)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_ACK_GEN_END = 19U,
+ // Possible "STAGE_ACK_GEN_END" parameter values are : 0 (ACK not created), 1 (ACK created)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_RX_END = 20U,
+ // Possible "STAGE_RX_END" parameter values are : 0 (the only possible value)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_CCA = 21U,
+ // Possible "STAGE_CCA" parameter values are : 0 (channel busy), 1 (channel idle)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_START = 22U,
+ // Possible "STAGE_TX_START" parameter values are : 0 (frame), 1 (ACK)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_TX_END = 23U,
+ // Possible "STAGE_TX_END" parameter values are : 0 (frame), 1 (ACK)
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_NTF_ENQUEUE = 24U,
+ // "STAGE_NTF_ENQUEUE" parameter is the type of the enqueued notification
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_NTF_DELIVER = 25U,
+ // "STAGE_NTF_DELIVER" parameter is the type of the delivered notification
+
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_FIRST = NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_BCMATCH,
+    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_LAST  = NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_NTF_DELIVER
 } nrf_802154_drv_global_events_list_t;
 
 typedef enum
@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "nrf_802154_hmap.h"
+
+#include "nrf_802154_assert.h"
+#include <string.h>
+
+/* Indicates a slot that does not hold any entry or a record index that is not valid. */
+#define REC_INVALID      UINT16_MAX
+
+/* Number of buckets a key can be stored in. */
+#define KEY_BUCKETS      2U
+
+/* FNV-1a hash parameters. */
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME        16777619UL
+
+/* Multiplier deriving the hash of the alternative bucket from the key hash. */
+#define ALT_HASH_MULT    0x9e3779b1UL
+
+static uint16_t slots_count_get(const nrf_802154_hmap_t * p_hmap)
+{
+    return (uint16_t)(p_hmap->buckets_count * NRF_802154_HMAP_BUCKET_SLOTS);
+}
+
+static inline uint8_t * key_ptr_get(const nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    return &p_hmap->p_keys[(size_t)slot * p_hmap->key_size];
+}
+
+static inline uint8_t * value_ptr_get(const nrf_802154_hmap_t * p_hmap, uint16_t rec)
+{
+    return &p_hmap->p_values[(size_t)rec * p_hmap->value_size];
+}
+
+static inline uint16_t slot_rec_get(const nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    return ((const volatile uint16_t *)p_hmap->p_slot_recs)[slot];
+}
+
+/* Makes the content of a slot visible to lookups, or hides it if rec is REC_INVALID.
+ * Everything written before is completed before the slot changes.
+ */
+static inline void slot_rec_publish(nrf_802154_hmap_t * p_hmap, uint16_t slot, uint16_t rec)
+{
+    __DMB();
+    ((volatile uint16_t *)p_hmap->p_slot_recs)[slot] = rec;
+    __DMB();
+}
+
+static uint32_t key_hash(const nrf_802154_hmap_t * p_hmap, const void * p_key)
+{
+    const uint8_t * p_byte = (const uint8_t *)p_key;
+    uint32_t        hash   = FNV_OFFSET_BASIS;
+
+    for (uint16_t i = 0U; i < p_hmap->key_size; i++)
+    {
+        hash ^= p_byte[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/* Maps a hash onto the range of buckets without a division. */
+static inline uint16_t bucket_from_hash(const nrf_802154_hmap_t * p_hmap, uint32_t hash)
+{
+    return (uint16_t)(((uint64_t)hash * p_hmap->buckets_count) >> 32);
+}
+
+static void key_buckets_get(const nrf_802154_hmap_t * p_hmap,
+                            const void              * p_key,
+                            uint16_t                  buckets[KEY_BUCKETS])
+{
+    uint32_t hash = key_hash(p_hmap, p_key);
+
+    buckets[0] = bucket_from_hash(p_hmap, hash);
+    buckets[1] = bucket_from_hash(p_hmap, (hash ^ (hash >> 16)) * ALT_HASH_MULT);
+
+    if ((buckets[1] == buckets[0]) && (p_hmap->buckets_count > 1U))
+    {
+        buckets[1] = (uint16_t)((buckets[0] + 1U) % p_hmap->buckets_count);
+    }
+}
+
+static bool slot_search(const nrf_802154_hmap_t * p_hmap,
+                        const void              * p_key,
+                        const uint16_t            buckets[KEY_BUCKETS],
+                        uint16_t                * p_slot)
+{
+    for (uint8_t b = 0U; b < KEY_BUCKETS; b++)
+    {
+        uint16_t slot = (uint16_t)(buckets[b] * NRF_802154_HMAP_BUCKET_SLOTS);
+
+        for (uint8_t i = 0U; i < NRF_802154_HMAP_BUCKET_SLOTS; i++, slot++)
+        {
+            if ((slot_rec_get(p_hmap, slot) != REC_INVALID) &&
+                (memcmp(key_ptr_get(p_hmap, slot), p_key, p_hmap->key_size) == 0))
+            {
+                *p_slot = slot;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static bool bucket_free_slot_get(const nrf_802154_hmap_t * p_hmap,
+                                 uint16_t                  bucket,
+                                 uint16_t                * p_slot)
+{
+    uint16_t slot = (uint16_t)(bucket * NRF_802154_HMAP_BUCKET_SLOTS);
+
+    for (uint8_t i = 0U; i < NRF_802154_HMAP_BUCKET_SLOTS; i++, slot++)
+    {
+        if (slot_rec_get(p_hmap, slot) == REC_INVALID)
+        {
+            *p_slot = slot;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static uint16_t slot_alt_bucket_get(const nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    uint16_t buckets[KEY_BUCKETS];
+    uint16_t bucket = (uint16_t)(slot / NRF_802154_HMAP_BUCKET_SLOTS);
+
+    key_buckets_get(p_hmap, key_ptr_get(p_hmap, slot), buckets);
+
+    return (buckets[0] == bucket) ? buckets[1] : buckets[0];
+}
+
+/* Moves the entry of an occupied slot to a free slot of its alternative bucket.
+ * The entry is visible in the new slot before it is removed from the old one,
+ * so a lookup preempting the move always finds it.
+ */
+static bool slot_entry_relocate(nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    uint16_t alt_bucket = slot_alt_bucket_get(p_hmap, slot);
+    uint16_t free_slot;
+
+    if ((alt_bucket == (slot / NRF_802154_HMAP_BUCKET_SLOTS)) ||
+        !bucket_free_slot_get(p_hmap, alt_bucket, &free_slot))
+    {
+        return false;
+    }
+
+    memcpy(key_ptr_get(p_hmap, free_slot), key_ptr_get(p_hmap, slot), p_hmap->key_size);
+    slot_rec_publish(p_hmap, free_slot, slot_rec_get(p_hmap, slot));
+    slot_rec_publish(p_hmap, slot, REC_INVALID);
+
+    return true;
+}
+
+/* Finds a free slot for a new key, relocating up to two entries to their alternative buckets
+ * if both buckets of the key are full.
+ */
+static bool slot_for_insert_get(nrf_802154_hmap_t * p_hmap,
+                                const uint16_t      buckets[KEY_BUCKETS],
+                                uint16_t          * p_slot)
+{
+    for (uint8_t b = 0U; b < KEY_BUCKETS; b++)
+    {
+        if (bucket_free_slot_get(p_hmap, buckets[b], p_slot))
+        {
+            return true;
+        }
+    }
+
+    for (uint8_t b = 0U; b < KEY_BUCKETS; b++)
+    {
+        uint16_t slot = (uint16_t)(buckets[b] * NRF_802154_HMAP_BUCKET_SLOTS);
+
+        for (uint8_t i = 0U; i < NRF_802154_HMAP_BUCKET_SLOTS; i++, slot++)
+        {
+            if (slot_entry_relocate(p_hmap, slot))
+            {
+                *p_slot = slot;
+                return true;
+            }
+        }
+    }
+
+    for (uint8_t b = 0U; b < KEY_BUCKETS; b++)
+    {
+        uint16_t slot = (uint16_t)(buckets[b] * NRF_802154_HMAP_BUCKET_SLOTS);
+
+        for (uint8_t i = 0U; i < NRF_802154_HMAP_BUCKET_SLOTS; i++, slot++)
+        {
+            uint16_t alt_slot = (uint16_t)(slot_alt_bucket_get(p_hmap, slot) *
+                                           NRF_802154_HMAP_BUCKET_SLOTS);
+
+            for (uint8_t j = 0U; j < NRF_802154_HMAP_BUCKET_SLOTS; j++, alt_slot++)
+            {
+                if (slot_entry_relocate(p_hmap, alt_slot))
+                {
+                    /* The alternative bucket has a free slot now. */
+                    (void)slot_entry_relocate(p_hmap, slot);
+                    *p_slot = slot;
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+static uint16_t free_rec_take(nrf_802154_hmap_t * p_hmap)
+{
+    NRF_802154_ASSERT(p_hmap->free_recs_count > 0U);
+
+    p_hmap->free_recs_count--;
+
+    return p_hmap->p_free_recs[p_hmap->free_recs_count];
+}
+
+static void free_rec_put(nrf_802154_hmap_t * p_hmap, uint16_t rec)
+{
+    p_hmap->p_free_recs[p_hmap->free_recs_count] = rec;
+    p_hmap->free_recs_count++;
+}
+
+/* Replaces the value of an occupied slot. The new value is written to an unused record
+ * and the slot is switched to it, so a lookup never sees a partially written value.
+ */
+static void slot_value_update(nrf_802154_hmap_t * p_hmap, uint16_t slot, const void * p_value)
+{
+    uint16_t old_rec;
+    uint16_t new_rec;
+
+    if (p_hmap->value_size == 0U)
+    {
+        return;
+    }
+
+    old_rec = slot_rec_get(p_hmap, slot);
+    new_rec = free_rec_take(p_hmap);
+
+    memcpy(value_ptr_get(p_hmap, new_rec), p_value, p_hmap->value_size);
+    slot_rec_publish(p_hmap, slot, new_rec);
+
+    free_rec_put(p_hmap, old_rec);
+}
+
+static void slot_delete(nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    uint16_t rec = slot_rec_get(p_hmap, slot);
+
+    slot_rec_publish(p_hmap, slot, REC_INVALID);
+
+    free_rec_put(p_hmap, rec);
+    p_hmap->keys_count--;
+}
+
+static void recs_reset(nrf_802154_hmap_t * p_hmap)
+{
+    uint16_t slots_count = slots_count_get(p_hmap);
+
+    for (uint16_t slot = 0U; slot < slots_count; slot++)
+    {
+        slot_rec_publish(p_hmap, slot, REC_INVALID);
+    }
+
+    for (uint16_t rec = 0U; rec <= p_hmap->capacity; rec++)
+    {
+        p_hmap->p_free_recs[rec] = rec;
+    }
+
+    p_hmap->free_recs_count = (uint16_t)(p_hmap->capacity + 1U);
+    p_hmap->keys_count      = 0U;
+}
+
+void nrf_802154_hmap_init(nrf_802154_hmap_t * p_hmap,
+                          size_t              key_size,
+                          size_t              value_size,
+                          size_t              capacity,
+                          void              * p_memory)
+{
+    NRF_802154_ASSERT(p_hmap != NULL);
+    NRF_802154_ASSERT((key_size != 0U) && (key_size <= UINT16_MAX));
+    NRF_802154_ASSERT(value_size <= UINT16_MAX);
+    NRF_802154_ASSERT(capacity < (UINT16_MAX / 2U));
+    NRF_802154_ASSERT(p_memory != NULL);
+    NRF_802154_ASSERT(((uintptr_t)p_memory % sizeof(uint16_t)) == 0U);
+
+    uint16_t buckets_count = (uint16_t)NRF_802154_HMAP_BUCKETS_COUNT(capacity);
+    size_t   slots_count   = buckets_count * NRF_802154_HMAP_BUCKET_SLOTS;
+    uint8_t * p_mem         = (uint8_t *)p_memory;
+
+    *p_hmap = (nrf_802154_hmap_t) {
+        .key_size        = (uint16_t)key_size,
+        .value_size      = (uint16_t)value_size,
+        .capacity        = (uint16_t)capacity,
+        .keys_count      = 0U,
+        .buckets_count   = buckets_count,
+        .free_recs_count = 0U,
+        .p_slot_recs     = (uint16_t *)p_mem,
+        .p_free_recs     = (uint16_t *)(p_mem + slots_count * sizeof(uint16_t)),
+        .p_keys          = p_mem + (slots_count + capacity + 1U) * sizeof(uint16_t),
+        .p_values        = p_mem + (slots_count + capacity + 1U) * sizeof(uint16_t) +
+                           slots_count * key_size,
+    };
+
+    recs_reset(p_hmap);
+}
+
+bool nrf_802154_hmap_rec_get(const nrf_802154_hmap_t * p_hmap,
+                             const void              * p_key,
+                             void                    * p_value)
+{
+    uint16_t buckets[KEY_BUCKETS];
+    uint16_t slot;
+
+    key_buckets_get(p_hmap, p_key, buckets);
+
+    if (!slot_search(p_hmap, p_key, buckets, &slot))
+    {
+        return false;
+    }
+
+    if ((p_hmap->value_size != 0U) && (p_value != NULL))
+    {
+        memcpy(p_value, value_ptr_get(p_hmap, slot_rec_get(p_hmap, slot)), p_hmap->value_size);
+    }
+
+    return true;
+}
+
+bool nrf_802154_hmap_rec_write(nrf_802154_hmap_t * p_hmap,
+                               const void        * p_key,
+                               const void        * p_value)
+{
+    uint16_t buckets[KEY_BUCKETS];
+    uint16_t slot;
+    uint16_t rec;
+
+    key_buckets_get(p_hmap, p_key, buckets);
+
+    if (slot_search(p_hmap, p_key, buckets, &slot))
+    {
+        /* The key exists, update in place. */
+        slot_value_update(p_hmap, slot, p_value);
+        return true;
+    }
+
+    if ((p_hmap->keys_count >= p_hmap->capacity) ||
+        !slot_for_insert_get(p_hmap, buckets, &slot))
+    {
+        /* The key does not exist and there is no room for a new entry. */
+        return false;
+    }
+
+    rec = free_rec_take(p_hmap);
+
+    memcpy(key_ptr_get(p_hmap, slot), p_key, p_hmap->key_size);
+    if (p_hmap->value_size != 0U)
+    {
+        memcpy(value_ptr_get(p_hmap, rec), p_value, p_hmap->value_size);
+    }
+
+    slot_rec_publish(p_hmap, slot, rec);
+    p_hmap->keys_count++;
+
+    return true;
+}
+
+bool nrf_802154_hmap_rec_delete(nrf_802154_hmap_t * p_hmap,
+                                const void        * p_key)
+{
+    uint16_t buckets[KEY_BUCKETS];
+    uint16_t slot;
+
+    key_buckets_get(p_hmap, p_key, buckets);
+
+    if (!slot_search(p_hmap, p_key, buckets, &slot))
+    {
+        return false;
+    }
+
+    slot_delete(p_hmap, slot);
+
+    return true;
+}
+
+void nrf_802154_hmap_clear(nrf_802154_hmap_t * p_hmap)
+{
+    recs_reset(p_hmap);
+}
+
+static uint16_t occupied_slot_find(const nrf_802154_hmap_t * p_hmap, uint16_t slot)
+{
+    uint16_t slots_count = slots_count_get(p_hmap);
+
+    while ((slot < slots_count) && (slot_rec_get(p_hmap, slot) == REC_INVALID))
+    {
+        slot++;
+    }
+
+    return slot;
+}
+
+void nrf_802154_hmap_iterator_begin(nrf_802154_hmap_t          * p_hmap,
+                                    nrf_802154_hmap_iterator_t * p_iter)
+{
+    NRF_802154_ASSERT(p_iter != NULL);
+
+    p_iter->p_hmap = p_hmap;
+    p_iter->slot   = occupied_slot_find(p_hmap, 0U);
+}
+
+bool nrf_802154_hmap_iterator_is_valid(const nrf_802154_hmap_iterator_t * p_iter)
+{
+    if (p_iter->p_hmap == NULL)
+    {
+        return false;
+    }
+
+    return p_iter->slot < slots_count_get(p_iter->p_hmap);
+}
+
+void nrf_802154_hmap_iterator_rec_key_get(const nrf_802154_hmap_iterator_t * p_iter,
+                                          void                             * p_key)
+{
+    const nrf_802154_hmap_t * p_hmap = p_iter->p_hmap;
+
+    memcpy(p_key, key_ptr_get(p_hmap, p_iter->slot), p_hmap->key_size);
+}
+
+void nrf_802154_hmap_iterator_rec_value_get(const nrf_802154_hmap_iterator_t * p_iter,
+                                            void                             * p_value)
+{
+    const nrf_802154_hmap_t * p_hmap = p_iter->p_hmap;
+
+    if (p_hmap->value_size != 0U)
+    {
+        memcpy(p_value,
+               value_ptr_get(p_hmap, slot_rec_get(p_hmap, p_iter->slot)),
+               p_hmap->value_size);
+    }
+}
+
+void nrf_802154_hmap_iterator_rec_value_write(const nrf_802154_hmap_iterator_t * p_iter,
+                                              const void                       * p_value)
+{
+    slot_value_update(p_iter->p_hmap, p_iter->slot, p_value);
+}
+
+void nrf_802154_hmap_iterator_rec_delete(const nrf_802154_hmap_iterator_t * p_iter)
+{
+    slot_delete(p_iter->p_hmap, p_iter->slot);
+}
+
+void nrf_802154_hmap_iterator_next(nrf_802154_hmap_iterator_t * p_iter)
+{
+    p_iter->slot = occupied_slot_find(p_iter->p_hmap, (uint16_t)(p_iter->slot + 1U));
+}
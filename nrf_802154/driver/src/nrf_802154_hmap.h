@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief This file defines an API for the Hash Map (HMAP) module of the
+ *        nRF 802.15.4 Radio Driver.
+ *
+ * @details
+ * The HMAP module provides a key-to-value mapping using a hash table.
+ * It is designed to look up data associated with a given key as fast as possible,
+ * from a high priority interrupt, in a time that does not depend on the number of
+ * stored entries.
+ *
+ * Each key can be stored in one of two buckets selected by the hash of the key. Each bucket
+ * has @ref NRF_802154_HMAP_BUCKET_SLOTS slots, so a lookup compares at most
+ * 2 * @ref NRF_802154_HMAP_BUCKET_SLOTS keys. When both buckets of a new key are full,
+ * the entries are relocated to their alternative buckets (cuckoo hashing) to make room.
+ * The table has about twice as many slots as the capacity of the map, which keeps the
+ * relocations short.
+ *
+ * Modification (add, remove, update value) is expected to be performed from
+ * priorities lower or equal than lookups and it is thread-safe with respect
+ * to high priority look ups. Entries and values are written to memory not visible
+ * to lookups and published with a single store.
+ * Modifications are not thread-safe with respect to each other. It is the caller's
+ * responsibility to ensure thread-safety for this case. They are not intended to
+ * be used from high priority interrupts.
+ */
+
+#ifndef NRF_802154_HMAP_H_
+#define NRF_802154_HMAP_H_
+
+#include <nrfx.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Number of slots in a single bucket of the HMAP.
+ */
+#define NRF_802154_HMAP_BUCKET_SLOTS 4U
+
+/**
+ * @brief Type for object representing the HMAP.
+ *
+ * @note Do not modify the fields directly, use the API functions only.
+ */
+typedef struct
+{
+    /**
+     * @brief Size of each key, in bytes.
+     */
+    uint16_t key_size;
+
+    /**
+     * @brief Size of each value associated with a key, in bytes.
+     */
+    uint16_t value_size;
+
+    /**
+     * @brief Maximum number of entries the map can hold.
+     */
+    uint16_t capacity;
+
+    /**
+     * @brief Number of entries stored in the map.
+     */
+    uint16_t keys_count;
+
+    /**
+     * @brief Number of buckets of the hash table.
+     */
+    uint16_t buckets_count;
+
+    /**
+     * @brief Number of unused value records on the free records stack.
+     */
+    uint16_t free_recs_count;
+
+    /**
+     * @brief Value record index of each slot, or a sentinel if the slot is empty.
+     */
+    uint16_t * p_slot_recs;
+
+    /**
+     * @brief Stack of indexes of unused value records.
+     */
+    uint16_t * p_free_recs;
+
+    /**
+     * @brief Key of each slot.
+     */
+    uint8_t * p_keys;
+
+    /**
+     * @brief Value records. There is one more record than @c capacity, so that a value
+     *        of an existing entry can be updated out of place.
+     */
+    uint8_t * p_values;
+} nrf_802154_hmap_t;
+
+/**
+ * @brief Type of an iterator used to iterate over the HMAP.
+ *
+ * @note Do not modify the fields directly, use the API functions only.
+ */
+typedef struct
+{
+    /**
+     * @brief Index of the slot the iterator points to.
+     */
+    uint16_t slot;
+    /**
+     * @brief Pointer to the HMAP the iterator is iterating over.
+     */
+    nrf_802154_hmap_t * p_hmap;
+} nrf_802154_hmap_iterator_t;
+
+/**
+ * @brief Calculate the number of buckets of the HMAP.
+ *
+ * This macro is internal but provided for @ref NRF_802154_HMAP_MEMORY_SIZE.
+ *
+ * @param[in] capacity   The capacity (maximum number of keys) of the HMAP.
+ */
+#define NRF_802154_HMAP_BUCKETS_COUNT(capacity) (((capacity) / 2U) + 1U)
+
+/**
+ * @brief Calculate the size of the memory needed to store the HMAP.
+ *
+ * @param[in] key_size   The size of the key in bytes.
+ * @param[in] value_size The size of the value associated with the key in bytes.
+ * @param[in] capacity   The capacity (maximum number of keys) of the HMAP.
+ */
+#define NRF_802154_HMAP_MEMORY_SIZE(key_size, value_size, capacity)                     \
+    ((NRF_802154_HMAP_BUCKETS_COUNT(capacity) * NRF_802154_HMAP_BUCKET_SLOTS *          \
+      (sizeof(uint16_t) + (key_size))) +                                                \
+     (((capacity) + 1U) * (sizeof(uint16_t) + (value_size))))
+
+/**
+ * @brief Initialize the HMAP object.
+ *
+ * @param[out] p_hmap           Pointer to the HMAP object to initialize.
+ * @param[in]  key_size         The size of the key in bytes. Must be greater than 0
+ *                              and no more than @c UINT16_MAX .
+ * @param[in]  value_size       The size of the value associated with the key in bytes.
+ *                              If 0, the HMAP will store only keys.
+ *                              Must not be more than @c UINT16_MAX .
+ * @param[in]  capacity         The capacity (maximum number of keys) of the HMAP.
+ *                              Must be less than @c UINT16_MAX / 2 .
+ * @param[in]  p_memory         Pointer to a memory storage for the HMAP aligned to
+ *                              @c uint16_t . Must be able to store
+ *                              @ref NRF_802154_HMAP_MEMORY_SIZE bytes.
+ */
+void nrf_802154_hmap_init(nrf_802154_hmap_t * p_hmap,
+                          size_t              key_size,
+                          size_t              value_size,
+                          size_t              capacity,
+                          void              * p_memory);
+
+/**
+ * @brief Search for a record associated with the key in the HMAP and copy the associated value
+ *        into @p p_value if found.
+ *
+ * This function is optimized for high priority execution and is thread-safe with
+ * respect to low priority modifications of the HMAP performed by
+ * @ref nrf_802154_hmap_rec_write and @ref nrf_802154_hmap_rec_delete functions.
+ * It compares at most 2 * @ref NRF_802154_HMAP_BUCKET_SLOTS keys.
+ *
+ * @param[in]  p_hmap       Pointer to the HMAP object to search in.
+ * @param[in]  p_key        Pointer to the key to search for. Must not be NULL.
+ * @param[out] p_value      Pointer to a variable where the value associated with the key
+ *                          will be stored if the key is found. If NULL or the map does not store
+ *                          values, just a search is performed without retrieving
+ *                          the value. If not NULL, must point to a storage large enough
+ *                          to store @c value_size bytes as passed to the
+ *                          @ref nrf_802154_hmap_init function.
+ *
+ * @retval true  If the key was found in the HMAP.
+ *               If @p p_value is not @c NULL, the value associated with the key is stored in it.
+ * @retval false If the key was not found in the HMAP.
+ */
+bool nrf_802154_hmap_rec_get(const nrf_802154_hmap_t * p_hmap,
+                             const void              * p_key,
+                             void                    * p_value);
+
+/**
+ * @brief Write a record associated with a key into the HMAP.
+ *
+ * If the key is not found in the HMAP, a new entry is inserted into the HMAP with
+ * provided key and value. If the key is found in the HMAP, the value associated with
+ * the key is updated with the provided value.
+ *
+ * This function is optimized for low priority execution. It is thread-safe with respect to
+ * high priority lookups performed by the @ref nrf_802154_hmap_rec_get function.
+ * This function is not thread-safe with respect to itself or
+ * @ref nrf_802154_hmap_rec_delete.
+ *
+ * @param[in] p_hmap   Pointer to the HMAP object to write to.
+ * @param[in] p_key    Pointer to the key to write. Must not be NULL.
+ * @param[in] p_value  Pointer to the value to write. If the HMAP is initialized with
+ *                     @c value_size equal to 0, this parameter is ignored and can
+ *                     be NULL. Otherwise this parameter must not be NULL and must point
+ *                     to a storage containing @c value_size bytes as passed to the
+ *                     @ref nrf_802154_hmap_init function.
+ *
+ * @retval true  If the record was successfully written to the HMAP.
+ * @retval false If the record was not written to the HMAP because the HMAP is full or
+ *               no slot could be freed in the buckets of the key.
+ */
+bool nrf_802154_hmap_rec_write(nrf_802154_hmap_t * p_hmap,
+                               const void        * p_key,
+                               const void        * p_value);
+
+/**
+ * @brief Delete a record associated with a key from the HMAP.
+ *
+ * This function is optimized for low priority execution. It is thread-safe with respect to
+ * high priority lookups performed by the @ref nrf_802154_hmap_rec_get function.
+ *
+ * This function is not thread-safe with respect to itself or
+ * @ref nrf_802154_hmap_rec_write.
+ *
+ * @param[in] p_hmap   Pointer to the HMAP object to delete from.
+ * @param[in] p_key    Pointer to the key to delete. Must not be NULL.
+ *
+ * @retval true  If the record was found and deleted from the HMAP.
+ * @retval false If the record was not found in the HMAP. This result means also that the goal of
+ *               the function (not having the key in the HMAP) is achieved.
+ *               This does not necessarily mean that there is an error.
+ */
+bool nrf_802154_hmap_rec_delete(nrf_802154_hmap_t * p_hmap,
+                                const void        * p_key);
+
+/**
+ * @brief Remove all entries from the HMAP.
+ *
+ * @param[in] p_hmap Pointer to the HMAP object to clear.
+ */
+void nrf_802154_hmap_clear(nrf_802154_hmap_t * p_hmap);
+
+/**
+ * @brief Start iteration over the HMAP.
+ *
+ * The entries are visited in an unspecified order.
+ *
+ * To check if iterator is valid (end not reached), call the
+ * @ref nrf_802154_hmap_iterator_is_valid function.
+ *
+ * To retrieve data through iterator, call the @ref nrf_802154_hmap_iterator_rec_key_get and
+ * @ref nrf_802154_hmap_iterator_rec_value_get functions.
+ *
+ * To manipulate the HMAP through the iterator, call the functions
+ * @ref nrf_802154_hmap_iterator_rec_value_write and
+ * @ref nrf_802154_hmap_iterator_rec_delete. No other modifications of the HMAP are allowed
+ * during the iteration.
+ *
+ * To move the iterator to the next entry, call the @ref nrf_802154_hmap_iterator_next function.
+ *
+ * @param[in]  p_hmap   Pointer to the HMAP object to iterate over.
+ * @param[out] p_iter   Pointer to an iterator that will be prepared for iteration.
+ */
+void nrf_802154_hmap_iterator_begin(nrf_802154_hmap_t          * p_hmap,
+                                    nrf_802154_hmap_iterator_t * p_iter);
+
+/**
+ * @brief Check if iterator points to an existing item in the HMAP.
+ *
+ * @param[in] p_iter    Pointer to an iterator to check.
+ *
+ * @retval false     The iterator does not describe any valid HMAP entry, "end" of iteration
+ *                   reached.
+ * @retval true      The iterator describes a valid HMAP entry, "end" of iteration not reached
+ *                   yet.
+ */
+bool nrf_802154_hmap_iterator_is_valid(const nrf_802154_hmap_iterator_t * p_iter);
+
+/**
+ * @brief Get the key part of record at given iterator.
+ *
+ * @note The iterator must be valid by @ref nrf_802154_hmap_iterator_is_valid.
+ *
+ * @param[in]  p_iter  Pointer to an iterator at which to read the record.
+ * @param[out] p_key   Pointer to the buffer where the key of record is to be read into.
+ */
+void nrf_802154_hmap_iterator_rec_key_get(const nrf_802154_hmap_iterator_t * p_iter,
+                                          void                             * p_key);
+
+/**
+ * @brief Get the value part of record at given iterator.
+ *
+ * @note The iterator must be valid by @ref nrf_802154_hmap_iterator_is_valid.
+ *
+ * @param[in]  p_iter  Pointer to an iterator at which to read the record.
+ * @param[out] p_value Pointer to the buffer where the value of record is to be read into.
+ *                     If @c value_size passed to the @ref nrf_802154_hmap_init function is 0,
+ *                     this parameter is ignored and can be NULL.
+ */
+void nrf_802154_hmap_iterator_rec_value_get(const nrf_802154_hmap_iterator_t * p_iter,
+                                            void                             * p_value);
+
+/**
+ * @brief Write the value part of record at given iterator.
+ *
+ * @note The iterator must be valid by @ref nrf_802154_hmap_iterator_is_valid.
+ *
+ * @param[in] p_iter        Pointer to an iterator at which the record value to write.
+ * @param[in] p_value       Pointer to the buffer containing the value to write.
+ *                          If @c value_size passed to the @ref nrf_802154_hmap_init function is
+ *                          zero, this parameter is ignored and can be NULL.
+ */
+void nrf_802154_hmap_iterator_rec_value_write(const nrf_802154_hmap_iterator_t * p_iter,
+                                              const void                       * p_value);
+
+/**
+ * @brief Delete a record at given iterator.
+ *
+ * @note The iterator must be valid by @ref nrf_802154_hmap_iterator_is_valid.
+ * After the entry is deleted, the only allowed next call is @ref nrf_802154_hmap_iterator_next.
+ *
+ * @param[in]  p_iter       Pointer to an iterator at which the record is to be deleted.
+ */
+void nrf_802154_hmap_iterator_rec_delete(const nrf_802154_hmap_iterator_t * p_iter);
+
+/**
+ * @brief Move the HMAP iterator to the next entry.
+ *
+ * @param[inout] p_iter    Pointer to an iterator to move.
+ */
+void nrf_802154_hmap_iterator_next(nrf_802154_hmap_iterator_t * p_iter);
+
+#endif /* NRF_802154_HMAP_H_ */
@@ -54,6 +54,7 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_utils.h"
@@ -171,6 +172,9 @@ typedef struct
             uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the received frame.
             int8_t    power;  ///< RSSI of received frame.
             uint8_t   lqi;    ///< LQI of received frame.
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+            uint64_t  time;   ///< Timestamp of the end of the received frame.
+#endif
         } received;           ///< Received frame details.
 
         struct
@@ -235,6 +239,13 @@ static volatile bool m_notifications_blocked = false;
 
 #endif /* NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED */
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+
+/** @brief Notifications collected from the queue to be delivered in a single batch. */
+static nrf_802154_batch_ntf_t m_ntf_batch[NRF_802154_NOTIFICATION_BATCH_SIZE];
+
+#endif /* NRF_802154_NOTIFICATION_BATCH_ENABLED */
+
 #if (NRF_802154_MAX_PENDING_NOTIFICATIONS + 1) != (NTF_QUEUE_SIZE)
 #error "Mismatching sizes of notification queue and maximum number of pending notifications"
 #endif
@@ -331,12 +342,30 @@ static void ntf_exit(void)
     nrf_802154_mcu_critical_exit(m_mcu_cs);
 }
 
+/** @brief Get the data slot identified by the pool and slot identifier.
+ *
+ * @param[in]  slot_id  Identifier of the pool and a slot within.
+ *
+ * @return Pointer to the data slot in the pool.
+ */
+static nrf_802154_ntf_data_t * ntf_slot_get(uint8_t slot_id)
+{
+    uint8_t slot_idx = slot_id & (~NTF_POOL_ID_MASK);
+
+    return (slot_id & NTF_POOL_ID_MASK) ? &m_primary_ntf_pool[slot_idx] :
+           &m_secondary_ntf_pool[slot_idx];
+}
+
 /** @brief Push notification to the queue.
  *
  * @param[in]  slot_id  Identifier of the pool and a slot within.
  */
 static void ntf_push(uint8_t slot_id)
 {
+    nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_NTF_ENQUEUE,
+                                ntf_slot_get(slot_id)->type);
+
     nrf_802154_queue_entry_t * p_entry = ntf_enter();
 
     p_entry->id = slot_id;
@@ -354,10 +383,7 @@ static nrf_802154_ntf_data_t * ntf_queue_pop_and_get_data_slot(const nrf_802154_
     nrf_802154_queue_entry_t * p_entry =
         (nrf_802154_queue_entry_t *)nrf_802154_queue_pop_begin(p_queue);
 
-    uint8_t slot_id = p_entry->id & (~NTF_POOL_ID_MASK);
-
-    return (p_entry->id & NTF_POOL_ID_MASK) ? &m_primary_ntf_pool[slot_id] :
-           &m_secondary_ntf_pool[slot_id];
+    return ntf_slot_get(p_entry->id);
 }
 
 #if NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED
@@ -377,6 +403,91 @@ static void free_ack_buffer(const nrf_802154_transmit_done_metadata_t * p_metada
 
 #endif /* NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED */
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+
+/** @brief Copy a notification to the batch if its type can be delivered in a batch.
+ *
+ * @param[in]   p_slot  Pointer to the data slot of the notification.
+ * @param[out]  p_ntf   Pointer to the batch entry to fill.
+ *
+ * @retval  true   The notification was copied to the batch.
+ * @retval  false  The notification must be delivered by its own callout.
+ */
+static bool ntf_batch_add(const nrf_802154_ntf_data_t * p_slot, nrf_802154_batch_ntf_t * p_ntf)
+{
+    switch (p_slot->type)
+    {
+        case NTF_TYPE_RECEIVED:
+            p_ntf->type                 = NRF_802154_BATCH_NTF_RECEIVED;
+            p_ntf->data.received.p_data = p_slot->data.received.p_data;
+            p_ntf->data.received.power  = p_slot->data.received.power;
+            p_ntf->data.received.lqi    = p_slot->data.received.lqi;
+            p_ntf->data.received.time   = p_slot->data.received.time;
+            return true;
+
+        case NTF_TYPE_TRANSMITTED:
+            p_ntf->type                      = NRF_802154_BATCH_NTF_TRANSMITTED;
+            p_ntf->data.transmitted.p_frame  = p_slot->data.transmitted.p_frame;
+            p_ntf->data.transmitted.metadata = p_slot->data.transmitted.metadata;
+            return true;
+
+        case NTF_TYPE_TRANSMIT_FAILED:
+            p_ntf->type                          = NRF_802154_BATCH_NTF_TRANSMIT_FAILED;
+            p_ntf->data.transmit_failed.p_frame  = p_slot->data.transmit_failed.p_frame;
+            p_ntf->data.transmit_failed.error    = p_slot->data.transmit_failed.error;
+            p_ntf->data.transmit_failed.metadata = p_slot->data.transmit_failed.metadata;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+#if NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED
+
+/** @brief Release the buffers of the notifications collected in the batch without delivering them.
+ *
+ * @param[in]  count  Number of notifications in the batch.
+ */
+static void ntf_batch_drop(uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (m_ntf_batch[i].type == NRF_802154_BATCH_NTF_RECEIVED)
+        {
+            nrf_802154_buffer_free_raw(m_ntf_batch[i].data.received.p_data);
+        }
+        else if (m_ntf_batch[i].type == NRF_802154_BATCH_NTF_TRANSMITTED)
+        {
+            free_ack_buffer(&m_ntf_batch[i].data.transmitted.metadata);
+        }
+    }
+}
+
+#endif /* NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED */
+
+/** @brief Deliver the notifications collected in the batch.
+ *
+ * The slots of the batched notifications are already freed, so a flush of the notification
+ * queue cannot remove them. If notifications got blocked, the batch is dropped instead.
+ *
+ * @param[in]  count  Number of notifications in the batch.
+ */
+static void ntf_batch_deliver(uint8_t count)
+{
+#if NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED
+    if (m_notifications_blocked)
+    {
+        ntf_batch_drop(count);
+        return;
+    }
+#endif
+
+    nrf_802154_co_notifications_batch(m_ntf_batch, count);
+}
+
+#endif /* NRF_802154_NOTIFICATION_BATCH_ENABLED */
+
 /**
  * @brief Notifies the next higher layer that a frame was received.
  *
@@ -405,6 +516,10 @@ bool swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
     p_slot->data.received.p_data = p_data;
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+    // The timestamp of the last received frame is overwritten by the next frame, take it now
+    p_slot->data.received.time = nrf_802154_stat_timestamp_read_last_rx_end_timestamp();
+#endif
 
     ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
 
@@ -777,13 +892,26 @@ static void irq_handler_ntf_event(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+    uint8_t batch_len = 0;
+#endif
+
     while (!nrf_802154_queue_is_empty(&m_notifications_queue))
     {
         nrf_802154_ntf_data_t * p_slot = ntf_queue_pop_and_get_data_slot(&m_notifications_queue);
 
+        nrf_802154_log_global_event(NRF_802154_LOG_VERBOSITY_HIGH,
+                                    NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_NTF_DELIVER,
+                                    p_slot->type);
+
 #if NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED
         if (m_notifications_blocked)
         {
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+            ntf_batch_drop(batch_len);
+            batch_len = 0;
+#endif
+
             if (p_slot->type == NTF_TYPE_RECEIVED)
             {
                 nrf_802154_buffer_free_raw(p_slot->data.received.p_data);
@@ -800,6 +928,30 @@ static void irq_handler_ntf_event(void)
         }
 #endif /* NRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED */
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+        if (ntf_batch_add(p_slot, &m_ntf_batch[batch_len]))
+        {
+            // The notification is copied, so the slot can be reused before the batch is delivered
+            nrf_802154_queue_pop_commit(&m_notifications_queue);
+            ntf_slot_free(p_slot);
+
+            if (++batch_len == NRF_802154_NOTIFICATION_BATCH_SIZE)
+            {
+                ntf_batch_deliver(batch_len);
+                batch_len = 0;
+            }
+
+            continue;
+        }
+
+        // Keep the order of notifications: deliver the batch before the current notification
+        if (batch_len != 0)
+        {
+            ntf_batch_deliver(batch_len);
+            batch_len = 0;
+        }
+#endif /* NRF_802154_NOTIFICATION_BATCH_ENABLED */
+
         switch (p_slot->type)
         {
             case NTF_TYPE_RECEIVED:
@@ -849,6 +1001,13 @@ static void irq_handler_ntf_event(void)
         ntf_slot_free(p_slot);
     }
 
+#if NRF_802154_NOTIFICATION_BATCH_ENABLED
+    if (batch_len != 0)
+    {
+        ntf_batch_deliver(batch_len);
+    }
+#endif
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
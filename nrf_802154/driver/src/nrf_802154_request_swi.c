@@ -50,8 +50,8 @@
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_peripherals.h"
-#include "nrf_802154_queue.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_utils.h"
 #include "mac_features/nrf_802154_csma_ca.h"
@@ -62,11 +62,7 @@
 
 #include <nrfx.h>
 
-/** Size of requests queue.
- *
- * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
- */
-#define REQ_QUEUE_SIZE 2
+#define REQ_QUEUE_SIZE NRF_802154_REQUEST_QUEUE_SIZE
 
 #define REQ_INT        NRFX_CONCAT_2(NRF_EGU_INT_TRIGGERED, NRF_802154_EGU_REQUEST_CHANNEL_NO)
 #define REQ_TASK       NRFX_CONCAT_2(NRF_EGU_TASK_TRIGGER, NRF_802154_EGU_REQUEST_CHANNEL_NO)
@@ -98,10 +94,20 @@ typedef enum
     REQ_TYPE_CSMA_CA_START,
 } nrf_802154_req_type_t;
 
+/// States of a slot in request queue.
+typedef enum
+{
+    REQ_SLOT_FREE,    ///< Slot is not used.
+    REQ_SLOT_CLAIMED, ///< Slot is being filled by the request issuer.
+    REQ_SLOT_PENDING, ///< Request is ready to be processed by SWI.
+    REQ_SLOT_DONE,    ///< Request was processed and its result is written.
+} nrf_802154_req_slot_state_t;
+
 /// Request data in request queue.
 typedef struct
 {
-    nrf_802154_req_type_t type; ///< Type of the request.
+    volatile uint8_t      state; ///< State of the slot. Serves as the completion record of the request.
+    nrf_802154_req_type_t type;  ///< Type of the request.
 
     union
     {
@@ -238,45 +244,89 @@ typedef struct
     } data;              ///< Request data depending on its type.
 } nrf_802154_req_data_t;
 
-/**@brief Instance of a requests queue */
-static nrf_802154_queue_t m_requests_queue;
-
-/**@brief Memory holding requests queue items */
-static nrf_802154_req_data_t m_requests_queue_memory[REQ_QUEUE_SIZE];
-
-/**@brief State of the MCU critical section */
-static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
+/**@brief Slots of the request queue
+ *
+ * Each request issuer claims a free slot, fills it and marks it pending. The SWI handler processes
+ * every pending slot regardless of the slots still being filled, so an issuer preempted while
+ * filling its slot does not delay the requests issued from higher priorities.
+ */
+static nrf_802154_req_data_t m_requests_queue[REQ_QUEUE_SIZE];
 
 /**
  * Enter request block.
  *
  * This is a helper function used in all request functions to atomically
- * find an empty slot in request queue and allow atomic slot update.
+ * claim an empty slot in request queue. Interrupts are not disabled while the slot is filled.
  *
  * @return Pointer to an empty slot in the request queue.
  */
 static nrf_802154_req_data_t * req_enter(void)
 {
-    m_mcu_cs = nrf_802154_mcu_critical_enter();
+    nrf_802154_req_data_t * p_slot     = NULL;
+    bool                    overtaking = false;
 
-    NRF_802154_ASSERT(!nrf_802154_queue_is_full(&m_requests_queue));
+    for (size_t i = 0; i < REQ_QUEUE_SIZE; i++)
+    {
+        bool slot_found = true;
+
+        do
+        {
+            uint8_t state = __LDREXB(&m_requests_queue[i].state);
+
+            if (state != REQ_SLOT_FREE)
+            {
+                // Slot claimed by an issuer preempted by this one. Proceed to the next slot
+                __CLREX();
+                slot_found = false;
+                overtaking = overtaking || (state == REQ_SLOT_CLAIMED);
+                break;
+            }
+        }
+        while (__STREXB(REQ_SLOT_CLAIMED, &m_requests_queue[i].state));
+
+        __DMB();
+
+        if (slot_found)
+        {
+            p_slot = &m_requests_queue[i];
+            break;
+        }
+    }
 
-    return (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(&m_requests_queue);
+    NRF_802154_ASSERT(p_slot != NULL);
+
+    if (overtaking)
+    {
+        nrf_802154_stat_counter_increment_request_inversions();
+    }
+
+    return p_slot;
 }
 
 /**
  * Exit request block.
  *
- * This is a helper function used in all request functions to end atomic slot update
- * and trigger SWI to process the request from the slot.
+ * This is a helper function used in all request functions to publish the filled slot,
+ * trigger SWI to process the request from the slot and release the slot once the request
+ * is completed.
+ *
+ * @param[in]  p_slot  Pointer to the slot returned by @ref req_enter.
  */
-static void req_exit(void)
+static void req_exit(nrf_802154_req_data_t * p_slot)
 {
-    nrf_802154_queue_push_commit(&m_requests_queue);
+    __DMB();
+    p_slot->state = REQ_SLOT_PENDING;
 
     nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, REQ_TASK);
 
-    nrf_802154_mcu_critical_exit(m_mcu_cs);
+    // SWI has higher priority than the issuer, so the request is completed right after the trigger
+    while (p_slot->state != REQ_SLOT_DONE)
+    {
+        // Intentionally empty
+    }
+
+    __DMB();
+    p_slot->state = REQ_SLOT_FREE;
 }
 
 /** Assert if SWI interrupt is disabled. */
@@ -341,7 +391,7 @@ static void swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
     p_slot->data.sleep.term_lvl = term_lvl;
     p_slot->data.sleep.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #if NRF_802154_CSMA_CA_CANCEL_ENABLED
@@ -361,7 +411,7 @@ static void swi_sleep_with_cancel_csma_ca(nrf_802154_term_t term_lvl, bool * p_r
     p_slot->data.sleep.term_lvl = term_lvl;
     p_slot->data.sleep.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #endif /* NRF_802154_CSMA_CA_CANCEL_ENABLED */
@@ -393,7 +443,7 @@ static void swi_receive(nrf_802154_term_t              term_lvl,
     p_slot->data.receive.id          = id;
     p_slot->data.receive.p_result    = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -422,7 +472,7 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
     p_slot->data.transmit.p_params = p_params;
     p_slot->data.transmit.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 static void swi_ack_timeout_handle(const nrf_802154_ack_timeout_handle_params_t * p_param,
@@ -434,7 +484,7 @@ static void swi_ack_timeout_handle(const nrf_802154_ack_timeout_handle_params_t
     p_slot->data.ack_timeout_handle.p_param  = p_param;
     p_slot->data.ack_timeout_handle.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -455,7 +505,7 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
     p_slot->data.energy_detection.time_us  = time_us;
     p_slot->data.energy_detection.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -472,7 +522,7 @@ static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
     p_slot->data.cca.term_lvl = term_lvl;
     p_slot->data.cca.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -491,7 +541,7 @@ static void swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_result)
     p_slot->data.continuous_carrier.term_lvl = term_lvl;
     p_slot->data.continuous_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -512,7 +562,7 @@ static void swi_modulated_carrier(nrf_802154_term_t term_lvl,
     p_slot->data.modulated_carrier.p_data   = p_data;
     p_slot->data.modulated_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -532,7 +582,7 @@ static void swi_buffer_free(uint8_t * p_data, bool * p_result)
     p_slot->data.buffer_free.p_data   = p_data;
     p_slot->data.buffer_free.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -548,7 +598,7 @@ static void swi_antenna_update(bool * p_result)
     p_slot->type                         = REQ_TYPE_ANTENNA_UPDATE;
     p_slot->data.antenna_update.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -565,7 +615,7 @@ static void swi_channel_update(req_originator_t req_orig, bool * p_result)
     p_slot->data.channel_update.p_result = p_result;
     p_slot->data.channel_update.req_orig = req_orig;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -581,7 +631,7 @@ static void swi_cca_cfg_update(bool * p_result)
     p_slot->type                         = REQ_TYPE_CCA_CFG_UPDATE;
     p_slot->data.cca_cfg_update.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -597,7 +647,7 @@ static void swi_rssi_measure(bool * p_result)
     p_slot->type                       = REQ_TYPE_RSSI_MEASURE;
     p_slot->data.rssi_measure.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 /**
@@ -615,7 +665,7 @@ static void swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
     p_slot->data.rssi_get.p_rssi   = p_rssi;
     p_slot->data.rssi_get.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #if NRF_802154_DELAYED_TRX_ENABLED
@@ -632,7 +682,7 @@ static void swi_transmit_at(const nrf_802154_frame_t                * p_frame,
     p_slot->data.transmit_at.p_metadata = p_metadata;
     p_slot->data.transmit_at.p_result   = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 static void swi_transmit_at_cancel(bool * p_result)
@@ -642,7 +692,7 @@ static void swi_transmit_at_cancel(bool * p_result)
     p_slot->type                             = REQ_TYPE_TRANSMIT_AT_CANCEL;
     p_slot->data.transmit_at_cancel.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 static void swi_receive_at(uint64_t rx_time,
@@ -660,7 +710,7 @@ static void swi_receive_at(uint64_t rx_time,
     p_slot->data.receive_at.id       = id;
     p_slot->data.receive_at.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 static void swi_receive_at_cancel(uint32_t id, bool * p_result)
@@ -671,7 +721,7 @@ static void swi_receive_at_cancel(uint32_t id, bool * p_result)
     p_slot->data.receive_at_cancel.id       = id;
     p_slot->data.receive_at_cancel.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 static void swi_receive_at_scheduled_cancel(uint32_t id, bool * p_result)
@@ -682,7 +732,7 @@ static void swi_receive_at_scheduled_cancel(uint32_t id, bool * p_result)
     p_slot->data.receive_at_cancel.id       = id;
     p_slot->data.receive_at_cancel.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
@@ -698,15 +748,15 @@ static void swi_csma_ca_start(const nrf_802154_frame_t                     * p_f
     p_slot->data.csma_ca_start.p_metadata = p_metadata;
     p_slot->data.csma_ca_start.p_result   = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_request_init(void)
 {
-    nrf_802154_queue_init(&m_requests_queue,
-                          m_requests_queue_memory,
-                          sizeof(m_requests_queue_memory),
-                          sizeof(m_requests_queue_memory[0]));
+    for (size_t i = 0; i < REQ_QUEUE_SIZE; i++)
+    {
+        m_requests_queue[i].state = REQ_SLOT_FREE;
+    }
 
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, REQ_INT);
 }
@@ -891,152 +941,178 @@ nrf_802154_tx_error_t nrf_802154_request_csma_ca_start(
                      p_metadata);
 }
 
-/**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
-static void irq_handler_req_event(void)
+/**@brief Processes a single pending request and writes its result.
+ *
+ * @param[in]  p_slot  Pointer to the slot holding the request.
+ */
+static void req_process(nrf_802154_req_data_t * p_slot)
 {
-    while (!nrf_802154_queue_is_empty(&m_requests_queue))
+    switch (p_slot->type)
     {
-        nrf_802154_req_data_t * p_slot =
-            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
-
-        switch (p_slot->type)
-        {
-            case REQ_TYPE_SLEEP:
-                *(p_slot->data.sleep.p_result) =
-                    nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
-                break;
+        case REQ_TYPE_SLEEP:
+            *(p_slot->data.sleep.p_result) =
+                nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
+            break;
 
 #if NRF_802154_CSMA_CA_CANCEL_ENABLED
 
-            case REQ_TYPE_SLEEP_WITH_CANCEL_CSMA_CA:
-                *(p_slot->data.sleep.p_result) =
-                    nrf_802154_core_sleep_with_cancel_csma_ca(p_slot->data.sleep.term_lvl);
-                break;
+        case REQ_TYPE_SLEEP_WITH_CANCEL_CSMA_CA:
+            *(p_slot->data.sleep.p_result) =
+                nrf_802154_core_sleep_with_cancel_csma_ca(p_slot->data.sleep.term_lvl);
+            break;
 
 #endif /* NRF_802154_CSMA_CA_CANCEL_ENABLED */
 
-            case REQ_TYPE_RECEIVE:
-                *(p_slot->data.receive.p_result) =
-                    nrf_802154_core_receive(p_slot->data.receive.term_lvl,
-                                            p_slot->data.receive.req_orig,
-                                            p_slot->data.receive.notif_func,
-                                            p_slot->data.receive.notif_abort,
-                                            p_slot->data.receive.id);
-                break;
-
-            case REQ_TYPE_TRANSMIT:
-                *(p_slot->data.transmit.p_result) =
-                    nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
-                                             p_slot->data.transmit.req_orig,
-                                             p_slot->data.transmit.p_params);
-                break;
-
-            case REQ_TYPE_ACK_TIMEOUT_HANDLE:
-                *(p_slot->data.ack_timeout_handle.p_result) =
-                    nrf_802154_core_ack_timeout_handle(p_slot->data.ack_timeout_handle.p_param);
-                break;
-
-            case REQ_TYPE_ENERGY_DETECTION:
-                *(p_slot->data.energy_detection.p_result) =
-                    nrf_802154_core_energy_detection(
-                        p_slot->data.energy_detection.term_lvl,
-                        p_slot->data.energy_detection.time_us);
-                break;
-
-            case REQ_TYPE_CCA:
-                *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
-                break;
+        case REQ_TYPE_RECEIVE:
+            *(p_slot->data.receive.p_result) =
+                nrf_802154_core_receive(p_slot->data.receive.term_lvl,
+                                        p_slot->data.receive.req_orig,
+                                        p_slot->data.receive.notif_func,
+                                        p_slot->data.receive.notif_abort,
+                                        p_slot->data.receive.id);
+            break;
+
+        case REQ_TYPE_TRANSMIT:
+            *(p_slot->data.transmit.p_result) =
+                nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
+                                         p_slot->data.transmit.req_orig,
+                                         p_slot->data.transmit.p_params);
+            break;
+
+        case REQ_TYPE_ACK_TIMEOUT_HANDLE:
+            *(p_slot->data.ack_timeout_handle.p_result) =
+                nrf_802154_core_ack_timeout_handle(p_slot->data.ack_timeout_handle.p_param);
+            break;
+
+        case REQ_TYPE_ENERGY_DETECTION:
+            *(p_slot->data.energy_detection.p_result) =
+                nrf_802154_core_energy_detection(
+                    p_slot->data.energy_detection.term_lvl,
+                    p_slot->data.energy_detection.time_us);
+            break;
+
+        case REQ_TYPE_CCA:
+            *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
+            break;
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-            case REQ_TYPE_CONTINUOUS_CARRIER:
-                *(p_slot->data.continuous_carrier.p_result) =
-                    nrf_802154_core_continuous_carrier(
-                        p_slot->data.continuous_carrier.term_lvl);
-                break;
+        case REQ_TYPE_CONTINUOUS_CARRIER:
+            *(p_slot->data.continuous_carrier.p_result) =
+                nrf_802154_core_continuous_carrier(
+                    p_slot->data.continuous_carrier.term_lvl);
+            break;
 
-            case REQ_TYPE_MODULATED_CARRIER:
-                *(p_slot->data.modulated_carrier.p_result) =
-                    nrf_802154_core_modulated_carrier(p_slot->data.modulated_carrier.term_lvl,
-                                                      p_slot->data.modulated_carrier.p_data);
-                break;
+        case REQ_TYPE_MODULATED_CARRIER:
+            *(p_slot->data.modulated_carrier.p_result) =
+                nrf_802154_core_modulated_carrier(p_slot->data.modulated_carrier.term_lvl,
+                                                  p_slot->data.modulated_carrier.p_data);
+            break;
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-            case REQ_TYPE_BUFFER_FREE:
-                *(p_slot->data.buffer_free.p_result) =
-                    nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
-                break;
+        case REQ_TYPE_BUFFER_FREE:
+            *(p_slot->data.buffer_free.p_result) =
+                nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
+            break;
 
-            case REQ_TYPE_CHANNEL_UPDATE:
-                *(p_slot->data.channel_update.p_result) =
-                    nrf_802154_core_channel_update(p_slot->data.channel_update.req_orig);
-                break;
+        case REQ_TYPE_CHANNEL_UPDATE:
+            *(p_slot->data.channel_update.p_result) =
+                nrf_802154_core_channel_update(p_slot->data.channel_update.req_orig);
+            break;
 
-            case REQ_TYPE_CCA_CFG_UPDATE:
-                *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
-                break;
+        case REQ_TYPE_CCA_CFG_UPDATE:
+            *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
+            break;
 
-            case REQ_TYPE_RSSI_MEASURE:
-                *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
-                break;
+        case REQ_TYPE_RSSI_MEASURE:
+            *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
+            break;
 
-            case REQ_TYPE_RSSI_GET:
-                *(p_slot->data.rssi_get.p_result) =
-                    nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
-                break;
+        case REQ_TYPE_RSSI_GET:
+            *(p_slot->data.rssi_get.p_result) =
+                nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
+            break;
 
-            case REQ_TYPE_ANTENNA_UPDATE:
-                *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
-                break;
+        case REQ_TYPE_ANTENNA_UPDATE:
+            *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
+            break;
 
 #if NRF_802154_DELAYED_TRX_ENABLED
 
-            case REQ_TYPE_TRANSMIT_AT:
-                *(p_slot->data.transmit_at.p_result) =
-                    nrf_802154_delayed_trx_transmit(p_slot->data.transmit_at.p_frame,
-                                                    p_slot->data.transmit_at.tx_time,
-                                                    p_slot->data.transmit_at.p_metadata);
-                break;
+        case REQ_TYPE_TRANSMIT_AT:
+            *(p_slot->data.transmit_at.p_result) =
+                nrf_802154_delayed_trx_transmit(p_slot->data.transmit_at.p_frame,
+                                                p_slot->data.transmit_at.tx_time,
+                                                p_slot->data.transmit_at.p_metadata);
+            break;
+
+        case REQ_TYPE_TRANSMIT_AT_CANCEL:
+            *(p_slot->data.transmit_at_cancel.p_result) =
+                nrf_802154_delayed_trx_transmit_cancel();
+            break;
+
+        case REQ_TYPE_RECEIVE_AT:
+            *(p_slot->data.receive_at.p_result) =
+                nrf_802154_delayed_trx_receive(p_slot->data.receive_at.rx_time,
+                                               p_slot->data.receive_at.timeout,
+                                               p_slot->data.receive_at.channel,
+                                               p_slot->data.receive_at.id);
+            break;
+
+        case REQ_TYPE_RECEIVE_AT_CANCEL:
+            *(p_slot->data.receive_at_cancel.p_result) =
+                nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
+            break;
+
+        case REQ_TYPE_RECEIVE_AT_SCHEDULED_CANCEL:
+            *(p_slot->data.receive_at_cancel.p_result) =
+                nrf_802154_delayed_trx_receive_scheduled_cancel(
+                    p_slot->data.receive_at_cancel.id);
+            break;
 
-            case REQ_TYPE_TRANSMIT_AT_CANCEL:
-                *(p_slot->data.transmit_at_cancel.p_result) =
-                    nrf_802154_delayed_trx_transmit_cancel();
-                break;
+#endif // NRF_802154_DELAYED_TRX_ENABLED
 
-            case REQ_TYPE_RECEIVE_AT:
-                *(p_slot->data.receive_at.p_result) =
-                    nrf_802154_delayed_trx_receive(p_slot->data.receive_at.rx_time,
-                                                   p_slot->data.receive_at.timeout,
-                                                   p_slot->data.receive_at.channel,
-                                                   p_slot->data.receive_at.id);
-                break;
+        case REQ_TYPE_CSMA_CA_START:
+            *(p_slot->data.csma_ca_start.p_result) =
+                nrf_802154_csma_ca_start(p_slot->data.csma_ca_start.p_frame,
+                                         p_slot->data.csma_ca_start.p_metadata);
+            break;
 
-            case REQ_TYPE_RECEIVE_AT_CANCEL:
-                *(p_slot->data.receive_at_cancel.p_result) =
-                    nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
-                break;
+        default:
+            NRF_802154_ASSERT(false);
+    }
+}
 
-            case REQ_TYPE_RECEIVE_AT_SCHEDULED_CANCEL:
-                *(p_slot->data.receive_at_cancel.p_result) =
-                    nrf_802154_delayed_trx_receive_scheduled_cancel(
-                        p_slot->data.receive_at_cancel.id);
-                break;
+/**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
+static void irq_handler_req_event(void)
+{
+    bool processed;
 
-#endif // NRF_802154_DELAYED_TRX_ENABLED
+    do
+    {
+        processed = false;
 
-            case REQ_TYPE_CSMA_CA_START:
-                *(p_slot->data.csma_ca_start.p_result) =
-                    nrf_802154_csma_ca_start(p_slot->data.csma_ca_start.p_frame,
-                                             p_slot->data.csma_ca_start.p_metadata);
-                break;
+        for (size_t i = 0; i < REQ_QUEUE_SIZE; i++)
+        {
+            nrf_802154_req_data_t * p_slot = &m_requests_queue[i];
 
-            default:
-                NRF_802154_ASSERT(false);
-        }
+            if (p_slot->state != REQ_SLOT_PENDING)
+            {
+                // Slot is free, still being filled or waiting to be released by its issuer
+                continue;
+            }
+
+            __DMB();
 
-        nrf_802154_queue_pop_commit(&m_requests_queue);
+            req_process(p_slot);
+
+            __DMB();
+            p_slot->state = REQ_SLOT_DONE;
+            processed     = true;
+        }
     }
+    while (processed);
 }
 
 void nrf_802154_request_swi_irq_handler(void)
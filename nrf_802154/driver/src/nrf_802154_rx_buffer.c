@@ -42,13 +42,106 @@
 
 #include <stddef.h>
 
+#include "nrf_802154_assert.h"
 #include "nrf_802154_config.h"
+#include "nrfx.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
-static rx_buffer_t m_nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
+#define FREE_MASK_WORDS ((NRF_802154_RX_BUFFERS + 31U) / 32U) ///< Number of words of the free mask.
+
+static rx_buffer_t       m_nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
+static volatile uint32_t m_free_mask[FREE_MASK_WORDS];                  ///< Bitmap of free buffers.
+static volatile uint32_t m_occupancy;                                   ///< Number of taken buffers.
+static volatile uint32_t m_high_water;                                  ///< Highest number of taken buffers.
+
+/* Finds a free buffer in a single word of the free mask. */
+static bool free_mask_word_find(uint32_t word, uint32_t * p_bit)
+{
+    uint32_t mask = m_free_mask[word];
+
+    if (mask == 0UL)
+    {
+        return false;
+    }
+
+    // Pick the lowest free buffer
+    *p_bit = 31UL - __CLZ(mask & (~mask + 1UL));
+
+    return true;
+}
+
+static void free_mask_bit_clear(uint32_t idx)
+{
+    volatile uint32_t * p_word = &m_free_mask[idx / 32U];
+    uint32_t            mask;
+
+    do
+    {
+        mask = __LDREXW(p_word);
+    }
+    while (__STREXW(mask & ~(1UL << (idx % 32U)), p_word));
+}
+
+static void free_mask_bit_set(uint32_t idx)
+{
+    volatile uint32_t * p_word = &m_free_mask[idx / 32U];
+    uint32_t            mask;
+
+    __DMB();
+
+    do
+    {
+        mask = __LDREXW(p_word);
+    }
+    while (__STREXW(mask | (1UL << (idx % 32U)), p_word));
+}
+
+static void occupancy_increment(void)
+{
+    uint32_t count;
+    uint32_t high_water;
+
+    do
+    {
+        count = __LDREXW(&m_occupancy) + 1UL;
+    }
+    while (__STREXW(count, &m_occupancy));
+
+    do
+    {
+        high_water = __LDREXW(&m_high_water);
+
+        if (high_water >= count)
+        {
+            __CLREX();
+            break;
+        }
+    }
+    while (__STREXW(count, &m_high_water));
+}
+
+static void occupancy_decrement(void)
+{
+    uint32_t count;
+
+    do
+    {
+        count = __LDREXW(&m_occupancy);
+    }
+    while (__STREXW(count - 1UL, &m_occupancy));
+}
+
+static uint32_t buffer_idx_get(const rx_buffer_t * p_buffer)
+{
+    uint32_t idx = (uint32_t)(p_buffer - m_nrf_802154_rx_buffers);
+
+    NRF_802154_ASSERT(idx < NRF_802154_RX_BUFFERS);
+
+    return idx;
+}
 
 void nrf_802154_rx_buffer_init(void)
 {
@@ -56,21 +149,71 @@ void nrf_802154_rx_buffer_init(void)
     {
         m_nrf_802154_rx_buffers[i].free = true;
     }
+
+    for (uint32_t i = 0; i < FREE_MASK_WORDS; i++)
+    {
+        uint32_t remaining = NRF_802154_RX_BUFFERS - (i * 32U);
+
+        m_free_mask[i] = (remaining >= 32U) ? UINT32_MAX : ((1UL << remaining) - 1UL);
+    }
+
+    m_occupancy  = 0UL;
+    m_high_water = 0UL;
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    uint32_t bit;
+
+    for (uint32_t i = 0; i < FREE_MASK_WORDS; i++)
     {
-        if (m_nrf_802154_rx_buffers[i].free)
+        if (free_mask_word_find(i, &bit))
         {
-            return &m_nrf_802154_rx_buffers[i];
+            return &m_nrf_802154_rx_buffers[(i * 32U) + bit];
         }
     }
 
     return NULL;
 }
 
+void nrf_802154_rx_buffer_take(rx_buffer_t * p_buffer)
+{
+    uint32_t idx = buffer_idx_get(p_buffer);
+
+    NRF_802154_ASSERT(p_buffer->free);
+
+    p_buffer->free = false;
+    free_mask_bit_clear(idx);
+    occupancy_increment();
+}
+
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer)
+{
+    uint32_t idx = buffer_idx_get(p_buffer);
+
+    NRF_802154_ASSERT(!p_buffer->free);
+
+    occupancy_decrement();
+    p_buffer->free = true;
+    free_mask_bit_set(idx);
+}
+
+uint32_t nrf_802154_rx_buffer_occupancy_get(void)
+{
+    return m_occupancy;
+}
+
+uint32_t nrf_802154_rx_buffer_high_water_get(void)
+{
+    return m_high_water;
+}
+
+void nrf_802154_rx_buffer_high_water_reset(void)
+{
+    // Concurrent takes may be missed, which is acceptable for statistics
+    m_high_water = m_occupancy;
+}
+
 #ifdef TEST
 void nrf_802154_rx_buffer_module_reset(void)
 {
@@ -79,6 +222,14 @@ void nrf_802154_rx_buffer_module_reset(void)
     {
         m_nrf_802154_rx_buffers[i].free = false;
     }
+
+    for (uint32_t i = 0; i < FREE_MASK_WORDS; i++)
+    {
+        m_free_mask[i] = 0UL;
+    }
+
+    m_occupancy  = 0UL;
+    m_high_water = 0UL;
 }
 
 #endif /* TEST */
@@ -66,10 +66,47 @@ void nrf_802154_rx_buffer_init(void);
 /**
  * @brief Gets a free buffer to receive a frame.
  *
+ * The returned buffer remains free until it is taken with @ref nrf_802154_rx_buffer_take.
+ *
  * @returns  Pointer to a free buffer, or NULL if no free buffer is available.
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Marks a buffer as containing a received frame.
+ *
+ * @param[in]  p_buffer  Pointer to the free buffer that holds a received frame now.
+ */
+void nrf_802154_rx_buffer_take(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Returns a buffer with a received frame to the pool of free buffers.
+ *
+ * This function is lock-free and can be called from any context.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer that is no longer used by the higher layer.
+ */
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Gets the number of buffers that currently contain received frames.
+ *
+ * @returns  Number of buffers taken and not yet released.
+ */
+uint32_t nrf_802154_rx_buffer_occupancy_get(void);
+
+/**
+ * @brief Gets the highest number of buffers that contained received frames at the same time.
+ *
+ * @returns  High-water mark of the buffer occupancy.
+ */
+uint32_t nrf_802154_rx_buffer_high_water_get(void);
+
+/**
+ * @brief Resets the high-water mark of the buffer occupancy to the current occupancy.
+ */
+void nrf_802154_rx_buffer_high_water_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -35,6 +35,7 @@
 #include <stddef.h>
 
 #include "nrf_802154_stats.h"
+#include "nrf_802154_rx_buffer.h"
 
 #define NUMBER_OF_STAT_COUNTERS   (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 #define NUMBER_OF_STAT_TIMESTAMPS (sizeof(nrf_802154_stat_timestamps_t) / sizeof(uint64_t))
@@ -110,6 +111,21 @@ void nrf_802154_stat_counters_reset(void)
     }
 }
 
+uint32_t nrf_802154_stat_rx_buffer_occupancy_get(void)
+{
+    return nrf_802154_rx_buffer_occupancy_get();
+}
+
+uint32_t nrf_802154_stat_rx_buffer_high_water_get(void)
+{
+    return nrf_802154_rx_buffer_high_water_get();
+}
+
+void nrf_802154_stat_rx_buffer_high_water_reset(void)
+{
+    nrf_802154_rx_buffer_high_water_reset();
+}
+
 #ifdef TEST
 void nrf_802154_stats_module_reset(void)
 {
@@ -57,6 +57,9 @@ __STATIC_INLINE__ void nrf_802154_stat_counter_increment_coex_requests(void);
 __STATIC_INLINE__ void nrf_802154_stat_counter_increment_coex_granted_requests(void);
 __STATIC_INLINE__ void nrf_802154_stat_counter_increment_coex_denied_requests(void);
 __STATIC_INLINE__ void nrf_802154_stat_counter_increment_coex_unsolicited_grants(void);
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_request_inversions(void);
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_delayed_rx_missed(void);
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_rx_buffer_starvations(void);
 
 __STATIC_INLINE__ void nrf_802154_stat_timestamp_write_last_csmaca_start_timestamp(uint64_t value);
 __STATIC_INLINE__ void nrf_802154_stat_timestamp_write_last_cca_start_timestamp(uint64_t value);
@@ -126,6 +129,21 @@ __STATIC_INLINE__ void nrf_802154_stat_counter_increment_coex_unsolicited_grants
     __NRF_802154_STAT_COUNTER_INC_IMPL(coex_unsolicited_grants);
 }
 
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_request_inversions(void)
+{
+    __NRF_802154_STAT_COUNTER_INC_IMPL(request_inversions);
+}
+
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_delayed_rx_missed(void)
+{
+    __NRF_802154_STAT_COUNTER_INC_IMPL(delayed_rx_missed);
+}
+
+__STATIC_INLINE__ void nrf_802154_stat_counter_increment_rx_buffer_starvations(void)
+{
+    __NRF_802154_STAT_COUNTER_INC_IMPL(rx_buffer_starvations);
+}
+
 __STATIC_INLINE__ void nrf_802154_stat_timestamp_write_last_csmaca_start_timestamp(uint64_t value)
 {
     __NRF_80214_STAT_TIMESTAMP_WRITE_IMPL(last_csmaca_start_timestamp, value);
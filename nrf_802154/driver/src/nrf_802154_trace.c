@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the trace ring of the stage transitions of the nRF 802.15.4 radio driver.
+ *
+ */
+
+#include "nrf_802154_trace.h"
+
+#if NRF_802154_TRACE_ENABLED
+
+#include <nrfx.h>
+
+#include "nrf_802154_sl_timer.h"
+
+volatile nrf_802154_trace_t g_nrf_802154_trace =
+{
+    .magic = NRF_802154_TRACE_MAGIC,
+    .len   = NRF_802154_TRACE_BUFFER_LEN,
+};
+
+void nrf_802154_trace_record(uint8_t stage, uint16_t param_u16)
+{
+    uint32_t timestamp = (uint32_t)nrf_802154_sl_timer_current_time_get();
+    uint32_t index;
+
+    do
+    {
+        index = __LDREXW(&g_nrf_802154_trace.head);
+    }
+    while (__STREXW(index + 1U, &g_nrf_802154_trace.head));
+
+    volatile nrf_802154_trace_entry_t * p_entry =
+        &g_nrf_802154_trace.entries[index & (NRF_802154_TRACE_BUFFER_LEN - 1U)];
+    uint32_t lap = index / NRF_802154_TRACE_BUFFER_LEN;
+
+    // The word carrying the lap is written last, so that the entry is not valid until complete
+    p_entry->timestamp = timestamp;
+    p_entry->word      = (lap << NRF_802154_TRACE_ENTRY_LAP_BITPOS) |
+                         ((uint32_t)stage << NRF_802154_TRACE_ENTRY_STAGE_BITPOS) |
+                         param_u16;
+}
+
+#endif // NRF_802154_TRACE_ENABLED
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that records the stage transitions of the RX/TX state machine of the
+ *        802.15.4 radio driver in a trace ring.
+ *
+ * @details
+ * Each recorded stage transition is an entry of two words: a timestamp and the word
+ * containing the stage, its parameter and the lap of the ring in which the entry was written.
+ * The entries are recorded without disabling interrupts: a slot is reserved with an exclusive
+ * increment of the head of the ring and only the reserving context writes to it. An entry that
+ * was reserved, but not written yet, still has the lap of the previous entry in its slot, so
+ * it is recognized and skipped by the decoder.
+ *
+ * The stages are the global events of the debug log from the range
+ * [ @ref NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_FIRST .. @ref NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_LAST ].
+ * Every global event from this range passed to @ref nrf_802154_log_global_event is recorded
+ * in the ring regardless of the verbosity of the debug log.
+ *
+ * The ring is the @ref g_nrf_802154_trace variable. Its memory can be dumped and decoded
+ * into per-stage latency histograms with the @c nrf_802154_trace_decode.py script.
+ */
+
+#ifndef NRF_802154_TRACE_H_
+#define NRF_802154_TRACE_H_
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_debug_log_codes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Value of @ref nrf_802154_trace_t::magic identifying the trace ring in a memory dump. */
+#define NRF_802154_TRACE_MAGIC               0x54353134UL
+
+/** @brief Bit shift of the field "lap" in @ref nrf_802154_trace_entry_t::word. */
+#define NRF_802154_TRACE_ENTRY_LAP_BITPOS    24
+
+/** @brief Bit shift of the field "stage" in @ref nrf_802154_trace_entry_t::word. */
+#define NRF_802154_TRACE_ENTRY_STAGE_BITPOS  16
+
+#if (NRF_802154_TRACE_BUFFER_LEN & (NRF_802154_TRACE_BUFFER_LEN - 1U)) != 0U
+#error "NRF_802154_TRACE_BUFFER_LEN must be a power of 2"
+#endif
+
+/**
+ * @brief Single entry of the trace ring.
+ */
+typedef struct
+{
+    uint32_t timestamp; ///< Time of the stage transition in microseconds, modulo 2^32.
+    uint32_t word;      ///< Lap of the ring (bits 31-24), stage (bits 23-16) and parameter (bits 15-0).
+} nrf_802154_trace_entry_t;
+
+/**
+ * @brief Trace ring.
+ */
+typedef struct
+{
+    uint32_t                 magic;                                ///< @ref NRF_802154_TRACE_MAGIC.
+    uint32_t                 len;                                  ///< Number of entries in the ring.
+    uint32_t                 head;                                 ///< Number of entries reserved since the start.
+    nrf_802154_trace_entry_t entries[NRF_802154_TRACE_BUFFER_LEN]; ///< Entries of the ring.
+} nrf_802154_trace_t;
+
+#if NRF_802154_TRACE_ENABLED
+
+extern volatile nrf_802154_trace_t g_nrf_802154_trace;
+
+/**
+ * @brief Records a stage transition in the trace ring.
+ *
+ * This function can be called from any context, including interrupts of any priority.
+ *
+ * @param[in]  stage      Stage of the state machine.
+ * @param[in]  param_u16  Parameter of the stage transition.
+ */
+void nrf_802154_trace_record(uint8_t stage, uint16_t param_u16);
+
+/**@brief Records a global event of the debug log in the trace ring if it is a stage transition.
+ *
+ * @param[in]  global_event_id  Global event identifier.
+ * @param[in]  param_u16        Parameter of the global event.
+ */
+#define nrf_802154_trace_global_event(global_event_id, param_u16)               \
+    do                                                                          \
+    {                                                                           \
+        if (((global_event_id) >= NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_FIRST) && \
+            ((global_event_id) <= NRF_802154_LOG_GLOBAL_EVENT_ID_STAGE_LAST))   \
+        {                                                                       \
+            nrf_802154_trace_record((uint8_t)(global_event_id),                 \
+                                    (uint16_t)(param_u16));                     \
+        }                                                                       \
+    }                                                                           \
+    while (0)
+
+#else // NRF_802154_TRACE_ENABLED
+
+#define nrf_802154_trace_global_event(global_event_id, param_u16) \
+    do                                                            \
+    {                                                             \
+    }                                                             \
+    while (0)
+
+#endif // NRF_802154_TRACE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TRACE_H_ */
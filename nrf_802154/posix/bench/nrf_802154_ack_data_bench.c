@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host benchmark of the ACK data peer tables.
+ *
+ * For each table size in @ref m_peers_counts, the program moves the short and extended address
+ * peer tables to heap memory with @ref nrf_802154_ack_data_peer_table_memory_set, fills them
+ * with random addresses that have the pending bit set and measures:
+ *  - the insertion time per peer,
+ *  - the lookup time of @ref nrf_802154_peer_rec_get, with half of the lookups for addresses
+ *    not present in the table, as the best of @ref BENCH_REPEATS passes.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DNRF_802154_SERIALIZATION_HOST=1 -DNRF_802154_IE_WRITER_ENABLED=0 \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/src \
+ *       -Idriver/src/mac_features -Idriver/src/mac_features/ack_generator \
+ *       posix/bench/nrf_802154_ack_data_bench.c \
+ *       driver/src/mac_features/ack_generator/nrf_802154_ack_data.c \
+ *       driver/src/nrf_802154_hmap.c -o ack_data_bench
+ *   ./ack_data_bench
+ *
+ * The program returns a non-zero status if a lookup returns a wrong result or a table
+ * cannot hold the requested number of peers.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "nrf_802154_ack_data.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_core.h"
+
+#define BENCH_REPEATS   50 ///< Passes over the lookups, the best one is reported.
+#define BENCH_MAX_PEERS 512
+
+static const uint16_t m_peers_counts[] = {16U, 128U, 512U};
+
+static uint32_t m_rng_state = 1U;
+static uint8_t  m_addrs[2U * BENCH_MAX_PEERS][EXTENDED_ADDRESS_SIZE];
+
+/** @brief The peer tables are set up with the receiver disabled. */
+radio_state_t nrf_802154_core_state_get(void)
+{
+    return RADIO_STATE_SLEEP;
+}
+
+static uint32_t rng_get(void)
+{
+    m_rng_state ^= m_rng_state << 13;
+    m_rng_state ^= m_rng_state >> 17;
+    m_rng_state ^= m_rng_state << 5;
+
+    return m_rng_state;
+}
+
+static uint64_t ticks_get(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Fill @ref m_addrs with distinct random addresses.
+ *
+ * The first @p count addresses are inserted in the table, the next @p count are used
+ * for the lookups of absent peers.
+ */
+static void addrs_generate(uint16_t count, size_t addr_size)
+{
+    for (size_t i = 0U; i < 2U * count; i++)
+    {
+        bool unique;
+
+        do
+        {
+            unique = true;
+
+            for (size_t j = 0U; j < addr_size; j++)
+            {
+                m_addrs[i][j] = (uint8_t)rng_get();
+            }
+
+            for (size_t j = 0U; j < i; j++)
+            {
+                if (memcmp(m_addrs[i], m_addrs[j], addr_size) == 0)
+                {
+                    unique = false;
+                    break;
+                }
+            }
+        }
+        while (!unique);
+    }
+}
+
+static bool table_bench(bool extended, uint16_t count)
+{
+    size_t   addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    size_t   mem_size  = nrf_802154_ack_data_peer_table_memory_size_get(extended, count);
+    void   * p_mem     = malloc(mem_size);
+    uint64_t best      = UINT64_MAX;
+    uint64_t start;
+    double   insert_ticks;
+    bool     ok        = true;
+
+    if ((p_mem == NULL) ||
+        nrf_802154_ack_data_peer_table_memory_set(extended, p_mem, mem_size - 1U, count) ||
+        !nrf_802154_ack_data_peer_table_memory_set(extended, p_mem, mem_size, count))
+    {
+        free(p_mem);
+        return false;
+    }
+
+    addrs_generate(count, addr_size);
+
+    start = ticks_get();
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        ok &= nrf_802154_ack_data_for_addr_set(m_addrs[i],
+                                               extended,
+                                               NRF_802154_ACK_DATA_PENDING_BIT,
+                                               NULL,
+                                               0U);
+    }
+
+    insert_ticks = (double)(ticks_get() - start) / count;
+
+    for (uint32_t rep = 0U; rep < BENCH_REPEATS; rep++)
+    {
+        uint32_t found = 0U;
+
+        start = ticks_get();
+
+        for (size_t i = 0U; i < 2U * count; i++)
+        {
+            nrf_802154_peer_rec_t peer_rec;
+
+            if (nrf_802154_peer_rec_get(m_addrs[i], extended, &peer_rec))
+            {
+                ok    &= (i < count) && peer_rec.pending_bit;
+                found += 1U;
+            }
+        }
+
+        uint64_t elapsed = ticks_get() - start;
+
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+
+        ok &= (found == count);
+    }
+
+    printf("%5u %-8s %10.1f %10.1f\n",
+           (unsigned)count,
+           extended ? "extended" : "short",
+           insert_ticks,
+           (double)best / (2U * count));
+
+    // Restore the default memory before the heap memory is freed.
+    ok &= nrf_802154_ack_data_peer_table_memory_set(extended, NULL, 0U, 0U);
+    free(p_mem);
+
+    return ok;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    nrf_802154_ack_data_init();
+
+#if defined(__x86_64__) || defined(__i386__)
+    printf("TSC ticks per operation, lookups are the best of %u passes\n", BENCH_REPEATS);
+#else
+    printf("nanoseconds per operation, lookups are the best of %u passes\n", BENCH_REPEATS);
+#endif
+    printf("peers table        insert     lookup\n");
+
+    for (size_t i = 0U; i < sizeof(m_peers_counts) / sizeof(m_peers_counts[0]); i++)
+    {
+        ok &= table_bench(false, m_peers_counts[i]);
+        ok &= table_bench(true, m_peers_counts[i]);
+    }
+
+    if (!ok)
+    {
+        printf("FAILED\n");
+    }
+
+    return ok ? 0 : 1;
+}
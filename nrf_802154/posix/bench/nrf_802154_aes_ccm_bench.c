@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host benchmark of the AES-CCM* transformation contexts.
+ *
+ * The program secures a set of random frames, shaped like Thread data frames with ENC-MIC-32 and
+ * enhanced ACKs with MIC only, in two ways:
+ *  - through the nrf_802154_aes_ccm.h API, which uses the single shared context and secures
+ *    each frame into the transmit work buffer,
+ *  - in @ref BENCH_CONTEXTS contexts provided by the caller, each with its own work buffer.
+ *    All the contexts are prepared before any transformation is started.
+ *
+ * Both ways must produce the same secured frames. The best of @ref BENCH_REPEATS passes is
+ * reported in ticks per frame:
+ *  - with the software AES-128 that replaces the ECB peripheral (posix/src/mpsl_ecb_sw.c),
+ *  - with the block encryption replaced by a copy of the input block, which leaves only
+ *    the time spent by the driver outside the block encryption. This part is the only one
+ *    that depends on the way the context is provided, as the ECB peripheral encrypts a block
+ *    in a fixed time.
+ *
+ * The block encryption is intercepted with the --wrap option of the GNU linker.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DCONFIG_MPSL -DNRF_802154_ENCRYPTION_ACCELERATOR_ECB \
+ *       -DNRF_802154_SERIALIZATION_HOST=1 -Iposix/include -Icommon/include -Idriver/src \
+ *       -Wl,--wrap=mpsl_ecb_block_encrypt \
+ *       posix/bench/nrf_802154_aes_ccm_bench.c posix/src/mpsl_ecb_sw.c \
+ *       driver/src/nrf_802154_aes_ccm_acc_ecb.c driver/src/nrf_802154_tx_work_buffer.c \
+ *       -o aes_ccm_bench
+ *   ./aes_ccm_bench
+ *
+ * The program returns a non-zero status if the secured frames differ or a transformation fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "mpsl_ecb.h"
+#include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_aes_ccm_acc_ecb.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_work_buffer.h"
+
+#define BENCH_FRAMES   256U ///< Frames secured in a pass.
+#define BENCH_CONTEXTS 4U   ///< Contexts prepared before the transformations are started.
+#define BENCH_REPEATS  50U  ///< Passes, the best one is reported.
+
+#define BENCH_FRAME_SIZE (MAX_PACKET_SIZE + PHR_SIZE)
+
+void __real_mpsl_ecb_block_encrypt(mpsl_ecb_hal_data_t * p_ecb_data);
+
+static uint32_t                  m_rng_state = 1U;
+static uint64_t                  m_blocks;
+static bool                      m_aes_enabled = true;
+static uint8_t                   m_frames[BENCH_FRAMES][BENCH_FRAME_SIZE];
+static nrf_802154_aes_ccm_data_t m_data[BENCH_FRAMES];
+static uint8_t                   m_shared_secured[BENCH_FRAMES][BENCH_FRAME_SIZE];
+static uint8_t                   m_ctx_secured[BENCH_FRAMES][BENCH_FRAME_SIZE];
+
+void __wrap_mpsl_ecb_block_encrypt(mpsl_ecb_hal_data_t * p_ecb_data)
+{
+    m_blocks++;
+
+    if (m_aes_enabled)
+    {
+        __real_mpsl_ecb_block_encrypt(p_ecb_data);
+    }
+    else
+    {
+        memcpy(p_ecb_data->ciphertext, p_ecb_data->cleartext, sizeof(p_ecb_data->ciphertext));
+    }
+}
+
+static uint32_t rng_get(void)
+{
+    m_rng_state = m_rng_state * 1103515245U + 12345U;
+    return m_rng_state >> 8;
+}
+
+static uint64_t ticks_get(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Build a random frame and the AES-CCM* data to secure it.
+ *
+ * Three of four frames are data frames with ENC-MIC-32 and a payload of up to the maximum
+ * length. The others are enhanced ACKs with MIC-32, MIC-64 or MIC-128 and no encrypted payload.
+ */
+static void frame_make(size_t index)
+{
+    static const uint8_t mic_sizes[] = {0U, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE};
+
+    nrf_802154_aes_ccm_data_t * p_data  = &m_data[index];
+    uint8_t                   * p_frame = m_frames[index];
+    bool                        encrypt = (rng_get() % 4U) != 0U;
+    uint8_t                     mic_level;
+    uint8_t                     header_len;
+    uint8_t                     payload_len;
+
+    mic_level   = encrypt ? 1U : (uint8_t)(1U + rng_get() % 3U);
+    header_len  = (uint8_t)(15U + rng_get() % 16U);
+    payload_len = 0U;
+
+    if (encrypt)
+    {
+        payload_len = (uint8_t)(rng_get() %
+                                (MAX_PACKET_SIZE - header_len - mic_sizes[mic_level] - FCS_SIZE));
+    }
+
+    memset(p_frame, 0, BENCH_FRAME_SIZE);
+    p_frame[PHR_OFFSET] = header_len + payload_len + mic_sizes[mic_level] + FCS_SIZE;
+
+    for (uint8_t i = 0U; i < header_len + payload_len; i++)
+    {
+        p_frame[PHR_SIZE + i] = (uint8_t)rng_get();
+    }
+
+    memset(p_data, 0, sizeof(*p_data));
+
+    for (size_t i = 0U; i < sizeof(p_data->key); i++)
+    {
+        p_data->key[i] = (uint8_t)rng_get();
+    }
+
+    for (size_t i = 0U; i < sizeof(p_data->nonce); i++)
+    {
+        p_data->nonce[i] = (uint8_t)rng_get();
+    }
+
+    p_data->auth_data           = &p_frame[PHR_SIZE];
+    p_data->auth_data_len       = header_len;
+    p_data->plain_text_data     = (payload_len != 0U) ? &p_frame[PHR_SIZE + header_len] : NULL;
+    p_data->plain_text_data_len = payload_len;
+    p_data->mic_level           = mic_level;
+    p_data->raw_frame           = p_frame;
+}
+
+/**
+ * @brief Secure all the frames through the API that uses the shared context.
+ *
+ * @param[in]  store  If the secured frames are to be copied out of the transmit work buffer.
+ */
+static bool shared_secure(bool store)
+{
+    bool ok = true;
+
+    for (size_t i = 0U; i < BENCH_FRAMES; i++)
+    {
+        nrf_802154_tx_work_buffer_reset(NULL);
+        nrf_802154_aes_ccm_transform_reset();
+
+        if (!nrf_802154_aes_ccm_transform_prepare(&m_data[i]))
+        {
+            ok = false;
+            continue;
+        }
+
+        nrf_802154_aes_ccm_transform_start(m_frames[i]);
+
+        if (store)
+        {
+            memcpy(m_shared_secured[i],
+                   nrf_802154_tx_work_buffer_get(m_frames[i]),
+                   BENCH_FRAME_SIZE);
+        }
+    }
+
+    return ok;
+}
+
+static bool shared_pass(void)
+{
+    return shared_secure(false);
+}
+
+/**
+ * @brief Secure all the frames in the contexts provided by the caller.
+ */
+static bool contexts_pass(void)
+{
+    static nrf_802154_aes_ccm_ctx_t ctxs[BENCH_CONTEXTS];
+
+    bool ok = true;
+
+    for (size_t first = 0U; first < BENCH_FRAMES; first += BENCH_CONTEXTS)
+    {
+        for (size_t i = 0U; i < BENCH_CONTEXTS; i++)
+        {
+            nrf_802154_aes_ccm_ctx_reset(&ctxs[i]);
+            ok &= nrf_802154_aes_ccm_ctx_transform_prepare(&ctxs[i],
+                                                           &m_data[first + i],
+                                                           m_ctx_secured[first + i]);
+        }
+
+        for (size_t i = 0U; i < BENCH_CONTEXTS; i++)
+        {
+            ok &= nrf_802154_aes_ccm_ctx_transform_start(&ctxs[i], m_frames[first + i]);
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Run @p p_pass @ref BENCH_REPEATS times.
+ *
+ * @param[in]  p_pass    Pass to be measured.
+ * @param[out] p_blocks  Number of blocks encrypted in a pass.
+ * @param[out] p_ok      Cleared if any pass fails.
+ *
+ * @returns  Ticks per frame of the best pass.
+ */
+static double pass_measure(bool (* p_pass)(void), uint64_t * p_blocks, bool * p_ok)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t repeat = 0U; repeat < BENCH_REPEATS; repeat++)
+    {
+        uint64_t start;
+        uint64_t ticks;
+
+        m_blocks = 0U;
+        start    = ticks_get();
+        *p_ok   &= p_pass();
+        ticks    = ticks_get() - start;
+
+        if (ticks < best)
+        {
+            best = ticks;
+        }
+    }
+
+    *p_blocks = m_blocks;
+
+    return (double)best / BENCH_FRAMES;
+}
+
+/**
+ * @brief Count the frames that differ between both ways.
+ */
+static uint32_t mismatches_count(void)
+{
+    uint32_t mismatches = 0U;
+
+    for (size_t i = 0U; i < BENCH_FRAMES; i++)
+    {
+        size_t len = PHR_SIZE + m_frames[i][PHR_OFFSET] - FCS_SIZE;
+
+        if (memcmp(m_shared_secured[i], m_ctx_secured[i], len) != 0)
+        {
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+int main(void)
+{
+    static const char * const cipher_names[] = {"software AES", "copy"};
+
+    uint64_t shared_blocks;
+    uint64_t ctx_blocks;
+    double   shared_ticks;
+    double   ctx_ticks;
+    uint32_t mismatches;
+    bool     ok = true;
+
+    for (size_t i = 0U; i < BENCH_FRAMES; i++)
+    {
+        frame_make(i);
+    }
+
+    printf("%u frames, %u contexts, ticks per frame, best of %u passes\n",
+           (unsigned)BENCH_FRAMES, (unsigned)BENCH_CONTEXTS, (unsigned)BENCH_REPEATS);
+    printf("%-13s %8s %16s %8s %11s\n",
+           "block cipher", "blocks", "shared context", "callers", "mismatches");
+
+    for (size_t cipher = 0U; cipher < 2U; cipher++)
+    {
+        m_aes_enabled = (cipher == 0U);
+
+        shared_ticks = pass_measure(shared_pass, &shared_blocks, &ok);
+        ctx_ticks    = pass_measure(contexts_pass, &ctx_blocks, &ok);
+
+        ok        &= shared_secure(true);
+        mismatches = mismatches_count();
+        ok        &= (mismatches == 0U) && (shared_blocks == ctx_blocks);
+
+        printf("%-13s %8.1f %16.1f %8.1f %11u\n",
+               cipher_names[cipher], (double)shared_blocks / BENCH_FRAMES, shared_ticks,
+               ctx_ticks, (unsigned)mismatches);
+    }
+
+    return ok ? 0 : 1;
+}
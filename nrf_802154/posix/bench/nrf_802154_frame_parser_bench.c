@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host equivalence check and benchmark of the frame parser.
+ *
+ * The program compares nrf_802154_frame_parser_data_init() with the reference copy of the
+ * parser from before the lookup tables were introduced (nrf_802154_frame_parser_ref.c):
+ *  - exhaustively over both Frame Control Field octets, for every parse level, with random
+ *    frame tails and random valid data lengths. The return value, the parse level and all
+ *    offsets must be equal,
+ *  - on a shuffled corpus of Thread and Zigbee frames, reporting the best of
+ *    @ref BENCH_REPEATS passes in cycles per frame.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -Iposix/include -Icommon/include -Idriver/src -Idriver/src/mac_features \
+ *       posix/bench/nrf_802154_frame_parser_bench.c posix/bench/nrf_802154_frame_parser_ref.c \
+ *       driver/src/mac_features/nrf_802154_frame_parser.c -o frame_parser_bench
+ *   ./frame_parser_bench
+ *
+ * The program returns a non-zero status if any mismatch is found.
+ *
+ * The timings depend on the host and the compiler more than on the run, so compare both parsers
+ * within a single run only. On x86-64 hosts with -O2, the lookup tables measured between no gain
+ * and about 20% fewer ticks at the FCF offsets level, and between 4% and 20% fewer ticks at the
+ * full level. The timings of a host are not an estimate of the gain on a device.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "nrf_802154_frame.h"
+#include "nrf_802154_frame_parser.h"
+
+#define BENCH_TAILS_PER_FCF 8    ///< Random frames generated for each Frame Control Field value.
+#define BENCH_CORPUS_ROUNDS 256  ///< Copies of each corpus frame, with varying payload length.
+#define BENCH_CORPUS_SIZE   (BENCH_CORPUS_ROUNDS * 10)
+#define BENCH_REPEATS       50   ///< Passes over the corpus, the best one is reported.
+
+bool nrf_802154_frame_parser_ref_data_init(uint8_t                       * p_frame,
+                                           uint8_t                         valid_data_len,
+                                           nrf_802154_frame_parser_level_t requested_parse_level,
+                                           nrf_802154_frame_t            * p_parser_data);
+
+static uint32_t m_rng_state = 12345U;
+static uint8_t  m_corpus[BENCH_CORPUS_SIZE][MAX_PACKET_SIZE + PHR_SIZE];
+static size_t   m_corpus_len;
+
+static uint8_t rng_get(void)
+{
+    m_rng_state = m_rng_state * 1103515245U + 12345U;
+    return (uint8_t)(m_rng_state >> 16);
+}
+
+static uint64_t ticks_get(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static bool results_equal(bool                       ref_result,
+                          bool                       result,
+                          const nrf_802154_frame_t * p_ref,
+                          const nrf_802154_frame_t * p_data)
+{
+    if ((ref_result != result) || (p_ref->parse_level != p_data->parse_level))
+    {
+        return false;
+    }
+
+    if (!result)
+    {
+        return true;
+    }
+
+    return (memcmp(&p_ref->mhr, &p_data->mhr, sizeof(p_ref->mhr)) == 0) &&
+           (memcmp(&p_ref->mac_payload, &p_data->mac_payload, sizeof(p_ref->mac_payload)) == 0) &&
+           (memcmp(&p_ref->helper, &p_data->helper, sizeof(p_ref->helper)) == 0);
+}
+
+static uint32_t equivalence_check(void)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t cases      = 0U;
+    uint32_t parsed     = 0U;
+    uint32_t mismatches = 0U;
+
+    for (uint32_t fcf = 0U; fcf <= UINT16_MAX; fcf++)
+    {
+        for (uint32_t tail = 0U; tail < BENCH_TAILS_PER_FCF; tail++)
+        {
+            uint8_t len = (uint8_t)(FCF_SIZE + 1U + (rng_get() % (MAX_PACKET_SIZE - FCF_SIZE)));
+
+            frame[PHR_OFFSET] = len;
+            frame[FRAME_TYPE_OFFSET] = (uint8_t)fcf;
+            frame[FRAME_TYPE_OFFSET + 1U] = (uint8_t)(fcf >> 8);
+
+            for (size_t i = FRAME_TYPE_OFFSET + FCF_SIZE; i < sizeof(frame); i++)
+            {
+                frame[i] = rng_get();
+            }
+
+            if (tail & 1U)
+            {
+                // Small octets make plausible security and IE headers.
+                for (size_t i = FRAME_TYPE_OFFSET + FCF_SIZE; i < 40U; i++)
+                {
+                    frame[i] &= 0x0fU;
+                }
+            }
+
+            for (uint32_t level = PARSE_LEVEL_FCF_OFFSETS; level <= PARSE_LEVEL_FULL; level++)
+            {
+                nrf_802154_frame_t ref_data;
+                nrf_802154_frame_t data;
+                uint8_t            valid_len;
+                bool               ref_result;
+                bool               result;
+
+                valid_len = (tail & 2U) ? (uint8_t)(len + PHR_SIZE) :
+                            (uint8_t)(rng_get() % (len + PHR_SIZE + 1U));
+
+                ref_result = nrf_802154_frame_parser_ref_data_init(frame,
+                                                                   valid_len,
+                                                                   level,
+                                                                   &ref_data);
+                result = nrf_802154_frame_parser_data_init(frame, valid_len, level, &data);
+
+                if (!results_equal(ref_result, result, &ref_data, &data))
+                {
+                    if (mismatches < 5U)
+                    {
+                        printf("mismatch: fcf 0x%04x level %u valid_len %u ref %d new %d\n",
+                               (unsigned)fcf, (unsigned)level, (unsigned)valid_len,
+                               ref_result, result);
+                    }
+
+                    mismatches++;
+                }
+
+                parsed += result ? 1U : 0U;
+                cases++;
+            }
+        }
+    }
+
+    printf("equivalence: %u cases, %u parsed, %u mismatches\n",
+           (unsigned)cases, (unsigned)parsed, (unsigned)mismatches);
+
+    return mismatches;
+}
+
+static void corpus_add(const uint8_t * p_mhr, size_t mhr_len, uint8_t psdu_len)
+{
+    uint8_t * p_frame = m_corpus[m_corpus_len++];
+
+    p_frame[PHR_OFFSET] = psdu_len;
+    memcpy(&p_frame[PHR_SIZE], p_mhr, mhr_len);
+
+    for (size_t i = mhr_len; i + FCS_SIZE < psdu_len; i++)
+    {
+        p_frame[PHR_SIZE + i] = rng_get();
+    }
+}
+
+static void corpus_build(void)
+{
+    // Thread: secured data frame, 2006, short addresses.
+    static const uint8_t th_data_short[] =
+    {
+        0x41, 0x98, 0x11, 0xce, 0xfa, 0x00, 0x04, 0x00, 0x08,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x01
+    };
+    // Thread: secured data frame, extended addresses.
+    static const uint8_t th_data_ext[] =
+    {
+        0x69, 0xdc, 0x22, 0xce, 0xfa, 1, 2, 3, 4, 5, 6, 7, 8, 8, 7, 6, 5, 4, 3, 2, 1,
+        0x0d, 0x10, 0x00, 0x00, 0x00, 0x02
+    };
+    // Thread: MLE broadcast.
+    static const uint8_t th_mle[] =
+    {
+        0x41, 0xd8, 0x33, 0xff, 0xff, 0xff, 0xff, 1, 2, 3, 4, 5, 6, 7, 8
+    };
+    // Thread: Imm-Ack.
+    static const uint8_t th_ack[] = {0x02, 0x00, 0x44};
+    // Thread: secured 2015 Enh-Ack with a CSL IE.
+    static const uint8_t th_enh_ack[] =
+    {
+        0x22, 0x2e, 0x55, 1, 2, 3, 4, 5, 6, 7, 8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x04, 0x0d, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00
+    };
+    // Thread: secured 2015 data frame with a CSL IE.
+    static const uint8_t th_csl_data[] =
+    {
+        0x69, 0xaa, 0x66, 0xce, 0xfa, 0x00, 0x04, 0x00, 0x08,
+        0x0d, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x04, 0x0d, 0x10, 0x00, 0x10, 0x00, 0x00, 0x3f
+    };
+    // Zigbee: unicast data frame.
+    static const uint8_t zb_data[] = {0x61, 0x88, 0x77, 0x34, 0x12, 0x00, 0x00, 0x01, 0x00};
+    // Zigbee: broadcast data frame.
+    static const uint8_t zb_bcast[] = {0x41, 0x88, 0x78, 0x34, 0x12, 0xff, 0xff, 0x01, 0x00};
+    // Zigbee: beacon request.
+    static const uint8_t zb_beacon_req[] = {0x03, 0x08, 0x79, 0xff, 0xff, 0xff, 0xff, 0x07};
+    // Zigbee: association request.
+    static const uint8_t zb_assoc[] =
+    {
+        0x23, 0xc8, 0x7a, 0x34, 0x12, 0x00, 0x00, 0xff, 0xff, 1, 2, 3, 4, 5, 6, 7, 8, 0x01, 0x8e
+    };
+
+    for (uint32_t i = 0U; i < BENCH_CORPUS_ROUNDS; i++)
+    {
+        corpus_add(th_data_short, sizeof(th_data_short), (uint8_t)(40U + i % 60U));
+        corpus_add(th_data_ext, sizeof(th_data_ext), (uint8_t)(60U + i % 60U));
+        corpus_add(th_mle, sizeof(th_mle), (uint8_t)(50U + i % 70U));
+        corpus_add(th_ack, sizeof(th_ack), IMM_ACK_LENGTH);
+        corpus_add(th_enh_ack, sizeof(th_enh_ack), 31U);
+        corpus_add(th_csl_data, sizeof(th_csl_data), (uint8_t)(50U + i % 60U));
+        corpus_add(zb_data, sizeof(zb_data), (uint8_t)(30U + i % 90U));
+        corpus_add(zb_bcast, sizeof(zb_bcast), (uint8_t)(30U + i % 90U));
+        corpus_add(zb_beacon_req, sizeof(zb_beacon_req), 10U);
+        corpus_add(zb_assoc, sizeof(zb_assoc), 21U);
+    }
+
+    // Shuffle, so that the branch predictor cannot learn the frame order.
+    for (size_t i = m_corpus_len - 1U; i > 0U; i--)
+    {
+        size_t  j = (((size_t)rng_get() << 8) | rng_get()) % (i + 1U);
+        uint8_t tmp[sizeof(m_corpus[0])];
+
+        memcpy(tmp, m_corpus[i], sizeof(tmp));
+        memcpy(m_corpus[i], m_corpus[j], sizeof(tmp));
+        memcpy(m_corpus[j], tmp, sizeof(tmp));
+    }
+}
+
+static double corpus_bench(bool ref, nrf_802154_frame_parser_level_t level, uint32_t * p_parsed)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (uint32_t rep = 0U; rep < BENCH_REPEATS; rep++)
+    {
+        nrf_802154_frame_t data;
+        uint32_t           parsed = 0U;
+        uint64_t           start  = ticks_get();
+
+        for (size_t i = 0U; i < m_corpus_len; i++)
+        {
+            uint8_t * p_frame   = m_corpus[i];
+            uint8_t   valid_len = (uint8_t)(p_frame[PHR_OFFSET] + PHR_SIZE);
+            bool      result;
+
+            result = ref ?
+                     nrf_802154_frame_parser_ref_data_init(p_frame, valid_len, level, &data) :
+                     nrf_802154_frame_parser_data_init(p_frame, valid_len, level, &data);
+
+            parsed += result ? 1U : 0U;
+        }
+
+        uint64_t elapsed = ticks_get() - start;
+
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+
+        *p_parsed = parsed;
+    }
+
+    return (double)best / (double)m_corpus_len;
+}
+
+int main(void)
+{
+    static const nrf_802154_frame_parser_level_t levels[] =
+    {
+        PARSE_LEVEL_FCF_OFFSETS,
+        PARSE_LEVEL_FULL,
+    };
+
+    uint32_t mismatches = equivalence_check();
+
+    corpus_build();
+
+#if defined(__x86_64__) || defined(__i386__)
+    printf("corpus: %u frames, TSC ticks per frame, best of %u passes\n",
+#else
+    printf("corpus: %u frames, nanoseconds per frame, best of %u passes\n",
+#endif
+           (unsigned)m_corpus_len, (unsigned)BENCH_REPEATS);
+
+    for (size_t i = 0U; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        uint32_t ref_parsed;
+        uint32_t parsed;
+        double   ref_ticks = corpus_bench(true, levels[i], &ref_parsed);
+        double   ticks     = corpus_bench(false, levels[i], &parsed);
+
+        printf("level %u: reference %6.1f (%u parsed), lookup tables %6.1f (%u parsed)\n",
+               (unsigned)levels[i], ref_ticks, (unsigned)ref_parsed, ticks, (unsigned)parsed);
+
+        if (ref_parsed != parsed)
+        {
+            mismatches++;
+        }
+    }
+
+    return (mismatches == 0U) ? 0 : 1;
+}
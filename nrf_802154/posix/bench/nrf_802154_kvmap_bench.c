@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host equivalence check and benchmark of the serialization key-value map.
+ *
+ * The program compares nrf_802154_kvmap.c with the reference copy of the map from before
+ * the binary search was introduced (nrf_802154_kvmap_ref.c). Both maps use the layout of
+ * the destination buffer manager: a pointer key and a 32-bit handle value.
+ *  - A random sequence of add, remove and search operations is applied to both maps.
+ *    The return values, the found values and the item counts must be equal.
+ *  - For 8, 32 and 128 outstanding buffers, the program measures the time of one search,
+ *    remove and add of a random outstanding buffer, which is what the serialization does
+ *    for each transmitted or received frame. The best of @ref BENCH_REPEATS passes is
+ *    reported.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -Iserialization/src/include -Iserialization/include/platform \
+ *       posix/bench/nrf_802154_kvmap_bench.c posix/bench/nrf_802154_kvmap_ref.c \
+ *       serialization/src/nrf_802154_kvmap.c -o kvmap_bench
+ *   ./kvmap_bench
+ *
+ * The program returns a non-zero status if any mismatch is found.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "nrf_802154_kvmap.h"
+#include "nrf_802154_serialization_crit_sect.h"
+
+#define BENCH_MAX_BUFFERS   128U  ///< Largest number of outstanding buffers measured.
+#define BENCH_POOL_SIZE     1024U ///< Buffers the outstanding ones are drawn from.
+#define BENCH_CHECK_OPS     200000U
+#define BENCH_OPS_PER_PASS  4096U
+#define BENCH_REPEATS       50U   ///< Passes, the best one is reported.
+
+#define BENCH_MAP_MEMSIZE \
+    NRF_802154_KVMAP_MEMORY_SIZE(BENCH_MAX_BUFFERS, sizeof(void *), sizeof(uint32_t))
+
+void nrf_802154_kvmap_ref_init(nrf_802154_kvmap_t * p_kvmap,
+                               void               * p_memory,
+                               size_t               memsize,
+                               size_t               key_size,
+                               size_t               val_size);
+
+bool nrf_802154_kvmap_ref_add(nrf_802154_kvmap_t * p_kvmap,
+                              const void         * p_key,
+                              const void         * p_value);
+
+bool nrf_802154_kvmap_ref_remove(nrf_802154_kvmap_t * p_kvmap, const void * p_key);
+
+bool nrf_802154_kvmap_ref_search(const nrf_802154_kvmap_t * p_kvmap,
+                                 const void               * p_key,
+                                 void                     * p_value);
+
+static uint32_t m_rng_state = 12345U;
+static uint32_t m_crit_sect_depth;
+static uint8_t  m_pool[BENCH_POOL_SIZE][4];
+static uint8_t  m_map_memory[BENCH_MAP_MEMSIZE];
+static uint8_t  m_ref_map_memory[BENCH_MAP_MEMSIZE];
+
+void nrf_802154_serialization_crit_sect_enter(uint32_t * p_critical_section)
+{
+    *p_critical_section = m_crit_sect_depth++;
+}
+
+void nrf_802154_serialization_crit_sect_exit(uint32_t critical_section)
+{
+    m_crit_sect_depth = critical_section;
+}
+
+static uint32_t rng_get(void)
+{
+    m_rng_state = m_rng_state * 1103515245U + 12345U;
+    return m_rng_state >> 8;
+}
+
+static uint64_t ticks_get(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static uint32_t equivalence_check(void)
+{
+    nrf_802154_kvmap_t map;
+    nrf_802154_kvmap_t ref_map;
+    uint32_t           mismatches = 0U;
+
+    nrf_802154_kvmap_init(&map, m_map_memory, sizeof(m_map_memory),
+                          sizeof(void *), sizeof(uint32_t));
+    nrf_802154_kvmap_ref_init(&ref_map, m_ref_map_memory, sizeof(m_ref_map_memory),
+                              sizeof(void *), sizeof(uint32_t));
+
+    for (uint32_t op = 0U; op < BENCH_CHECK_OPS; op++)
+    {
+        // A smaller key range makes hits, duplicate adds and a full map common.
+        const void * p_key     = m_pool[rng_get() % (BENCH_MAX_BUFFERS * 2U)];
+        uint32_t     handle    = rng_get();
+        uint32_t     value     = 0U;
+        uint32_t     ref_value = 0U;
+        bool         result;
+        bool         ref_result;
+
+        switch (rng_get() % 3U)
+        {
+            case 0U:
+                result     = nrf_802154_kvmap_add(&map, &p_key, &handle);
+                ref_result = nrf_802154_kvmap_ref_add(&ref_map, &p_key, &handle);
+                break;
+
+            case 1U:
+                result     = nrf_802154_kvmap_remove(&map, &p_key);
+                ref_result = nrf_802154_kvmap_ref_remove(&ref_map, &p_key);
+                break;
+
+            default:
+                result     = nrf_802154_kvmap_search(&map, &p_key, &value);
+                ref_result = nrf_802154_kvmap_ref_search(&ref_map, &p_key, &ref_value);
+                break;
+        }
+
+        if ((result != ref_result) || (value != ref_value) ||
+            (nrf_802154_kvmap_count(&map) != nrf_802154_kvmap_count(&ref_map)) ||
+            (m_crit_sect_depth != 0U))
+        {
+            if (mismatches < 5U)
+            {
+                printf("mismatch: op %u result %d ref %d count %zu ref %zu\n",
+                       (unsigned)op, result, ref_result,
+                       nrf_802154_kvmap_count(&map), nrf_802154_kvmap_count(&ref_map));
+            }
+
+            mismatches++;
+        }
+    }
+
+    printf("equivalence: %u operations, %u mismatches\n",
+           (unsigned)BENCH_CHECK_OPS, (unsigned)mismatches);
+
+    return mismatches;
+}
+
+static double outstanding_bench(bool ref, uint32_t outstanding, uint32_t * p_missed)
+{
+    nrf_802154_kvmap_t map;
+    uint16_t           order[BENCH_POOL_SIZE];
+    uint32_t           handle = 0U;
+    uint32_t           found  = 0U;
+    uint64_t           best   = UINT64_MAX;
+
+    if (ref)
+    {
+        nrf_802154_kvmap_ref_init(&map, m_ref_map_memory, sizeof(m_ref_map_memory),
+                                  sizeof(void *), sizeof(uint32_t));
+    }
+    else
+    {
+        nrf_802154_kvmap_init(&map, m_map_memory, sizeof(m_map_memory),
+                              sizeof(void *), sizeof(uint32_t));
+    }
+
+    // The first outstanding entries of the shuffled pool order are the outstanding buffers,
+    // added in the order they are handed out, so their addresses are not sorted.
+    for (uint32_t i = 0U; i < BENCH_POOL_SIZE; i++)
+    {
+        uint32_t j = rng_get() % (i + 1U);
+
+        order[i] = order[j];
+        order[j] = (uint16_t)i;
+    }
+
+    for (uint32_t i = 0U; i < outstanding; i++)
+    {
+        const void * p_key = m_pool[order[i]];
+
+        if (ref)
+        {
+            (void)nrf_802154_kvmap_ref_add(&map, &p_key, &handle);
+        }
+        else
+        {
+            (void)nrf_802154_kvmap_add(&map, &p_key, &handle);
+        }
+
+        handle++;
+    }
+
+    for (uint32_t rep = 0U; rep < BENCH_REPEATS; rep++)
+    {
+        uint64_t start = ticks_get();
+
+        for (uint32_t op = 0U; op < BENCH_OPS_PER_PASS; op++)
+        {
+            // The buffer is returned, and a free one is handed out in its place.
+            uint32_t     idx   = rng_get() % outstanding;
+            uint32_t     free  = outstanding + rng_get() % (BENCH_POOL_SIZE - outstanding);
+            const void * p_old = m_pool[order[idx]];
+            const void * p_new = m_pool[order[free]];
+            uint16_t     tmp   = order[idx];
+            uint32_t     value;
+
+            order[idx]  = order[free];
+            order[free] = tmp;
+
+            if (ref)
+            {
+                found += nrf_802154_kvmap_ref_search(&map, &p_old, &value) ? 1U : 0U;
+                found += nrf_802154_kvmap_ref_remove(&map, &p_old) ? 1U : 0U;
+                found += nrf_802154_kvmap_ref_add(&map, &p_new, &handle) ? 1U : 0U;
+            }
+            else
+            {
+                found += nrf_802154_kvmap_search(&map, &p_old, &value) ? 1U : 0U;
+                found += nrf_802154_kvmap_remove(&map, &p_old) ? 1U : 0U;
+                found += nrf_802154_kvmap_add(&map, &p_new, &handle) ? 1U : 0U;
+            }
+
+            handle++;
+        }
+
+        uint64_t elapsed = ticks_get() - start;
+
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    *p_missed = 3U * BENCH_REPEATS * BENCH_OPS_PER_PASS - found;
+
+    return (double)best / (double)BENCH_OPS_PER_PASS;
+}
+
+int main(void)
+{
+    static const uint32_t outstanding[] = {8U, 32U, 128U};
+
+    uint32_t mismatches = equivalence_check();
+
+#if defined(__x86_64__) || defined(__i386__)
+    printf("search+remove+add, TSC ticks per buffer, best of %u passes\n",
+#else
+    printf("search+remove+add, nanoseconds per buffer, best of %u passes\n",
+#endif
+           (unsigned)BENCH_REPEATS);
+
+    for (size_t i = 0U; i < sizeof(outstanding) / sizeof(outstanding[0]); i++)
+    {
+        uint32_t ref_missed;
+        uint32_t missed;
+        double   ref_ticks = outstanding_bench(true, outstanding[i], &ref_missed);
+        double   ticks     = outstanding_bench(false, outstanding[i], &missed);
+
+        printf("%3u outstanding: linear search %7.1f, binary search %7.1f\n",
+               (unsigned)outstanding[i], ref_ticks, ticks);
+
+        // Every operation of the pass must succeed, otherwise the map size is not the measured one.
+        mismatches += ref_missed + missed;
+    }
+
+    return (mismatches == 0U) ? 0 : 1;
+}
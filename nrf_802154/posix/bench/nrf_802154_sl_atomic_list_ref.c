@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host implementation of the ordered list API of nrf_802154_sl_atomic_list.h.
+ *
+ * The list used by the service layer is a part of the prebuilt service layer library, which
+ * cannot be linked on the host. This file implements the same API in the same way as
+ * nrf_802154_sl_atomic_skiplist.c does, with a single level: the place of an item is searched
+ * from the list head and every pointer store is guarded with the 8-bit list bump counter.
+ * It is the baseline of the skip list benchmark.
+ */
+
+#include "nrf_802154_sl_atomic_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nrfx.h>
+
+#include "nrf_802154_sl_atomics.h"
+
+typedef nrf_802154_sl_atomic_list_membership_capability_t capability_t;
+
+/** @brief Number of times an operation searched the list again, because it changed. */
+uint32_t nrf_802154_sl_atomic_list_ref_retries;
+
+static inline capability_t * capability_get(void * p_item, size_t offset)
+{
+    return (capability_t *)((uint8_t *)p_item + offset);
+}
+
+static inline void * volatile * next_slot_get(nrf_802154_sl_atomic_list_t * p_list,
+                                              void                        * p_pred,
+                                              size_t                        offset)
+{
+    return (p_pred == NULL) ? &p_list->p_head : &capability_get(p_pred, offset)->p_next;
+}
+
+static inline bool list_unchanged(nrf_802154_sl_atomic_list_t * p_list, uint8_t bump)
+{
+    return p_list->bump_counter == bump;
+}
+
+static bool guarded_store(nrf_802154_sl_atomic_list_t * p_list,
+                          void * volatile             * p_slot,
+                          void                        * p_expected,
+                          void                        * p_desired,
+                          uint8_t                       bump)
+{
+    __DMB();
+
+    do
+    {
+        void * p_value = (void *)(uintptr_t)__LDREXW((volatile uint32_t *)p_slot);
+
+        if ((p_value != p_expected) || !list_unchanged(p_list, bump))
+        {
+            __CLREX();
+            return false;
+        }
+    }
+    while (__STREXW((uint32_t)(uintptr_t)p_desired, (volatile uint32_t *)p_slot));
+
+    __DMB();
+
+    return true;
+}
+
+static void bump_increment(nrf_802154_sl_atomic_list_t * p_list)
+{
+    uint8_t bump;
+
+    do
+    {
+        bump = nrf_802154_sl_atomic_load_u8((uint8_t *)&p_list->bump_counter);
+    }
+    while (!nrf_802154_sl_atomic_cas_u8((uint8_t *)&p_list->bump_counter, &bump, bump + 1U));
+}
+
+static void retry_count(void)
+{
+    nrf_802154_sl_atomic_add_u32(&nrf_802154_sl_atomic_list_ref_retries, 1U);
+}
+
+void nrf_802154_sl_atomic_list_init(nrf_802154_sl_atomic_list_t * p_list)
+{
+    p_list->p_head       = NULL;
+    p_list->bump_counter = 0U;
+}
+
+void nrf_802154_sl_atomic_list_insert_ordered(
+    nrf_802154_sl_atomic_list_t * p_list,
+    void                        * p_item,
+    size_t                        offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t  compare_func)
+{
+    while (true)
+    {
+        uint8_t bump   = nrf_802154_sl_atomic_load_u8((uint8_t *)&p_list->bump_counter);
+        void  * p_pred = NULL;
+        void  * p_succ = p_list->p_head;
+
+        while ((p_succ != NULL) && (compare_func(p_item, p_succ) >= 0) &&
+               list_unchanged(p_list, bump))
+        {
+            p_pred = p_succ;
+            p_succ = *next_slot_get(p_list, p_pred, offsetof_membership_capability);
+        }
+
+        capability_get(p_item, offsetof_membership_capability)->p_next = p_succ;
+
+        if (guarded_store(p_list,
+                          next_slot_get(p_list, p_pred, offsetof_membership_capability),
+                          p_succ,
+                          p_item,
+                          bump))
+        {
+            bump_increment(p_list);
+            return;
+        }
+
+        retry_count();
+    }
+}
+
+bool nrf_802154_sl_atomic_list_remove(nrf_802154_sl_atomic_list_t * p_list,
+                                      void                        * p_item,
+                                      size_t                        offsetof_membership_capability)
+{
+    while (true)
+    {
+        uint8_t bump   = nrf_802154_sl_atomic_load_u8((uint8_t *)&p_list->bump_counter);
+        void  * p_pred = NULL;
+        void  * p_succ = p_list->p_head;
+
+        while ((p_succ != NULL) && (p_succ != p_item) && list_unchanged(p_list, bump))
+        {
+            p_pred = p_succ;
+            p_succ = *next_slot_get(p_list, p_pred, offsetof_membership_capability);
+        }
+
+        if (list_unchanged(p_list, bump))
+        {
+            if (p_succ == NULL)
+            {
+                return false;
+            }
+
+            if (guarded_store(p_list,
+                              next_slot_get(p_list, p_pred, offsetof_membership_capability),
+                              p_item,
+                              capability_get(p_item, offsetof_membership_capability)->p_next,
+                              bump))
+            {
+                bump_increment(p_list);
+                return true;
+            }
+        }
+
+        retry_count();
+    }
+}
+
+void * nrf_802154_sl_atomic_list_head_peek(nrf_802154_sl_atomic_list_t * p_list)
+{
+    return p_list->p_head;
+}
+
+void * nrf_802154_sl_atomic_list_remove_head_if_criteria_met(
+    nrf_802154_sl_atomic_list_t * p_list,
+    size_t                        offsetof_membership_capability,
+    nrf_802154_sl_checker_func_t  checker_func,
+    const void                  * p_checker_func_param)
+{
+    while (true)
+    {
+        uint8_t bump   = nrf_802154_sl_atomic_load_u8((uint8_t *)&p_list->bump_counter);
+        void  * p_head = p_list->p_head;
+
+        if ((p_head == NULL) || !checker_func(p_head, p_checker_func_param))
+        {
+            return NULL;
+        }
+
+        if (guarded_store(p_list,
+                          &p_list->p_head,
+                          p_head,
+                          capability_get(p_head, offsetof_membership_capability)->p_next,
+                          bump))
+        {
+            bump_increment(p_list);
+            return p_head;
+        }
+
+        retry_count();
+    }
+}
@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host benchmark of the lock-free skip list against the ordered list of the service layer.
+ *
+ * The ordered list is the host implementation of nrf_802154_sl_atomic_list.h in
+ * posix/bench/nrf_802154_sl_atomic_list_ref.c, as the service layer one is prebuilt.
+ * For each number of pending items in @ref m_items_counts, both structures are filled with
+ * items with random keys, as timers with random trigger times. Then the program repeatedly
+ * removes a random item and inserts it again with a new key, which is how a timer is
+ * rescheduled, and measures:
+ *  - the time of a removal and an insertion without preemption,
+ *  - the same with a SIGALRM handler that preempts the operations every @ref BENCH_PERIOD_US
+ *    and reschedules @ref BENCH_ISR_OPERATIONS items of its own, as an interrupt handler does,
+ *  - the number of times the operations searched the structure again because the handler
+ *    modified it, per thousand operations.
+ * The time with preemption includes the operations of the handler.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -Iposix/include -Isl/include \
+ *       posix/bench/nrf_802154_sl_atomic_skiplist_bench.c \
+ *       posix/bench/nrf_802154_sl_atomic_list_ref.c posix/src/nrfx_host.c \
+ *       sl/sl_opensource/src/nrf_802154_sl_atomic_skiplist.c -o skiplist_bench
+ *   ./skiplist_bench
+ *
+ * The program returns a non-zero status if a removal fails or a structure is out of order
+ * at the end.
+ */
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154_sl_atomic_list.h"
+#include "nrf_802154_sl_atomic_skiplist.h"
+
+#define BENCH_OPERATIONS     1000000U ///< Reschedules measured for each configuration.
+#define BENCH_PERIOD_US      20       ///< Period of the preempting handler.
+#define BENCH_ISR_OPERATIONS 2U       ///< Reschedules performed by each run of the handler.
+#define BENCH_ISR_ITEMS      8U       ///< Items rescheduled by the handler.
+#define BENCH_MAX_ITEMS      1024U
+
+typedef struct
+{
+    uint32_t                                              key;
+    nrf_802154_sl_atomic_list_membership_capability_t     list_cap;
+    nrf_802154_sl_atomic_skiplist_membership_capability_t skiplist_cap;
+} bench_item_t;
+
+/** @brief Operations of a benchmarked structure. */
+typedef struct
+{
+    const char * p_name;
+    void      (* init)(void);
+    void      (* insert)(bench_item_t * p_item);
+    bool      (* remove)(bench_item_t * p_item);
+    uint32_t  (* retries_get)(void);
+    bool      (* check)(uint32_t count);
+} bench_structure_t;
+
+extern uint32_t nrf_802154_sl_atomic_list_ref_retries;
+
+static const uint32_t m_items_counts[] = {10U, 100U, 500U, 1000U};
+
+static nrf_802154_sl_atomic_list_t       m_list;
+static nrf_802154_sl_atomic_skiplist_t   m_skiplist;
+static bench_item_t                    * m_items;
+static const bench_structure_t         * mp_structure;
+static uint32_t                          m_rng_state = 1U;
+static uint32_t                          m_isr_rng_state = 7U;
+static volatile uint32_t                 m_isr_operations;
+static volatile uint32_t                 m_errors;
+
+static uint32_t rng_get(uint32_t * p_state)
+{
+    *p_state ^= *p_state << 13;
+    *p_state ^= *p_state >> 17;
+    *p_state ^= *p_state << 5;
+
+    return *p_state;
+}
+
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int_fast8_t item_compare(const void * p_a, const void * p_b)
+{
+    uint32_t a = ((const bench_item_t *)p_a)->key;
+    uint32_t b = ((const bench_item_t *)p_b)->key;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static void list_init(void)
+{
+    nrf_802154_sl_atomic_list_init(&m_list);
+    nrf_802154_sl_atomic_list_ref_retries = 0U;
+}
+
+static void list_insert(bench_item_t * p_item)
+{
+    nrf_802154_sl_atomic_list_insert_ordered(&m_list,
+                                             p_item,
+                                             offsetof(bench_item_t, list_cap),
+                                             item_compare);
+}
+
+static bool list_remove(bench_item_t * p_item)
+{
+    return nrf_802154_sl_atomic_list_remove(&m_list, p_item, offsetof(bench_item_t, list_cap));
+}
+
+static uint32_t list_retries_get(void)
+{
+    return nrf_802154_sl_atomic_list_ref_retries;
+}
+
+static bool list_check(uint32_t count)
+{
+    const bench_item_t * p_prev = NULL;
+    const bench_item_t * p_item = m_list.p_head;
+
+    for (; p_item != NULL; p_item = p_item->list_cap.p_next, count--)
+    {
+        if ((count == 0U) || ((p_prev != NULL) && (p_prev->key > p_item->key)))
+        {
+            return false;
+        }
+
+        p_prev = p_item;
+    }
+
+    return count == 0U;
+}
+
+static void skiplist_init(void)
+{
+    nrf_802154_sl_atomic_skiplist_init(&m_skiplist);
+}
+
+static void skiplist_insert(bench_item_t * p_item)
+{
+    nrf_802154_sl_atomic_skiplist_insert_ordered(&m_skiplist,
+                                                 p_item,
+                                                 offsetof(bench_item_t, skiplist_cap),
+                                                 item_compare);
+}
+
+static bool skiplist_remove(bench_item_t * p_item)
+{
+    return nrf_802154_sl_atomic_skiplist_remove(&m_skiplist,
+                                                p_item,
+                                                offsetof(bench_item_t, skiplist_cap),
+                                                item_compare);
+}
+
+static uint32_t skiplist_retries_get(void)
+{
+    return m_skiplist.retries;
+}
+
+static bool skiplist_check(uint32_t count)
+{
+    const bench_item_t * p_prev = NULL;
+    const bench_item_t * p_item = m_skiplist.p_head[0];
+
+    for (; p_item != NULL; p_item = p_item->skiplist_cap.p_next[0], count--)
+    {
+        if ((count == 0U) || ((p_prev != NULL) && (p_prev->key > p_item->key)))
+        {
+            return false;
+        }
+
+        p_prev = p_item;
+    }
+
+    return count == 0U;
+}
+
+static const bench_structure_t m_structures[] =
+{
+    {"list", list_init, list_insert, list_remove, list_retries_get, list_check},
+    {"skiplist", skiplist_init, skiplist_insert, skiplist_remove, skiplist_retries_get,
+     skiplist_check},
+};
+
+/** @brief Removes an item and inserts it again with a new random key. */
+static void item_reschedule(bench_item_t * p_item, uint32_t * p_rng_state)
+{
+    if (!mp_structure->remove(p_item))
+    {
+        m_errors++;
+    }
+
+    p_item->key = rng_get(p_rng_state);
+    mp_structure->insert(p_item);
+}
+
+static void isr_handler(int signal)
+{
+    (void)signal;
+
+    if (!nrfx_host_exception_enter())
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < BENCH_ISR_OPERATIONS; i++)
+    {
+        item_reschedule(&m_items[rng_get(&m_isr_rng_state) % BENCH_ISR_ITEMS], &m_isr_rng_state);
+    }
+
+    m_isr_operations += BENCH_ISR_OPERATIONS;
+
+    __CLREX();
+}
+
+static void isr_period_set(long period_us)
+{
+    struct itimerval timer;
+
+    memset(&timer, 0, sizeof(timer));
+    timer.it_interval.tv_usec = period_us;
+    timer.it_value            = timer.it_interval;
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/**
+ * @brief Reschedules random items of the main loop and returns the time per operation in ns.
+ *
+ * The first @ref BENCH_ISR_ITEMS items belong to the handler, the main loop reschedules
+ * the others.
+ */
+static double reschedules_measure(uint32_t count, bool preempted, uint32_t * p_retries)
+{
+    uint32_t retries = mp_structure->retries_get();
+    uint64_t start;
+    uint64_t elapsed;
+
+    m_isr_operations = 0U;
+
+    if (preempted)
+    {
+        isr_period_set(BENCH_PERIOD_US);
+    }
+
+    start = time_ns_get();
+
+    for (uint32_t i = 0U; i < BENCH_OPERATIONS; i++)
+    {
+        uint32_t index = BENCH_ISR_ITEMS + rng_get(&m_rng_state) % (count - BENCH_ISR_ITEMS);
+
+        item_reschedule(&m_items[index], &m_rng_state);
+    }
+
+    elapsed = time_ns_get() - start;
+
+    isr_period_set(0);
+
+    *p_retries = mp_structure->retries_get() - retries;
+
+    return (double)elapsed / (BENCH_OPERATIONS + m_isr_operations);
+}
+
+static bool structure_bench(const bench_structure_t * p_structure, uint32_t count)
+{
+    sigset_t isr_mask;
+    uint32_t retries;
+    double   idle_ns;
+    double   preempted_ns;
+    bool     ok;
+
+    mp_structure = p_structure;
+    m_errors     = 0U;
+    m_rng_state  = 1U;
+    p_structure->init();
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        m_items[i].key = rng_get(&m_rng_state);
+        p_structure->insert(&m_items[i]);
+    }
+
+    idle_ns      = reschedules_measure(count, false, &retries);
+    preempted_ns = reschedules_measure(count, true, &retries);
+
+    sigemptyset(&isr_mask);
+    sigaddset(&isr_mask, SIGALRM);
+    sigprocmask(SIG_BLOCK, &isr_mask, NULL);
+    ok = p_structure->check(count) && (m_errors == 0U);
+    sigprocmask(SIG_UNBLOCK, &isr_mask, NULL);
+
+    printf("%5u %-9s %10.0f %10.0f %10.2f\n",
+           (unsigned)count,
+           p_structure->p_name,
+           idle_ns,
+           preempted_ns,
+           1000.0 * retries / (BENCH_OPERATIONS + m_isr_operations));
+
+    return ok;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    m_items = mmap(NULL, sizeof(bench_item_t) * BENCH_MAX_ITEMS, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+    if (m_items == MAP_FAILED)
+    {
+        printf("cannot allocate the items in the low 4 GB\n");
+        return 1;
+    }
+
+    signal(SIGALRM, isr_handler);
+
+    printf("nanoseconds per reschedule, preempted every %u us, skip list levels %u\n",
+           (unsigned)BENCH_PERIOD_US,
+           (unsigned)NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS);
+    printf("items structure      idle  preempted  retries/1k\n");
+
+    for (size_t i = 0U; i < sizeof(m_items_counts) / sizeof(m_items_counts[0]); i++)
+    {
+        for (size_t j = 0U; j < sizeof(m_structures) / sizeof(m_structures[0]); j++)
+        {
+            ok &= structure_bench(&m_structures[j], m_items_counts[i]);
+        }
+    }
+
+    if (!ok)
+    {
+        printf("FAILED\n");
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host replacement of the nrfx EGU HAL for the POSIX benchmarks and tests.
+ *
+ * Triggering a task sets the corresponding event. If the interrupt of the event is enabled,
+ * @ref nrfx_host_egu_irq is called at once, in place of the interrupt handler. The program
+ * that uses this file defines @ref nrfx_host_egu_irq.
+ */
+
+#ifndef NRF_EGU_H__
+#define NRF_EGU_H__
+
+#include <nrfx.h>
+
+/** @brief Number of channels of an EGU instance. */
+#define NRFX_HOST_EGU_CHANNELS 16
+
+/** @brief Registers of an EGU instance. */
+typedef struct
+{
+    volatile uint32_t events; ///< Bit n is set if the event of channel n is set.
+    volatile uint32_t inten;  ///< Bit n is set if the interrupt of channel n is enabled.
+} NRF_EGU_Type;
+
+extern NRF_EGU_Type nrfx_host_egu0;
+
+#define NRF_EGU0 (&nrfx_host_egu0)
+
+#define NRFX_HOST_EGU_CHANNEL_LIST(f)                                         \
+    f(0) f(1) f(2) f(3) f(4) f(5) f(6) f(7) f(8) f(9) f(10) f(11) f(12) f(13) \
+    f(14) f(15)
+
+#define NRFX_HOST_EGU_TASK(n)  NRF_EGU_TASK_TRIGGER ## n = n,
+#define NRFX_HOST_EGU_EVENT(n) NRF_EGU_EVENT_TRIGGERED ## n = n,
+#define NRFX_HOST_EGU_INT(n)   NRF_EGU_INT_TRIGGERED ## n = 1UL << n,
+
+/** @brief EGU tasks, numbered as the channels. */
+typedef enum
+{
+    NRFX_HOST_EGU_CHANNEL_LIST(NRFX_HOST_EGU_TASK)
+} nrf_egu_task_t;
+
+/** @brief EGU events, numbered as the channels. */
+typedef enum
+{
+    NRFX_HOST_EGU_CHANNEL_LIST(NRFX_HOST_EGU_EVENT)
+} nrf_egu_event_t;
+
+/** @brief EGU interrupts, as the masks of the channels. */
+typedef enum
+{
+    NRFX_HOST_EGU_CHANNEL_LIST(NRFX_HOST_EGU_INT)
+} nrf_egu_int_mask_t;
+
+/**
+ * @brief Handles the interrupt of an EGU instance.
+ *
+ * Defined by the program that uses this file.
+ *
+ * @param[in]  p_reg  EGU instance whose enabled event is set.
+ */
+void nrfx_host_egu_irq(NRF_EGU_Type * p_reg);
+
+__STATIC_INLINE void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t task)
+{
+    p_reg->events |= 1UL << task;
+
+    if ((p_reg->inten & (1UL << task)) != 0U)
+    {
+        nrfx_host_egu_irq(p_reg);
+    }
+}
+
+__STATIC_INLINE bool nrf_egu_event_check(NRF_EGU_Type const * p_reg, nrf_egu_event_t event)
+{
+    return (p_reg->events & (1UL << event)) != 0U;
+}
+
+__STATIC_INLINE void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t event)
+{
+    p_reg->events &= ~(1UL << event);
+}
+
+__STATIC_INLINE void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t mask)
+{
+    p_reg->inten |= mask;
+}
+
+__STATIC_INLINE void nrf_egu_int_disable(NRF_EGU_Type * p_reg, uint32_t mask)
+{
+    p_reg->inten &= ~mask;
+}
+
+#endif // NRF_EGU_H__
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host replacement of the nrfx RADIO HAL for the POSIX benchmarks and tests.
+ *
+ * Only the types used by the public driver headers and the instance used to get the interrupt
+ * number of the peripheral are provided. Its registers are not accessed on the host.
+ */
+
+#ifndef NRF_RADIO_H__
+#define NRF_RADIO_H__
+
+#include <nrfx.h>
+
+/** @brief Registers of the RADIO peripheral. */
+typedef struct
+{
+    volatile uint32_t reserved;
+} NRF_RADIO_Type;
+
+extern NRF_RADIO_Type nrfx_host_radio;
+
+#define NRF_RADIO (&nrfx_host_radio)
+
+/** @brief RADIO Clear Channel Assessment modes. */
+typedef enum
+{
+    NRF_RADIO_CCA_MODE_ED             = 0x00,
+    NRF_RADIO_CCA_MODE_CARRIER        = 0x01,
+    NRF_RADIO_CCA_MODE_CARRIER_AND_ED = 0x02,
+    NRF_RADIO_CCA_MODE_CARRIER_OR_ED  = 0x03,
+} nrf_radio_cca_mode_t;
+
+#endif // NRF_RADIO_H__
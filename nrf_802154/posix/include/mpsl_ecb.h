@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host replacement of the MPSL ECB header for the POSIX benchmarks and tests.
+ *
+ * The block encryption is implemented in software in posix/src/mpsl_ecb_sw.c.
+ */
+
+#ifndef MPSL_ECB_H__
+#define MPSL_ECB_H__
+
+#include <stdint.h>
+
+/** @brief Data block processed by the ECB, laid out as the ECB peripheral data structure. */
+typedef struct
+{
+    uint32_t key[4];         ///< AES-128 key.
+    uint8_t  cleartext[16];  ///< Input block.
+    uint8_t  ciphertext[16]; ///< Output block.
+} mpsl_ecb_hal_data_t;
+
+/**
+ * @brief Encrypts a single block with AES-128.
+ *
+ * @param[inout] p_ecb_data  Key and input block, the encrypted block is stored in @c ciphertext.
+ */
+void mpsl_ecb_block_encrypt(mpsl_ecb_hal_data_t * p_ecb_data);
+
+#endif // MPSL_ECB_H__
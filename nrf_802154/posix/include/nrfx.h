@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host replacement of the nrfx header for the POSIX benchmarks and tests.
+ *
+ * The file provides the CMSIS definitions used by the driver and service layer modules that
+ * are built on the host. It is not a part of the driver build.
+ */
+
+#ifndef NRFX_H__
+#define NRFX_H__
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+
+#ifndef __ALIGN
+#define __ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+
+#ifndef NRFX_MIN
+#define NRFX_MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+#ifndef NRFX_MAX
+#define NRFX_MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#ifndef NRFX_ARRAY_SIZE
+#define NRFX_ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#endif
+
+#ifndef NRFX_CONCAT_2
+#define NRFX_CONCAT_2(p1, p2)      NRFX_CONCAT_2_(p1, p2)
+#define NRFX_CONCAT_2_(p1, p2)     p1 ## p2
+#endif
+
+#ifndef NRFX_CONCAT_3
+#define NRFX_CONCAT_3(p1, p2, p3)  NRFX_CONCAT_3_(p1, p2, p3)
+#define NRFX_CONCAT_3_(p1, p2, p3) p1 ## p2 ## p3
+#endif
+
+/* The host has no interrupt controller. The interrupt numbers are not used by the host programs. */
+__STATIC_INLINE uint32_t nrfx_get_irq_number(void const * p_reg)
+{
+    (void)p_reg;
+
+    return 0U;
+}
+
+/* Peripherals referenced by the public headers. Their registers are not accessed on the host. */
+typedef struct
+{
+    volatile uint32_t reserved;
+} NRF_TIMER_Type;
+
+#define __DMB() __asm__ volatile ("" ::: "memory")
+#define __DSB() __asm__ volatile ("" ::: "memory")
+#define __ISB() __asm__ volatile ("" ::: "memory")
+
+__STATIC_INLINE uint32_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+/**
+ * Exclusive access emulation, defined in posix/src/nrfx_host.c.
+ *
+ * An exclusive load sets the exclusive monitor and an exclusive store succeeds only if
+ * the monitor is still set. A signal handler that plays the role of an interrupt handler
+ * calls @ref nrfx_host_exception_enter first, which clears the monitor as the exception
+ * entry does on the target. The stores are 32 bits wide, so pointers stored through
+ * @ref __STREXW must point to the low 4 GB of the address space.
+ */
+extern volatile sig_atomic_t nrfx_host_exclusive_monitor;
+extern volatile sig_atomic_t nrfx_host_exclusive_store;
+
+/**
+ * @brief Emulates the exception entry.
+ *
+ * @retval true   The exception can be handled, the exclusive monitor has been cleared.
+ * @retval false  An exclusive store is in progress, which the exception cannot preempt
+ *                on the target. The exception must not be handled.
+ */
+__STATIC_INLINE bool nrfx_host_exception_enter(void)
+{
+    if (nrfx_host_exclusive_store)
+    {
+        return false;
+    }
+
+    nrfx_host_exclusive_monitor = 0;
+
+    return true;
+}
+
+#define NRFX_HOST_LDREX(type, name)                 \
+    __STATIC_INLINE type name(volatile type * p_addr) \
+    {                                               \
+        nrfx_host_exclusive_monitor = 1;            \
+        __DMB();                                    \
+        return *p_addr;                             \
+    }
+
+#define NRFX_HOST_STREX(type, name)                                   \
+    __STATIC_INLINE uint32_t name(type value, volatile type * p_addr) \
+    {                                                                 \
+        uint32_t result = 1U;                                         \
+                                                                      \
+        nrfx_host_exclusive_store = 1;                                \
+        __DMB();                                                      \
+        if (nrfx_host_exclusive_monitor)                              \
+        {                                                             \
+            *p_addr                     = value;                      \
+            nrfx_host_exclusive_monitor = 0;                          \
+            result                      = 0U;                         \
+        }                                                             \
+        __DMB();                                                      \
+        nrfx_host_exclusive_store = 0;                                \
+        return result;                                                \
+    }
+
+NRFX_HOST_LDREX(uint32_t, __LDREXW)
+NRFX_HOST_LDREX(uint16_t, __LDREXH)
+NRFX_HOST_LDREX(uint8_t, __LDREXB)
+
+NRFX_HOST_STREX(uint32_t, __STREXW)
+NRFX_HOST_STREX(uint16_t, __STREXH)
+NRFX_HOST_STREX(uint8_t, __STREXB)
+
+#define __CLREX() (nrfx_host_exclusive_monitor = 0)
+
+/* The host programs run in a single thread. Signal handlers are not masked. */
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+    return 0U;
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t primask)
+{
+    (void)primask;
+}
+
+__STATIC_INLINE void __disable_irq(void)
+{
+}
+
+#endif // NRFX_H__
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Software AES-128 replacement of the MPSL ECB block encryption for the POSIX benchmarks
+ *   and tests.
+ *
+ * The implementation follows FIPS-197 byte by byte. It is meant for checking the AES-CCM*
+ * transformation on the host, not for speed or for resistance to side channel attacks.
+ */
+
+#include "mpsl_ecb.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#define AES_BLOCK_SIZE 16U                                  ///< Size of the AES block.
+#define AES_ROUNDS     10U                                  ///< Number of rounds of AES-128.
+#define AES_ROUND_KEYS ((AES_ROUNDS + 1U) * AES_BLOCK_SIZE) ///< Size of the expanded key.
+
+static const uint8_t m_sbox[256] =
+{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+/** @brief Multiplies by x in GF(2^8). */
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x >> 7) * 0x1bU));
+}
+
+static void key_expand(const uint8_t * p_key, uint8_t * p_round_keys)
+{
+    uint8_t rcon = 1U;
+
+    memcpy(p_round_keys, p_key, AES_BLOCK_SIZE);
+
+    for (size_t i = AES_BLOCK_SIZE; i < AES_ROUND_KEYS; i += 4U)
+    {
+        uint8_t word[4];
+
+        memcpy(word, &p_round_keys[i - 4U], sizeof(word));
+
+        if ((i % AES_BLOCK_SIZE) == 0U)
+        {
+            uint8_t first = word[0];
+
+            word[0] = m_sbox[word[1]] ^ rcon;
+            word[1] = m_sbox[word[2]];
+            word[2] = m_sbox[word[3]];
+            word[3] = m_sbox[first];
+            rcon    = xtime(rcon);
+        }
+
+        for (size_t j = 0U; j < sizeof(word); j++)
+        {
+            p_round_keys[i + j] = p_round_keys[i - AES_BLOCK_SIZE + j] ^ word[j];
+        }
+    }
+}
+
+static void mix_columns(uint8_t * p_state)
+{
+    for (size_t c = 0U; c < 4U; c++)
+    {
+        uint8_t * p_col = &p_state[4U * c];
+        uint8_t   a0    = p_col[0];
+        uint8_t   a1    = p_col[1];
+        uint8_t   a2    = p_col[2];
+        uint8_t   a3    = p_col[3];
+        uint8_t   all   = a0 ^ a1 ^ a2 ^ a3;
+
+        p_col[0] ^= all ^ xtime(a0 ^ a1);
+        p_col[1] ^= all ^ xtime(a1 ^ a2);
+        p_col[2] ^= all ^ xtime(a2 ^ a3);
+        p_col[3] ^= all ^ xtime(a3 ^ a0);
+    }
+}
+
+void mpsl_ecb_block_encrypt(mpsl_ecb_hal_data_t * p_ecb_data)
+{
+    uint8_t round_keys[AES_ROUND_KEYS];
+    uint8_t state[AES_BLOCK_SIZE];
+    uint8_t shifted[AES_BLOCK_SIZE];
+
+    key_expand((const uint8_t *)p_ecb_data->key, round_keys);
+
+    for (size_t i = 0U; i < AES_BLOCK_SIZE; i++)
+    {
+        state[i] = p_ecb_data->cleartext[i] ^ round_keys[i];
+    }
+
+    for (size_t round = 1U; round <= AES_ROUNDS; round++)
+    {
+        // SubBytes and ShiftRows. Byte i of the state is row i % 4 of column i / 4.
+        for (size_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            shifted[i] = m_sbox[state[(i + 4U * (i % 4U)) % AES_BLOCK_SIZE]];
+        }
+
+        if (round < AES_ROUNDS)
+        {
+            mix_columns(shifted);
+        }
+
+        for (size_t i = 0U; i < AES_BLOCK_SIZE; i++)
+        {
+            state[i] = shifted[i] ^ round_keys[AES_BLOCK_SIZE * round + i];
+        }
+    }
+
+    memcpy(p_ecb_data->ciphertext, state, AES_BLOCK_SIZE);
+}
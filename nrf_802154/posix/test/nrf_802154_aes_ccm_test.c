@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the AES-CCM* transformation that uses the ECB peripheral.
+ *
+ * The ECB peripheral is replaced with the software AES-128 in posix/src/mpsl_ecb_sw.c.
+ * The test checks:
+ *  - the software AES-128 against the FIPS-197 Appendix C.1 example,
+ *  - the frames of IEEE Std 802.15.4-2020 Annex C.2 (beacon with MIC-64, data frame with ENC,
+ *    MAC command with ENC-MIC-64), secured through the nrf_802154_aes_ccm.h API into
+ *    the transmit work buffer,
+ *  - the same frames secured in separate transformation contexts into separate work buffers,
+ *    with all the contexts prepared before any transformation is started.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DCONFIG_MPSL -DNRF_802154_ENCRYPTION_ACCELERATOR_ECB \
+ *       -DNRF_802154_SERIALIZATION_HOST=1 -Iposix/include -Icommon/include -Idriver/src \
+ *       posix/test/nrf_802154_aes_ccm_test.c posix/src/mpsl_ecb_sw.c \
+ *       driver/src/nrf_802154_aes_ccm_acc_ecb.c driver/src/nrf_802154_tx_work_buffer.c \
+ *       -o aes_ccm_test
+ *   ./aes_ccm_test
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mpsl_ecb.h"
+#include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_aes_ccm_acc_ecb.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_work_buffer.h"
+
+#define VECTORS_COUNT (sizeof(m_vectors) / sizeof(m_vectors[0]))
+
+/** @brief Frame secured with the Annex C key and its expected secured payload and MIC. */
+typedef struct
+{
+    const char    * p_name;
+    const uint8_t * p_header;      ///< Header, authenticated but not encrypted.
+    uint8_t         header_len;
+    const uint8_t * p_payload;     ///< Payload to be encrypted.
+    uint8_t         payload_len;
+    uint8_t         mic_level;     ///< Index of the MIC size: 0, 4, 8 or 16 octets.
+    uint8_t         nonce[NRF_802154_AES_CCM_NONCE_SIZE];
+    const uint8_t * p_expected;    ///< Expected encrypted payload followed by the MIC.
+    uint8_t         expected_len;
+} vector_t;
+
+static const uint8_t m_key[AES_CCM_KEY_SIZE] =
+{
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+};
+
+// C.2.1 Beacon frame, MIC-64.
+static const uint8_t m_beacon_header[] =
+{
+    0x08, 0xd0, 0x84, 0x21, 0x43, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xde, 0xac,
+    0x02, 0x05, 0x00, 0x00, 0x00, 0x55, 0xcf, 0x00, 0x00, 0x51, 0x52, 0x53, 0x54
+};
+static const uint8_t m_beacon_expected[] = {0x22, 0x3b, 0xc1, 0xec, 0x84, 0x1a, 0xb5, 0x53};
+
+// C.2.2 Data frame, ENC.
+static const uint8_t m_data_header[] =
+{
+    0x69, 0xdc, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xde, 0xac,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xde, 0xac, 0x04, 0x05, 0x00, 0x00, 0x00
+};
+static const uint8_t m_data_payload[]  = {0x61, 0x62, 0x63, 0x64};
+static const uint8_t m_data_expected[] = {0xd4, 0x3e, 0x02, 0x2b};
+
+// C.2.3 MAC command frame, ENC-MIC-64.
+static const uint8_t m_command_header[] =
+{
+    0x2b, 0xdc, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xde, 0xac, 0xff,
+    0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xde, 0xac, 0x06, 0x05, 0x00, 0x00, 0x00, 0x01
+};
+static const uint8_t m_command_payload[]  = {0xce};
+static const uint8_t m_command_expected[] =
+{
+    0xd8, 0x4f, 0xde, 0x52, 0x90, 0x61, 0xf9, 0xc6, 0xf1
+};
+
+static const vector_t m_vectors[] =
+{
+    {
+        "C.2.1 beacon MIC-64",
+        m_beacon_header, sizeof(m_beacon_header), NULL, 0U, 2U,
+        {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02},
+        m_beacon_expected, sizeof(m_beacon_expected)
+    },
+    {
+        "C.2.2 data ENC",
+        m_data_header, sizeof(m_data_header), m_data_payload, sizeof(m_data_payload), 0U,
+        {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x04},
+        m_data_expected, sizeof(m_data_expected)
+    },
+    {
+        "C.2.3 command ENC-MIC-64",
+        m_command_header, sizeof(m_command_header), m_command_payload,
+        sizeof(m_command_payload), 2U,
+        {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06},
+        m_command_expected, sizeof(m_command_expected)
+    },
+};
+
+static uint8_t m_frames[VECTORS_COUNT][MAX_PACKET_SIZE + PHR_SIZE];
+static uint8_t m_work_buffers[VECTORS_COUNT][MAX_PACKET_SIZE + PHR_SIZE];
+
+static bool aes_check(void)
+{
+    // FIPS-197 Appendix C.1.
+    static const uint8_t expected[16] =
+    {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+
+    mpsl_ecb_hal_data_t ecb_data;
+
+    for (uint8_t i = 0U; i < 16U; i++)
+    {
+        ((uint8_t *)ecb_data.key)[i] = i;
+        ecb_data.cleartext[i]        = (uint8_t)(i * 0x11U);
+    }
+
+    mpsl_ecb_block_encrypt(&ecb_data);
+
+    return memcmp(ecb_data.ciphertext, expected, sizeof(expected)) == 0;
+}
+
+/**
+ * @brief Build the frame of a vector and the AES-CCM* data to secure it.
+ */
+static void vector_data_make(size_t index, nrf_802154_aes_ccm_data_t * p_data)
+{
+    const vector_t * p_vector  = &m_vectors[index];
+    uint8_t        * p_frame   = m_frames[index];
+    uint8_t          mic_sizes[] = {0U, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE};
+
+    memset(p_frame, 0, sizeof(m_frames[index]));
+    p_frame[PHR_OFFSET] = p_vector->header_len + p_vector->payload_len +
+                          mic_sizes[p_vector->mic_level] + FCS_SIZE;
+    memcpy(&p_frame[PHR_SIZE], p_vector->p_header, p_vector->header_len);
+
+    if (p_vector->payload_len != 0U)
+    {
+        memcpy(&p_frame[PHR_SIZE + p_vector->header_len],
+               p_vector->p_payload,
+               p_vector->payload_len);
+    }
+
+    memset(p_data, 0, sizeof(*p_data));
+    memcpy(p_data->key, m_key, sizeof(m_key));
+    memcpy(p_data->nonce, p_vector->nonce, sizeof(p_vector->nonce));
+    p_data->auth_data           = &p_frame[PHR_SIZE];
+    p_data->auth_data_len       = p_vector->header_len;
+    p_data->plain_text_data     = (p_vector->payload_len != 0U) ?
+                                  &p_frame[PHR_SIZE + p_vector->header_len] : NULL;
+    p_data->plain_text_data_len = p_vector->payload_len;
+    p_data->mic_level           = p_vector->mic_level;
+    p_data->raw_frame           = p_frame;
+}
+
+static bool vector_result_check(size_t index, const uint8_t * p_secured, const char * p_path)
+{
+    const vector_t * p_vector = &m_vectors[index];
+    bool             ok;
+
+    ok = (memcmp(&p_secured[PHR_SIZE], p_vector->p_header, p_vector->header_len) == 0) &&
+         (memcmp(&p_secured[PHR_SIZE + p_vector->header_len],
+                 p_vector->p_expected,
+                 p_vector->expected_len) == 0);
+
+    printf("%-26s %-8s %s\n", p_vector->p_name, p_path, ok ? "OK" : "FAIL");
+
+    return ok;
+}
+
+static bool tx_work_buffer_check(void)
+{
+    bool ok = true;
+
+    for (size_t i = 0U; i < VECTORS_COUNT; i++)
+    {
+        nrf_802154_aes_ccm_data_t data;
+
+        vector_data_make(i, &data);
+        nrf_802154_tx_work_buffer_reset(NULL);
+        nrf_802154_aes_ccm_transform_reset();
+
+        if (!nrf_802154_aes_ccm_transform_prepare(&data))
+        {
+            printf("%-26s %-8s FAIL (prepare)\n", m_vectors[i].p_name, "tx");
+            ok = false;
+            continue;
+        }
+
+        nrf_802154_aes_ccm_transform_start(m_frames[i]);
+
+        ok &= vector_result_check(i, nrf_802154_tx_work_buffer_get(m_frames[i]), "tx");
+    }
+
+    return ok;
+}
+
+static bool contexts_check(void)
+{
+    nrf_802154_aes_ccm_ctx_t ctxs[VECTORS_COUNT];
+    bool                     ok = true;
+
+    for (size_t i = 0U; i < VECTORS_COUNT; i++)
+    {
+        nrf_802154_aes_ccm_data_t data;
+
+        vector_data_make(i, &data);
+        nrf_802154_aes_ccm_ctx_reset(&ctxs[i]);
+
+        ok &= nrf_802154_aes_ccm_ctx_transform_prepare(&ctxs[i], &data, m_work_buffers[i]);
+    }
+
+    // Start in the reverse order, every context keeps its own prepared frame.
+    for (size_t i = VECTORS_COUNT; i > 0U; i--)
+    {
+        size_t index = i - 1U;
+
+        if (!nrf_802154_aes_ccm_ctx_transform_start(&ctxs[index], m_frames[index]))
+        {
+            printf("%-26s %-8s FAIL (start)\n", m_vectors[index].p_name, "context");
+            ok = false;
+            continue;
+        }
+
+        ok &= vector_result_check(index, m_work_buffers[index], "context");
+    }
+
+    return ok;
+}
+
+int main(void)
+{
+    bool ok = aes_check();
+
+    printf("%-26s %-8s %s\n", "FIPS-197 C.1 AES-128", "", ok ? "OK" : "FAIL");
+
+    ok &= tx_work_buffer_check();
+    ok &= contexts_check();
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the backlog of delayed RX windows.
+ *
+ * The delayed TRX module is built with a backlog of 512 windows. The radio scheduler offers
+ * @ref NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS delayed timeslots and denies the ones whose trigger
+ * time has passed. The scheduler, the timer of the service layer, the notification module and
+ * the request module are replaced by the test. An event loop advances the time to the earliest
+ * timeslot or timer and runs its callback. A started RX window receives until its timeout.
+ *
+ * Each scenario requests 300 windows in random order, 5 ms apart, and checks that:
+ *  - a window is not accepted twice,
+ *  - the windows start in the order of their start times,
+ *  - a cancelled window is never reported,
+ *  - every other window is reported exactly once, either with its timeout once it received,
+ *    or, if it could no longer be scheduled, as denied and counted in the delayed_rx_missed
+ *    counter. Only the windows that held the timeslots during a stall of the time start late,
+ *    and each of them is either received or aborted by the next one.
+ *
+ * The scenarios run the windows on time, with cancellations, after a stall of the time that
+ * makes the earliest windows stale, and after a stall while the notification queue is full
+ * from time to time.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -ffunction-sections -Wl,--gc-sections -DNRF52_SERIES \
+ *       -DNRF_802154_DELAYED_TRX_RX_BACKLOG_SIZE=512 \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/include -Idriver/src \
+ *       -Idriver/src/mac_features \
+ *       posix/test/nrf_802154_delayed_trx_backlog_test.c posix/src/nrfx_host.c \
+ *       driver/src/mac_features/nrf_802154_delayed_trx.c driver/src/nrf_802154_hmap.c \
+ *       driver/src/nrf_802154_queue.c -o delayed_trx_backlog_test
+ *   ./delayed_trx_backlog_test
+ *
+ * The section garbage collection drops most of the delayed transmission, which is not used by
+ * the test.
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154_delayed_trx.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_sl_timer.h"
+#include "rsch/nrf_802154_rsch.h"
+
+#define CHECK(cond)                                                            \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                      \
+        }                                                                      \
+    }                                                                          \
+    while (0)
+
+#define TEST_WINDOWS        300U
+#define TEST_TIMERS         16U
+#define TEST_FIRST_RX_TIME  10000U ///< Start time [us] of the window with identifier zero.
+#define TEST_RX_INTERVAL    5000U  ///< Distance [us] of the start times of the windows.
+#define TEST_RX_TIMEOUT     1000U  ///< Length [us] of each window.
+#define TEST_CHANNEL        11U
+#define TEST_STALL_TIME     300000U ///< Time [us] the event loop starts at in the stall scenarios.
+#define TEST_SETUP_TIME     310U    ///< Time [us] between a timeslot and the start of its window.
+
+#define OUTCOME_NONE 0xFFU ///< The window has not been reported.
+
+typedef struct
+{
+    bool                           used;
+    rsch_dly_ts_id_t               id;
+    uint64_t                       trigger_time;
+    rsch_dly_ts_started_callback_t started_callback;
+} test_timeslot_t;
+
+nrf_802154_stats_t g_nrf_802154_stats;
+
+static uint32_t                m_failures;
+static uint64_t                m_now;
+static test_timeslot_t         m_timeslots[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
+static nrf_802154_sl_timer_t * mp_timers[TEST_TIMERS];
+static uint8_t                 m_outcome[TEST_WINDOWS];
+static uint32_t                m_started[TEST_WINDOWS];
+static uint32_t                m_started_cnt;
+static uint32_t                m_ntf_failures;  ///< Notifications still to be refused.
+static uint32_t                m_ntf_accepted;  ///< Notifications accepted since the last refusal.
+static uint32_t                m_rng_state = 0x2545F491UL;
+
+static uint32_t rng_get(void)
+{
+    m_rng_state ^= m_rng_state << 13;
+    m_rng_state ^= m_rng_state >> 17;
+    m_rng_state ^= m_rng_state << 5;
+
+    return m_rng_state;
+}
+
+static uint64_t rx_time_get(uint32_t id)
+{
+    return TEST_FIRST_RX_TIME + (uint64_t)id * TEST_RX_INTERVAL;
+}
+
+/***************************************************************************************************
+ * @section Radio scheduler
+ **************************************************************************************************/
+
+bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    if (p_dly_ts_param->trigger_time < m_now)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_timeslots); i++)
+    {
+        if (!m_timeslots[i].used)
+        {
+            m_timeslots[i].used             = true;
+            m_timeslots[i].id               = p_dly_ts_param->id;
+            m_timeslots[i].trigger_time     = p_dly_ts_param->trigger_time;
+            m_timeslots[i].started_callback = p_dly_ts_param->started_callback;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
+{
+    (void)handler;
+
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_timeslots); i++)
+    {
+        if (m_timeslots[i].used && (m_timeslots[i].id == dly_ts_id))
+        {
+            m_timeslots[i].used = false;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_time_to_start_get(rsch_dly_ts_id_t dly_ts_id,
+                                                        uint64_t       * p_time_to_start)
+{
+    (void)dly_ts_id;
+    (void)p_time_to_start;
+
+    return false;
+}
+
+/***************************************************************************************************
+ * @section Service layer timer
+ **************************************************************************************************/
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    for (uint32_t i = 0; i < TEST_TIMERS; i++)
+    {
+        if (mp_timers[i] == p_timer)
+        {
+            return NRF_802154_SL_TIMER_RET_SUCCESS;
+        }
+    }
+
+    for (uint32_t i = 0; i < TEST_TIMERS; i++)
+    {
+        if (mp_timers[i] == NULL)
+        {
+            mp_timers[i] = p_timer;
+
+            return NRF_802154_SL_TIMER_RET_SUCCESS;
+        }
+    }
+
+    CHECK(false);
+    return NRF_802154_SL_TIMER_RET_NO_RESOURCES;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    for (uint32_t i = 0; i < TEST_TIMERS; i++)
+    {
+        if (mp_timers[i] == p_timer)
+        {
+            mp_timers[i] = NULL;
+
+            return NRF_802154_SL_TIMER_RET_SUCCESS;
+        }
+    }
+
+    return NRF_802154_SL_TIMER_RET_INACTIVE;
+}
+
+/***************************************************************************************************
+ * @section Driver dependencies
+ **************************************************************************************************/
+
+bool nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error, uint32_t id, bool allow_drop)
+{
+    (void)allow_drop;
+
+    if ((error == NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED) && (m_ntf_failures != 0U) &&
+        (++m_ntf_accepted > 3U))
+    {
+        // The notification queue is full
+        m_ntf_failures--;
+        m_ntf_accepted = 0U;
+
+        return false;
+    }
+
+    CHECK(id < TEST_WINDOWS);
+
+    if (id < TEST_WINDOWS)
+    {
+        CHECK(m_outcome[id] == OUTCOME_NONE);
+        m_outcome[id] = (uint8_t)error;
+    }
+
+    return true;
+}
+
+void nrf_802154_notify_transmitted(uint8_t                                   * p_frame,
+                                   const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)p_metadata;
+
+    CHECK(false);
+}
+
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_metadata;
+
+    CHECK(false);
+}
+
+uint8_t nrf_802154_pib_channel_get(void)
+{
+    return TEST_CHANNEL;
+}
+
+void nrf_802154_pib_channel_set(uint8_t channel)
+{
+    CHECK(channel == TEST_CHANNEL);
+}
+
+bool nrf_802154_pib_rx_on_when_idle_get(void)
+{
+    return false;
+}
+
+bool nrf_802154_request_receive(nrf_802154_term_t              term_lvl,
+                                req_originator_t               req_orig,
+                                nrf_802154_notification_func_t notify_function,
+                                bool                           notify_abort,
+                                uint32_t                       id)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_abort;
+
+    CHECK(m_started_cnt < TEST_WINDOWS);
+
+    if (m_started_cnt < TEST_WINDOWS)
+    {
+        m_started[m_started_cnt++] = id;
+    }
+
+    notify_function(true);
+
+    return true;
+}
+
+bool nrf_802154_request_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_request_channel_update(req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    return true;
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+/** @brief Runs the earliest timeslot or timer until there are none left. */
+static void events_run(void)
+{
+    while (true)
+    {
+        uint64_t                earliest  = UINT64_MAX;
+        test_timeslot_t       * p_slot    = NULL;
+        nrf_802154_sl_timer_t * p_timer   = NULL;
+        uint32_t                timer_idx = 0U;
+
+        for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_timeslots); i++)
+        {
+            if (m_timeslots[i].used && (m_timeslots[i].trigger_time < earliest))
+            {
+                earliest = m_timeslots[i].trigger_time;
+                p_slot   = &m_timeslots[i];
+            }
+        }
+
+        for (uint32_t i = 0; i < TEST_TIMERS; i++)
+        {
+            if ((mp_timers[i] != NULL) && (mp_timers[i]->trigger_time < earliest))
+            {
+                earliest  = mp_timers[i]->trigger_time;
+                p_timer   = mp_timers[i];
+                timer_idx = i;
+            }
+        }
+
+        if (earliest == UINT64_MAX)
+        {
+            break;
+        }
+
+        m_now = NRFX_MAX(m_now, earliest);
+
+        if (p_timer != NULL)
+        {
+            mp_timers[timer_idx] = NULL;
+            p_timer->action.callback.callback(p_timer);
+        }
+        else
+        {
+            rsch_dly_ts_id_t id = p_slot->id;
+
+            // The started timeslot is released by the driver
+            p_slot->started_callback(id);
+            CHECK(!p_slot->used || (p_slot->id != id));
+        }
+    }
+}
+
+/**
+ * @brief Requests the windows in random order, cancels some of them and runs the events.
+ *
+ * @param[in]  cancels       Number of windows to cancel.
+ * @param[in]  stall         Time [us] the event loop starts at.
+ * @param[in]  ntf_failures  Number of notifications of denied windows to refuse.
+ */
+static void scenario_run(uint32_t cancels, uint64_t stall, uint32_t ntf_failures)
+{
+    uint32_t order[TEST_WINDOWS];
+    bool     cancelled[TEST_WINDOWS];
+    uint32_t received = 0U;
+    uint32_t denied   = 0U;
+    uint32_t late     = 0U;
+
+    printf("%u cancelled, time stalled to %llu us, %u notifications refused\n",
+           (unsigned)cancels,
+           (unsigned long long)stall,
+           (unsigned)ntf_failures);
+
+    memset(m_outcome, OUTCOME_NONE, sizeof(m_outcome));
+    memset(cancelled, 0, sizeof(cancelled));
+    m_now                                         = 0U;
+    m_started_cnt                                 = 0U;
+    m_ntf_failures                                = ntf_failures;
+    m_ntf_accepted                                = 0U;
+    g_nrf_802154_stats.counters.delayed_rx_missed = 0U;
+
+    nrf_802154_delayed_trx_init();
+
+    for (uint32_t i = 0; i < TEST_WINDOWS; i++)
+    {
+        order[i] = i;
+    }
+
+    for (uint32_t i = TEST_WINDOWS - 1U; i > 0U; i--)
+    {
+        uint32_t j   = rng_get() % (i + 1U);
+        uint32_t tmp = order[i];
+
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    for (uint32_t i = 0; i < TEST_WINDOWS; i++)
+    {
+        CHECK(nrf_802154_delayed_trx_receive(rx_time_get(order[i]),
+                                             TEST_RX_TIMEOUT,
+                                             TEST_CHANNEL,
+                                             order[i]));
+    }
+
+    CHECK(!nrf_802154_delayed_trx_receive(rx_time_get(7U), TEST_RX_TIMEOUT, TEST_CHANNEL, 7U));
+
+    for (uint32_t i = 0; i < cancels; i++)
+    {
+        uint32_t id = rng_get() % TEST_WINDOWS;
+
+        if (!cancelled[id])
+        {
+            CHECK(nrf_802154_delayed_trx_receive_cancel(id));
+            cancelled[id] = true;
+        }
+    }
+
+    m_now = stall;
+    events_run();
+
+    for (uint32_t id = 0; id < TEST_WINDOWS; id++)
+    {
+        bool stale = (rx_time_get(id) - TEST_SETUP_TIME) < stall;
+
+        if (cancelled[id])
+        {
+            CHECK(m_outcome[id] == OUTCOME_NONE);
+        }
+        else if (m_outcome[id] == NRF_802154_RX_ERROR_DELAYED_TIMEOUT)
+        {
+            late += stale ? 1U : 0U;
+            received++;
+        }
+        else if (m_outcome[id] == NRF_802154_RX_ERROR_DELAYED_ABORTED)
+        {
+            // A window started late is aborted by the next late window
+            CHECK(stale);
+            late++;
+            received++;
+        }
+        else
+        {
+            CHECK(m_outcome[id] == NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+            // A refused notification is retried later, when the next windows may be stale too
+            CHECK(stale || (ntf_failures != 0U));
+            denied++;
+        }
+
+        if (!cancelled[id] && !stale && (ntf_failures == 0U))
+        {
+            CHECK(m_outcome[id] == NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+        }
+    }
+
+    for (uint32_t i = 1U; i < m_started_cnt; i++)
+    {
+        CHECK(rx_time_get(m_started[i - 1U]) < rx_time_get(m_started[i]));
+    }
+
+    printf("  received: %u, denied: %u, started late: %u\n",
+           (unsigned)received,
+           (unsigned)denied,
+           (unsigned)late);
+
+    // Only the windows that held the timeslots during the stall are started late
+    CHECK(late <= NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS);
+    CHECK(m_started_cnt == received);
+    CHECK(g_nrf_802154_stats.counters.delayed_rx_missed == denied);
+    CHECK(m_ntf_failures == 0U);
+    CHECK((stall == 0U) || (denied != 0U));
+}
+
+int main(void)
+{
+    scenario_run(0U, 0U, 0U);
+    scenario_run(40U, 0U, 0U);
+    scenario_run(10U, TEST_STALL_TIME, 0U);
+    scenario_run(0U, TEST_STALL_TIME, 5U);
+
+    printf("%s\n", (m_failures == 0U) ? "OK" : "FAIL");
+
+    return (m_failures == 0U) ? 0 : 1;
+}
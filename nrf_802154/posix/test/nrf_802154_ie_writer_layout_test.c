@@ -0,0 +1,830 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the header IE layout found by the IE writer.
+ *
+ * The ACK data module finds the layout of the header IEs of a peer with
+ * @ref nrf_802154_ie_writer_layout_get when the IE data is set, and the Enh-Ack generator arms
+ * the IE writer with @ref nrf_802154_ie_writer_layout_prepare from the stored layout, without
+ * parsing the IEs copied to the ACK. The test builds the IE writer and the ACK data module and
+ * checks:
+ *  - the layout of random header IE lists made of CSL, CST, Thread ACK probing, other vendor,
+ *    unknown and header termination IEs, well-formed and malformed, against a layout found
+ *    by the test while it generates the list,
+ *  - that the writer armed from the layout and the writer armed by
+ *    @ref nrf_802154_ie_writer_prepare write the same frame, with the expected CSL and CST
+ *    phase and period and link metrics in the expected fields only, and that an invalid layout
+ *    leaves the frame unchanged,
+ *  - that finding a layout does not change the state of an armed writer,
+ *  - that the layout stored in the peer record matches its IE data after the IE data is set,
+ *    replaced, appended and cleared in a random sequence of operations.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DNRF52_SERIES \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/include -Idriver/src \
+ *       posix/test/nrf_802154_ie_writer_layout_test.c posix/src/nrfx_host.c \
+ *       driver/src/mac_features/nrf_802154_ie_writer.c \
+ *       driver/src/mac_features/ack_generator/nrf_802154_ack_data.c \
+ *       driver/src/nrf_802154_hmap.c -o ie_writer_layout_test
+ *   ./ie_writer_layout_test
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_tx_work_buffer.h"
+#include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_ie_writer.h"
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+
+#define CHECK(cond)                                                            \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                      \
+        }                                                                      \
+    }                                                                          \
+    while (0)
+
+#define TEST_CASES       200000U ///< Random header IE lists written by the IE writer.
+#define TEST_PEER_OPS    200000U ///< Random operations on the IE data of the peers.
+#define TEST_PEERS       4U      ///< Peers whose IE data is modified.
+#define TEST_LIST_SIZE   40U     ///< Maximum length of a random header IE list.
+#define TEST_BUFFER_SIZE 64U     ///< Larger than a list, as the IE iterator reads past its end.
+
+#define TEST_TIME        123456U ///< Time returned by the service layer timer, in microseconds.
+#define TEST_RSSI        (-60)   ///< RSSI of the last received frame.
+#define TEST_LQI         200U    ///< LQI of the last received frame.
+
+#define TEST_CSL_PERIOD  100U    ///< CSL period, in units of 10 symbols.
+#define TEST_CSL_ANCHOR  1000U   ///< CSL anchor time, in microseconds.
+#define TEST_CST_PERIOD  200U    ///< CST period, in units of 10 symbols.
+#define TEST_CST_ANCHOR  2000U   ///< CST anchor time, in microseconds.
+
+/**
+ * @brief CSL phase written by the IE writer.
+ *
+ * The MHR starts 64 us after the current time, at 123520 us. The next CSL window starts at
+ * 129000 us, 5480 us later, which is 34 units of 160 us after rounding.
+ */
+#define TEST_CSL_PHASE   34U
+
+/**
+ * @brief CST phase written by the IE writer.
+ *
+ * The next CST window after 123520 us starts at 130000 us, 6480 us later, which is 41 units
+ * of 160 us after rounding.
+ */
+#define TEST_CST_PHASE   41U
+
+/** @brief -60 dBm on the -130 dBm to 0 dBm RSSI scale of the Thread ACK probing IE. */
+#define TEST_LM_RSSI     137U
+
+/** @brief 32 dB above the -92 dBm RSSI offset on the 0 dB to 130 dB margin scale. */
+#define TEST_LM_MARGIN   62U
+
+/** @brief Header IE list generated by the test with the layout the IE writer should find. */
+typedef struct
+{
+    uint8_t                       data[TEST_BUFFER_SIZE];
+    uint8_t                       len;
+    nrf_802154_ie_writer_layout_t layout;     ///< Expected layout.
+    bool                          terminated; ///< A header termination IE ends the list.
+} test_ie_list_t;
+
+static uint32_t m_failures;
+static uint32_t m_rng_state = 12345U;
+static uint32_t m_dynamic_data_updates; ///< Calls to mark the dynamic data of a frame updated.
+
+/***************************************************************************************************
+ * @section Replaced dependencies of the IE writer and the ACK data module
+ **************************************************************************************************/
+
+radio_state_t nrf_802154_core_state_get(void)
+{
+    return RADIO_STATE_SLEEP;
+}
+
+int8_t nrf_802154_core_last_frame_rssi_get(void)
+{
+    return TEST_RSSI;
+}
+
+uint8_t nrf_802154_core_last_frame_lqi_get(void)
+{
+    return TEST_LQI;
+}
+
+void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(void)
+{
+    m_dynamic_data_updates++;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return TEST_TIME;
+}
+
+bool nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(uint32_t * p_drx_time_to_midpoint)
+{
+    // Not used, as the CSL anchor time is set
+    (void)p_drx_time_to_midpoint;
+
+    return false;
+}
+
+/***************************************************************************************************
+ * @section Header IE lists
+ **************************************************************************************************/
+
+static uint32_t rng_get(void)
+{
+    m_rng_state = m_rng_state * 1103515245U + 12345U;
+    return m_rng_state >> 8;
+}
+
+static void rng_fill(uint8_t * p_buf, size_t len)
+{
+    for (size_t i = 0U; i < len; i++)
+    {
+        p_buf[i] = (uint8_t)rng_get();
+    }
+}
+
+static void ie_list_init(test_ie_list_t * p_list)
+{
+    memset(p_list, 0, sizeof(*p_list));
+    p_list->layout.valid = true;
+}
+
+/** @brief Returns true if the fields of the next IE appended to the list are found. */
+static bool ie_list_is_parsed(const test_ie_list_t * p_list)
+{
+    return p_list->layout.valid && !p_list->terminated;
+}
+
+/**
+ * @brief Appends the header of an IE with @p len octets of random content to the list.
+ *
+ * @returns  Offset of the IE content, or 0 if the IE does not fit in @p max_len octets.
+ */
+static uint8_t ie_put(test_ie_list_t * p_list, uint8_t id, uint8_t len, uint8_t max_len)
+{
+    uint8_t offset = p_list->len;
+
+    if (offset + IE_DATA_OFFSET + len > max_len)
+    {
+        return 0U;
+    }
+
+    p_list->data[offset + IE_ID_OFFSET_0] = (uint8_t)(len | (id << IE_HEADER_ELEMENT_ID_OFFSET));
+    p_list->data[offset + IE_ID_OFFSET_1] = (uint8_t)(id >> 1);
+    rng_fill(&p_list->data[offset + IE_DATA_OFFSET], len);
+
+    p_list->len += IE_DATA_OFFSET + len;
+
+    return offset + IE_DATA_OFFSET;
+}
+
+/** @brief Appends a vendor-specific IE with the Thread OUI and @p subtype to the list. */
+static uint8_t ie_thread_put(test_ie_list_t * p_list,
+                             uint8_t          subtype,
+                             uint8_t          len,
+                             uint8_t          max_len)
+{
+    uint8_t offset = ie_put(p_list, IE_VENDOR_ID, len, max_len);
+
+    if (offset != 0U)
+    {
+        p_list->data[offset + IE_VENDOR_OUI_OFFSET]     = (uint8_t)IE_VENDOR_THREAD_OUI;
+        p_list->data[offset + IE_VENDOR_OUI_OFFSET + 1] = (uint8_t)(IE_VENDOR_THREAD_OUI >> 8);
+        p_list->data[offset + IE_VENDOR_OUI_OFFSET + 2] = (uint8_t)(IE_VENDOR_THREAD_OUI >> 16);
+
+        if (len > IE_VENDOR_THREAD_SUBTYPE_OFFSET)
+        {
+            p_list->data[offset + IE_VENDOR_THREAD_SUBTYPE_OFFSET] = subtype;
+        }
+    }
+
+    return offset;
+}
+
+static void csl_ie_append(test_ie_list_t * p_list, uint8_t len, uint8_t max_len)
+{
+    uint8_t offset = ie_put(p_list, IE_CSL_ID, len, max_len);
+
+    if ((offset == 0U) || !ie_list_is_parsed(p_list))
+    {
+        return;
+    }
+
+    if (len < IE_CSL_SIZE_MIN)
+    {
+        p_list->layout.valid = false;
+    }
+    else
+    {
+        p_list->layout.csl_phase = offset;
+    }
+}
+
+static void cst_ie_append(test_ie_list_t * p_list, uint8_t len, uint8_t max_len)
+{
+    uint8_t offset = ie_thread_put(p_list, IE_VENDOR_THREAD_CST_ID, len, max_len);
+
+    if ((offset == 0U) || !ie_list_is_parsed(p_list))
+    {
+        return;
+    }
+
+    if (len != IE_VENDOR_THREAD_CST_SIZE)
+    {
+        p_list->layout.valid = false;
+    }
+    else
+    {
+        p_list->layout.cst_phase = offset + IE_VENDOR_THREAD_DATA_OFFSET;
+    }
+}
+
+/** @brief Appends a Thread ACK probing IE with the given tokens to the list. */
+static void probing_ie_append(test_ie_list_t * p_list,
+                              const uint8_t  * p_tokens,
+                              uint8_t          tokens,
+                              uint8_t          max_len)
+{
+    uint8_t len    = IE_VENDOR_THREAD_DATA_OFFSET + tokens;
+    uint8_t offset = ie_thread_put(p_list, IE_VENDOR_THREAD_ACK_PROBING_ID, len, max_len);
+
+    if (offset == 0U)
+    {
+        return;
+    }
+
+    offset += IE_VENDOR_THREAD_DATA_OFFSET;
+    memcpy(&p_list->data[offset], p_tokens, tokens);
+
+    if (!ie_list_is_parsed(p_list))
+    {
+        return;
+    }
+
+    if ((len < IE_VENDOR_THREAD_ACK_SIZE_MIN) || (len > IE_VENDOR_THREAD_ACK_SIZE_MAX))
+    {
+        p_list->layout.valid = false;
+        return;
+    }
+
+    for (uint8_t i = 0U; i < tokens; i++)
+    {
+        uint8_t * p_field;
+
+        switch (p_tokens[i])
+        {
+            case IE_VENDOR_THREAD_RSSI_TOKEN:
+                p_field = &p_list->layout.lm_rssi;
+                break;
+
+            case IE_VENDOR_THREAD_MARGIN_TOKEN:
+                p_field = &p_list->layout.lm_margin;
+                break;
+
+            case IE_VENDOR_THREAD_LQI_TOKEN:
+                p_field = &p_list->layout.lm_lqi;
+                break;
+
+            default:
+                p_field = NULL;
+                break;
+        }
+
+        if ((p_field == NULL) || (*p_field != NRF_802154_IE_WRITER_FIELD_NONE))
+        {
+            p_list->layout.valid = false;
+            return;
+        }
+
+        *p_field = offset + i;
+    }
+}
+
+/**
+ * @brief Appends a random IE that fits in @p max_len octets to the list.
+ *
+ * Most IEs are well-formed. Malformed CSL, CST and ACK probing IEs, vendor-specific IEs
+ * that are not Thread IEs or are too short for one, unknown IEs and header termination IEs
+ * are less frequent.
+ */
+static void ie_list_append(test_ie_list_t * p_list, uint8_t max_len)
+{
+    uint8_t tokens[4];
+    uint8_t count;
+    uint8_t offset;
+
+    switch (rng_get() % 16U)
+    {
+        case 0:
+        case 1:
+        case 2:
+            csl_ie_append(p_list, IE_CSL_SIZE_MIN + 2U * (rng_get() % 2U), max_len);
+            break;
+
+        case 3:
+            csl_ie_append(p_list, rng_get() % IE_CSL_SIZE_MIN, max_len);
+            break;
+
+        case 4:
+        case 5:
+        case 6:
+            count = 1U + rng_get() % 2U;
+
+            for (uint8_t i = 0U; i < count; i++)
+            {
+                tokens[i] = IE_VENDOR_THREAD_RSSI_TOKEN + rng_get() % 3U;
+            }
+
+            probing_ie_append(p_list, tokens, count, max_len);
+            break;
+
+        case 7:
+            count = rng_get() % 4U;
+
+            for (uint8_t i = 0U; i < count; i++)
+            {
+                tokens[i] = rng_get() % 5U;
+            }
+
+            probing_ie_append(p_list, tokens, count, max_len);
+            break;
+
+        case 8:
+        case 9:
+            cst_ie_append(p_list, IE_VENDOR_THREAD_CST_SIZE, max_len);
+            break;
+
+        case 10:
+            cst_ie_append(p_list, IE_VENDOR_THREAD_SIZE_MIN + rng_get() % 4U, max_len);
+            break;
+
+        case 11:
+            // Vendor-specific IE of another vendor
+            offset = ie_put(p_list, IE_VENDOR_ID, IE_VENDOR_SIZE_MIN + rng_get() % 4U, max_len);
+
+            if (offset != 0U)
+            {
+                p_list->data[offset + IE_VENDOR_OUI_OFFSET] = (uint8_t)(IE_VENDOR_THREAD_OUI + 1);
+            }
+            break;
+
+        case 12:
+            // Thread IE of another subtype
+            (void)ie_thread_put(p_list,
+                                IE_VENDOR_THREAD_CST_ID + 1U + rng_get() % 8U,
+                                IE_VENDOR_THREAD_SIZE_MIN + rng_get() % 3U,
+                                max_len);
+            break;
+
+        case 13:
+            // Vendor-specific IE too short for a Thread IE
+            (void)ie_thread_put(p_list, 0U, rng_get() % IE_VENDOR_THREAD_SIZE_MIN, max_len);
+            break;
+
+        case 14:
+            // IE not known to the IE writer
+            (void)ie_put(p_list,
+                         IE_CSL_ID + 1U + rng_get() % (IE_HT1 - IE_CSL_ID - 1U),
+                         rng_get() % 5U,
+                         max_len);
+            break;
+
+        default:
+            if (ie_put(p_list, IE_HT1 + rng_get() % 2U, 0U, max_len) != 0U)
+            {
+                p_list->terminated = true;
+            }
+            break;
+    }
+}
+
+static bool layout_equal(const nrf_802154_ie_writer_layout_t * p_a,
+                         const nrf_802154_ie_writer_layout_t * p_b)
+{
+    if (p_a->valid != p_b->valid)
+    {
+        return false;
+    }
+
+    if (!p_a->valid)
+    {
+        // The fields found before a malformed IE was detected are not used
+        return true;
+    }
+
+    return (p_a->csl_phase == p_b->csl_phase) &&
+           (p_a->cst_phase == p_b->cst_phase) &&
+           (p_a->lm_rssi == p_b->lm_rssi) &&
+           (p_a->lm_margin == p_b->lm_margin) &&
+           (p_a->lm_lqi == p_b->lm_lqi);
+}
+
+/***************************************************************************************************
+ * @section IE writer
+ **************************************************************************************************/
+
+static void field_16_put(uint8_t * p_data, uint8_t offset, uint16_t value)
+{
+    if (offset != NRF_802154_IE_WRITER_FIELD_NONE)
+    {
+        p_data[offset]     = (uint8_t)value;
+        p_data[offset + 1] = (uint8_t)(value >> 8);
+    }
+}
+
+static void field_8_put(uint8_t * p_data, uint8_t offset, uint8_t value)
+{
+    if (offset != NRF_802154_IE_WRITER_FIELD_NONE)
+    {
+        p_data[offset] = value;
+    }
+}
+
+/**
+ * @brief Builds the list as written by the IE writer.
+ *
+ * @returns  True if the IE writer writes any field of the list.
+ */
+static bool ie_list_written_get(const test_ie_list_t * p_list, uint8_t * p_written)
+{
+    const nrf_802154_ie_writer_layout_t * p_layout = &p_list->layout;
+
+    memcpy(p_written, p_list->data, TEST_BUFFER_SIZE);
+
+    if (!p_layout->valid)
+    {
+        return false;
+    }
+
+    field_16_put(p_written, p_layout->csl_phase, TEST_CSL_PHASE);
+    field_16_put(p_written,
+                 (p_layout->csl_phase != NRF_802154_IE_WRITER_FIELD_NONE) ?
+                 p_layout->csl_phase + sizeof(uint16_t) : NRF_802154_IE_WRITER_FIELD_NONE,
+                 TEST_CSL_PERIOD);
+    field_16_put(p_written, p_layout->cst_phase, TEST_CST_PHASE);
+    field_16_put(p_written,
+                 (p_layout->cst_phase != NRF_802154_IE_WRITER_FIELD_NONE) ?
+                 p_layout->cst_phase + sizeof(uint16_t) : NRF_802154_IE_WRITER_FIELD_NONE,
+                 TEST_CST_PERIOD);
+    field_8_put(p_written, p_layout->lm_rssi, TEST_LM_RSSI);
+    field_8_put(p_written, p_layout->lm_margin, TEST_LM_MARGIN);
+    field_8_put(p_written, p_layout->lm_lqi, TEST_LQI);
+
+    return (p_layout->csl_phase != NRF_802154_IE_WRITER_FIELD_NONE) ||
+           (p_layout->cst_phase != NRF_802154_IE_WRITER_FIELD_NONE) ||
+           (p_layout->lm_rssi != NRF_802154_IE_WRITER_FIELD_NONE) ||
+           (p_layout->lm_margin != NRF_802154_IE_WRITER_FIELD_NONE) ||
+           (p_layout->lm_lqi != NRF_802154_IE_WRITER_FIELD_NONE);
+}
+
+/**
+ * @brief Writes the list through the IE writer armed by the parse and by the stored layout.
+ *
+ * @param[in]  p_list   List to be written.
+ * @param[in]  p_other  List whose layout is found while the IE writer is armed.
+ *
+ * @retval true   The IE writer wrote the expected frame on both paths.
+ * @retval false  Otherwise.
+ */
+static bool writer_check(const test_ie_list_t * p_list, const test_ie_list_t * p_other)
+{
+    uint8_t                       by_parse[TEST_BUFFER_SIZE];
+    uint8_t                       by_layout[TEST_BUFFER_SIZE];
+    uint8_t                       expected[TEST_BUFFER_SIZE];
+    nrf_802154_ie_writer_layout_t layout;
+    nrf_802154_ie_writer_layout_t other_layout;
+    uint32_t                      parse_updates;
+    uint32_t                      layout_updates;
+    bool                          written;
+
+    written = ie_list_written_get(p_list, expected);
+    memcpy(by_parse, p_list->data, TEST_BUFFER_SIZE);
+    memcpy(by_layout, p_list->data, TEST_BUFFER_SIZE);
+
+    nrf_802154_ie_writer_layout_get(p_list->data, &p_list->data[p_list->len], &layout);
+
+    // Arm the writer by parsing the IEs and find the layout of another list before committing
+    m_dynamic_data_updates = 0U;
+    nrf_802154_ie_writer_reset();
+    nrf_802154_ie_writer_prepare(by_parse, &by_parse[p_list->len]);
+    nrf_802154_ie_writer_layout_get(p_other->data, &p_other->data[p_other->len], &other_layout);
+    nrf_802154_ie_writer_tx_ack_started_hook(by_parse);
+    parse_updates = m_dynamic_data_updates;
+
+    // Arm the writer with the layout found before
+    m_dynamic_data_updates = 0U;
+    nrf_802154_ie_writer_reset();
+    nrf_802154_ie_writer_layout_prepare(by_layout, &layout);
+    nrf_802154_ie_writer_tx_ack_started_hook(by_layout);
+    layout_updates = m_dynamic_data_updates;
+
+    bool result = layout_equal(&layout, &p_list->layout) &&
+                  layout_equal(&other_layout, &p_other->layout) &&
+                  (memcmp(by_parse, expected, TEST_BUFFER_SIZE) == 0) &&
+                  (memcmp(by_layout, expected, TEST_BUFFER_SIZE) == 0) &&
+                  (parse_updates == (written ? 1U : 0U)) &&
+                  (layout_updates == (written ? 1U : 0U));
+
+    return result;
+}
+
+static void writer_test(void)
+{
+    test_ie_list_t other;
+    test_ie_list_t list;
+    uint32_t       invalid    = 0U;
+    uint32_t       terminated = 0U;
+    uint32_t       mismatches = 0U;
+
+    ie_list_init(&other);
+    probing_ie_append(&other, (const uint8_t[]){IE_VENDOR_THREAD_LQI_TOKEN}, 1U, TEST_LIST_SIZE);
+    csl_ie_append(&other, IE_CSL_SIZE_MIN, TEST_LIST_SIZE);
+    CHECK(other.layout.valid);
+
+    for (uint32_t i = 0U; i < TEST_CASES; i++)
+    {
+        uint32_t seed  = m_rng_state;
+        uint8_t  count = 1U + rng_get() % 6U;
+
+        ie_list_init(&list);
+
+        for (uint8_t j = 0U; j < count; j++)
+        {
+            ie_list_append(&list, TEST_LIST_SIZE);
+        }
+
+        if (list.len == 0U)
+        {
+            continue;
+        }
+
+        invalid    += list.layout.valid ? 0U : 1U;
+        terminated += list.terminated ? 1U : 0U;
+
+        if (!writer_check(&list, &other))
+        {
+            if (mismatches < 5U)
+            {
+                printf("  mismatch, case seed %u\n", (unsigned)seed);
+            }
+
+            mismatches++;
+        }
+    }
+
+    printf("  %u cases, %u invalid, %u terminated, %u mismatches\n",
+           (unsigned)TEST_CASES,
+           (unsigned)invalid,
+           (unsigned)terminated,
+           (unsigned)mismatches);
+
+    CHECK(invalid > 0U);
+    CHECK(terminated > 0U);
+    CHECK(mismatches == 0U);
+}
+
+/***************************************************************************************************
+ * @section ACK data
+ **************************************************************************************************/
+
+/** @brief Checks the layout stored in the peer record against the IE data of the peer. */
+static bool peer_layout_check(const uint8_t * p_addr)
+{
+    nrf_802154_peer_rec_t         peer_rec;
+    nrf_802154_ie_writer_layout_t layout;
+
+    if (!nrf_802154_peer_rec_get(p_addr, false, &peer_rec) || (peer_rec.ie_data.len == 0U))
+    {
+        // The Enh-Ack generator uses neither the IE data nor the layout
+        return true;
+    }
+
+    nrf_802154_ie_writer_layout_get(peer_rec.ie_data.data,
+                                    &peer_rec.ie_data.data[peer_rec.ie_data.len],
+                                    &layout);
+
+    return layout_equal(&layout, &peer_rec.ie_data.layout);
+}
+
+static bool peer_ie_set(const uint8_t * p_addr, const test_ie_list_t * p_ie)
+{
+    return nrf_802154_ack_data_for_addr_set(p_addr,
+                                            false,
+                                            NRF_802154_ACK_DATA_IE,
+                                            p_ie->data,
+                                            p_ie->len);
+}
+
+static void peer_layout_get(const uint8_t * p_addr, nrf_802154_ie_writer_layout_t * p_layout)
+{
+    nrf_802154_peer_rec_t peer_rec;
+
+    CHECK(nrf_802154_peer_rec_get(p_addr, false, &peer_rec));
+    *p_layout = peer_rec.ie_data.layout;
+}
+
+/**
+ * @brief Replaces and reorders the IEs of a peer and checks the stored offsets.
+ */
+static void ack_data_ie_test(void)
+{
+    static const uint8_t addr[SHORT_ADDRESS_SIZE] = {0x34, 0x12};
+
+    nrf_802154_ie_writer_layout_t layout;
+    test_ie_list_t                csl;
+    test_ie_list_t                probing;
+    uint8_t                       ack[TEST_BUFFER_SIZE];
+    nrf_802154_peer_rec_t         peer_rec;
+
+    ie_list_init(&csl);
+    csl_ie_append(&csl, IE_CSL_SIZE_MIN, TEST_LIST_SIZE);
+
+    // CSL IE followed by a probing IE
+    ie_list_init(&probing);
+    probing_ie_append(&probing,
+                      (const uint8_t[]){IE_VENDOR_THREAD_RSSI_TOKEN, IE_VENDOR_THREAD_MARGIN_TOKEN},
+                      2U,
+                      TEST_LIST_SIZE);
+    CHECK(peer_ie_set(addr, &csl));
+    CHECK(peer_ie_set(addr, &probing));
+    peer_layout_get(addr, &layout);
+    CHECK(layout.valid);
+    CHECK(layout.csl_phase == csl.layout.csl_phase);
+    CHECK(layout.lm_rssi == csl.len + probing.layout.lm_rssi);
+    CHECK(layout.lm_margin == csl.len + probing.layout.lm_margin);
+    CHECK(layout.lm_lqi == NRF_802154_IE_WRITER_FIELD_NONE);
+
+    // Probing IE of the same size with other tokens replaces the previous one
+    ie_list_init(&probing);
+    probing_ie_append(&probing,
+                      (const uint8_t[]){IE_VENDOR_THREAD_LQI_TOKEN, IE_VENDOR_THREAD_RSSI_TOKEN},
+                      2U,
+                      TEST_LIST_SIZE);
+    CHECK(peer_ie_set(addr, &probing));
+    peer_layout_get(addr, &layout);
+    CHECK(layout.valid);
+    CHECK(layout.csl_phase == csl.layout.csl_phase);
+    CHECK(layout.lm_rssi == csl.len + probing.layout.lm_rssi);
+    CHECK(layout.lm_margin == NRF_802154_IE_WRITER_FIELD_NONE);
+    CHECK(layout.lm_lqi == csl.len + probing.layout.lm_lqi);
+
+    // Probing IE followed by a CSL IE
+    CHECK(nrf_802154_ack_data_for_addr_clear(addr, false, NRF_802154_ACK_DATA_IE));
+    CHECK(peer_ie_set(addr, &probing));
+    CHECK(peer_ie_set(addr, &csl));
+    peer_layout_get(addr, &layout);
+    CHECK(layout.valid);
+    CHECK(layout.csl_phase == probing.len + csl.layout.csl_phase);
+    CHECK(layout.lm_rssi == probing.layout.lm_rssi);
+    CHECK(layout.lm_lqi == probing.layout.lm_lqi);
+
+    // Probing IE with a repeated token leaves the IE writer unarmed
+    ie_list_init(&probing);
+    probing_ie_append(&probing,
+                      (const uint8_t[]){IE_VENDOR_THREAD_LQI_TOKEN, IE_VENDOR_THREAD_LQI_TOKEN},
+                      2U,
+                      TEST_LIST_SIZE);
+    CHECK(!probing.layout.valid);
+    CHECK(peer_ie_set(addr, &probing));
+    CHECK(nrf_802154_peer_rec_get(addr, false, &peer_rec));
+    CHECK(!peer_rec.ie_data.layout.valid);
+
+    memcpy(ack, peer_rec.ie_data.data, peer_rec.ie_data.len);
+    m_dynamic_data_updates = 0U;
+    nrf_802154_ie_writer_reset();
+    nrf_802154_ie_writer_layout_prepare(ack, &peer_rec.ie_data.layout);
+    nrf_802154_ie_writer_tx_ack_started_hook(ack);
+    CHECK(memcmp(ack, peer_rec.ie_data.data, peer_rec.ie_data.len) == 0);
+    CHECK(m_dynamic_data_updates == 0U);
+
+    CHECK(nrf_802154_ack_data_for_addr_clear(addr, false, NRF_802154_ACK_DATA_IE));
+}
+
+/**
+ * @brief Sets and clears random IEs of the peers and checks the stored layouts.
+ */
+static void ack_data_random_test(void)
+{
+    uint8_t        addr[TEST_PEERS][SHORT_ADDRESS_SIZE];
+    test_ie_list_t ie;
+    uint32_t       sets       = 0U;
+    uint32_t       mismatches = 0U;
+
+    for (uint8_t i = 0U; i < TEST_PEERS; i++)
+    {
+        addr[i][0] = i;
+        addr[i][1] = 0x56U;
+    }
+
+    for (uint32_t i = 0U; i < TEST_PEER_OPS; i++)
+    {
+        uint32_t        seed   = m_rng_state;
+        const uint8_t * p_addr = addr[rng_get() % TEST_PEERS];
+
+        if (rng_get() % 8U == 0U)
+        {
+            (void)nrf_802154_ack_data_for_addr_clear(p_addr, false, NRF_802154_ACK_DATA_IE);
+        }
+        else
+        {
+            ie_list_init(&ie);
+            ie_list_append(&ie, NRF_802154_MAX_ACK_IE_SIZE);
+
+            if ((ie.len != 0U) && peer_ie_set(p_addr, &ie))
+            {
+                sets++;
+            }
+        }
+
+        if (!peer_layout_check(p_addr))
+        {
+            if (mismatches < 5U)
+            {
+                printf("  mismatch, operation seed %u\n", (unsigned)seed);
+            }
+
+            mismatches++;
+        }
+    }
+
+    printf("  %u operations, %u IEs set, %u mismatches\n",
+           (unsigned)TEST_PEER_OPS,
+           (unsigned)sets,
+           (unsigned)mismatches);
+
+    CHECK(sets > 0U);
+    CHECK(mismatches == 0U);
+}
+
+int main(void)
+{
+    nrf_802154_ie_writer_csl_period_set(TEST_CSL_PERIOD);
+    nrf_802154_ie_writer_csl_anchor_time_set(TEST_CSL_ANCHOR);
+    nrf_802154_ie_writer_cst_period_set(TEST_CST_PERIOD);
+    nrf_802154_ie_writer_cst_anchor_time_set(TEST_CST_ANCHOR);
+    nrf_802154_ack_data_init();
+
+    printf("IE writer armed by the parse and by the layout\n");
+    writer_test();
+
+    printf("IEs of a peer replaced and reordered\n");
+    ack_data_ie_test();
+
+    printf("random IEs of the peers\n");
+    ack_data_random_test();
+
+    printf("%s\n", (m_failures == 0U) ? "OK" : "FAIL");
+
+    return (m_failures == 0U) ? 0 : 1;
+}
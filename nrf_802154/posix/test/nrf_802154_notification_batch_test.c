@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the batched delivery of notifications through the SWI.
+ *
+ * The notification module is built with a batch size of three, together with the driver API
+ * module, which provides the default implementation of nrf_802154_notifications_batch().
+ * The EGU is emulated by posix/include/hal/nrf_egu.h. The test plays the role of the RADIO
+ * interrupt, which enqueues notifications while the SWI interrupt is pending, and then runs
+ * the SWI interrupt handler. The received frames are stored in the receive buffers of the driver.
+ *
+ * The test checks that:
+ *  - the notifications are delivered in the order they were enqueued, in batches of at most
+ *    three, and that a notification which cannot be batched ends the batch,
+ *  - the default batch callout passes each received frame to
+ *    nrf_802154_received_timestamp_raw() with the timestamp taken when the frame was enqueued,
+ *    not with the timestamp of the last received frame,
+ *  - a batch that is being collected when notifications get blocked is not delivered, and its
+ *    receive buffers and ACK buffers are released, as are the ones flushed from the queue,
+ *  - every receive buffer is released exactly once.
+ *
+ * The calls to nrf_802154_notifications_batch() are intercepted with the --wrap option of
+ * the GNU linker to record the batches, and the calls to nrf_802154_queue_pop_commit() to block
+ * the notifications from a preempting context.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -ffunction-sections -Wl,--gc-sections \
+ *       -Wl,--wrap=nrf_802154_notifications_batch -Wl,--wrap=nrf_802154_queue_pop_commit \
+ *       -DNRF_802154_EGU_INSTANCE=NRF_EGU0 -DNRF_802154_NOTIFICATION_QUEUE_FLUSH_ENABLED=1 \
+ *       -DNRF_802154_NOTIFICATION_BATCH_ENABLED=1 -DNRF_802154_NOTIFICATION_BATCH_SIZE=3 \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/include -Idriver/src \
+ *       posix/test/nrf_802154_notification_batch_test.c posix/src/nrfx_host.c \
+ *       driver/src/nrf_802154.c driver/src/nrf_802154_co.c \
+ *       driver/src/nrf_802154_notification_swi.c driver/src/nrf_802154_queue.c \
+ *       driver/src/nrf_802154_rx_buffer.c -o notification_batch_test
+ *   ./notification_batch_test
+ *
+ * The section garbage collection drops the functions of the driver API module that are not
+ * used by the test, together with their references to the rest of the driver.
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_queue.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_swi_callouts.h"
+#include "hal/nrf_egu.h"
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+#define TEST_TX_FRAMES    8U
+#define TEST_LOG_SIZE     512U
+#define TEST_RX_TIMESTAMP 1000U ///< Timestamp of the frame with identifier zero.
+
+nrf_802154_stats_t g_nrf_802154_stats;
+
+void __real_nrf_802154_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count);
+void __real_nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue);
+
+static uint32_t m_failures;
+static bool     m_radio_irq;          ///< The RADIO interrupt is being handled.
+static uint32_t m_commits_to_block;   ///< Pops after which the notifications are blocked.
+static char     m_log[TEST_LOG_SIZE]; ///< Delivered notifications.
+static size_t   m_log_len;
+static uint8_t  m_tx_frames[TEST_TX_FRAMES][MAX_PACKET_SIZE + PHR_SIZE];
+
+/***************************************************************************************************
+ * @section Driver dependencies
+ **************************************************************************************************/
+
+/** @brief The SWI interrupt has a lower priority than the RADIO interrupt. */
+void nrfx_host_egu_irq(NRF_EGU_Type * p_reg)
+{
+    (void)p_reg;
+
+    if (!m_radio_irq)
+    {
+        nrf_802154_notification_swi_irq_handler();
+    }
+}
+
+bool nrf_802154_core_rx_buffer_is_awaited(void)
+{
+    return false;
+}
+
+bool nrf_802154_request_buffer_free(uint8_t * p_data)
+{
+    (void)p_data;
+
+    CHECK(false);
+    return true;
+}
+
+void __wrap_nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue)
+{
+    __real_nrf_802154_queue_pop_commit(p_queue);
+
+    // A context of a higher priority blocks the notifications, as nrf_802154_reinit() does.
+    if ((m_commits_to_block != 0U) && (--m_commits_to_block == 0U))
+    {
+        nrf_802154_notification_block_all_notifications();
+    }
+}
+
+/***************************************************************************************************
+ * @section Higher layer
+ **************************************************************************************************/
+
+static void log_add(const char * p_fmt, uint32_t id, uint64_t time)
+{
+    int len = snprintf(&m_log[m_log_len],
+                       sizeof(m_log) - m_log_len,
+                       p_fmt,
+                       (unsigned)id,
+                       (unsigned long long)time);
+
+    CHECK((len > 0) && ((size_t)len < sizeof(m_log) - m_log_len));
+    m_log_len += (size_t)len;
+}
+
+void __wrap_nrf_802154_notifications_batch(const nrf_802154_batch_ntf_t * p_ntfs, uint8_t count)
+{
+    CHECK((count > 0U) && (count <= NRF_802154_NOTIFICATION_BATCH_SIZE));
+
+    log_add("[", 0U, 0U);
+    __real_nrf_802154_notifications_batch(p_ntfs, count);
+    log_add("]", 0U, 0U);
+}
+
+void nrf_802154_received_timestamp_raw(uint8_t * p_data, int8_t power, uint8_t lqi, uint64_t time)
+{
+    (void)power;
+    (void)lqi;
+
+    log_add(" R%u@%llu", p_data[PHR_SIZE], time);
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    log_add(" T%u", p_frame[PHR_SIZE], 0U);
+
+    if (p_metadata->data.transmitted.p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_metadata->data.transmitted.p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(uint8_t                                   * p_frame,
+                                nrf_802154_tx_error_t                       error,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)error;
+    (void)p_metadata;
+
+    log_add(" F%u", p_frame[PHR_SIZE], 0U);
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    log_add(" C%u", channel_free, 0U);
+}
+
+/***************************************************************************************************
+ * @section RADIO interrupt
+ **************************************************************************************************/
+
+static uint8_t * rx_buffer_get(uint8_t id)
+{
+    rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+    CHECK(p_buffer != NULL);
+    nrf_802154_rx_buffer_take(p_buffer);
+
+    p_buffer->data[PHR_OFFSET] = 10U;
+    p_buffer->data[PHR_SIZE]   = id;
+
+    return p_buffer->data;
+}
+
+static void rx(uint8_t id)
+{
+    uint8_t * p_data = rx_buffer_get(id);
+
+    nrf_802154_stat_timestamp_write_last_rx_end_timestamp(TEST_RX_TIMESTAMP + id);
+    nrf_802154_notify_received(p_data, -50, 200U);
+}
+
+static void tx(uint8_t id, bool with_ack)
+{
+    nrf_802154_transmit_done_metadata_t metadata;
+    uint8_t                           * p_frame = m_tx_frames[id % TEST_TX_FRAMES];
+
+    memset(&metadata, 0, sizeof(metadata));
+    p_frame[PHR_OFFSET] = 10U;
+    p_frame[PHR_SIZE]   = id;
+
+    if (with_ack)
+    {
+        metadata.data.transmitted.p_ack  = rx_buffer_get(id);
+        metadata.data.transmitted.length = 5U;
+    }
+
+    nrf_802154_notify_transmitted(p_frame, &metadata);
+}
+
+static void tx_failed(uint8_t id)
+{
+    nrf_802154_transmit_done_metadata_t metadata;
+    uint8_t                           * p_frame = m_tx_frames[id % TEST_TX_FRAMES];
+
+    memset(&metadata, 0, sizeof(metadata));
+    p_frame[PHR_OFFSET] = 10U;
+    p_frame[PHR_SIZE]   = id;
+
+    nrf_802154_notify_transmit_failed(p_frame, NRF_802154_TX_ERROR_NO_ACK, &metadata);
+}
+
+static void radio_irq_begin(void)
+{
+    m_radio_irq = true;
+}
+
+/** @brief Return from the RADIO interrupt and handle the pending SWI interrupt. */
+static void radio_irq_end(void)
+{
+    m_radio_irq = false;
+    nrf_802154_notification_swi_irq_handler();
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static bool log_check(const char * p_expected)
+{
+    bool ok = (strcmp(m_log, p_expected) == 0);
+
+    if (!ok)
+    {
+        printf("  expected:%s\n  got:     %s\n", p_expected, m_log);
+    }
+
+    m_log[0]  = '\0';
+    m_log_len = 0U;
+
+    return ok;
+}
+
+static void order_scenario(void)
+{
+    printf("order of the batches and timestamps\n");
+
+    radio_irq_begin();
+    rx(1U);
+    tx(2U, true);
+    rx(3U);
+    nrf_802154_notify_cca(true);
+    rx(4U);
+    rx(5U);
+    tx_failed(6U);
+    rx(7U);
+    // The next frame overwrites the timestamp of the last received frame before the delivery.
+    nrf_802154_stat_timestamp_write_last_rx_end_timestamp(TEST_RX_TIMESTAMP + 99U);
+    radio_irq_end();
+
+    CHECK(log_check("[ R1@1001 T2 R3@1003] C1[ R4@1004 R5@1005 F6][ R7@1007]"));
+    CHECK(nrf_802154_rx_buffer_occupancy_get() == 0U);
+
+    // A notification enqueued when the SWI interrupt is not pending is delivered at once.
+    rx(8U);
+    CHECK(log_check("[ R8@1008]"));
+    CHECK(nrf_802154_rx_buffer_occupancy_get() == 0U);
+}
+
+static void blocked_scenario(void)
+{
+    printf("notifications blocked during a batch\n");
+
+    radio_irq_begin();
+    rx(1U);
+    tx(2U, true);
+    rx(3U);
+    tx(4U, true);
+    rx(5U);
+    // The notifications are blocked after the first two are collected in the batch.
+    m_commits_to_block = 2U;
+    radio_irq_end();
+
+    CHECK(log_check(""));
+    CHECK(m_commits_to_block == 0U);
+
+    nrf_802154_notification_queue_flush();
+    CHECK(nrf_802154_rx_buffer_occupancy_get() == 0U);
+
+    nrf_802154_notification_unblock_notifications();
+    rx(6U);
+    CHECK(log_check("[ R6@1006]"));
+    CHECK(nrf_802154_rx_buffer_occupancy_get() == 0U);
+}
+
+int main(void)
+{
+    nrf_802154_rx_buffer_init();
+    nrf_802154_notification_init();
+
+    order_scenario();
+    blocked_scenario();
+
+    printf("%s\n", (m_failures == 0U) ? "OK" : "FAIL");
+
+    return (m_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the request slot pool of the SWI request module.
+ *
+ * The EGU is emulated by posix/include/hal/nrf_egu.h and the exclusive load and store
+ * instructions by posix/include/nrfx.h. The SWI interrupt handler runs as soon as the request
+ * issuer triggers it, as the SWI interrupt has a higher priority than the issuers. The test
+ * issues the requests to get the last RSSI measurement, whose core function receives the
+ * pointer of the issuer. Each request stores a token in the variable of its issuer and the core
+ * function stub replaces it with the complement of the token, so that the result shows which
+ * request the SWI handler processed.
+ *
+ * The test checks that:
+ *  - requests issued one after another reuse the slots,
+ *  - requests nested up to the size of the pool, each issued by a context that preempted
+ *    the previous issuer after it published its slot, are all processed exactly once,
+ *  - requests issued by a periodic SIGALRM handler, which plays the role of an interrupt of
+ *    a priority between the main loop and the SWI interrupt, while the main loop issues its own
+ *    requests are all processed exactly once, and that the handler overtaking a request being
+ *    filled by the main loop is counted in the request_inversions counter.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DNRF_802154_EGU_INSTANCE=NRF_EGU0 -DNRF_802154_CSMA_CA_CANCEL_ENABLED=0 \
+ *       -DNRF_802154_CARRIER_FUNCTIONS_ENABLED=0 -DNRF_802154_DELAYED_TRX_ENABLED=0 \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/include -Idriver/src \
+ *       posix/test/nrf_802154_request_swi_test.c posix/src/nrfx_host.c \
+ *       driver/src/nrf_802154_request_swi.c -o request_swi_test
+ *   ./request_swi_test [requests] [interrupt period in us]
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_swi_callouts.h"
+#include "mac_features/nrf_802154_csma_ca.h"
+#include "platform/nrf_802154_irq.h"
+#include "hal/nrf_egu.h"
+
+#define CHECK(cond)                                                            \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                      \
+        }                                                                      \
+    }                                                                          \
+    while (0)
+
+#define TEST_REQUESTS_DEFAULT  2000000L
+#define TEST_PERIOD_US_DEFAULT 20
+#define TEST_SEQUENCE_REQUESTS 100
+#define TEST_ISR_REQUESTS      2   ///< Requests issued by each run of the handler.
+
+#define PRIORITY_SWI           2U  ///< Priority of the SWI interrupt.
+#define PRIORITY_ISSUER        5U  ///< Priority of the request issuers.
+
+nrf_802154_stats_t g_nrf_802154_stats;
+
+static volatile uint32_t     m_failures;
+static volatile sig_atomic_t m_swi_active;  ///< The SWI interrupt is being handled.
+static volatile uint32_t     m_processed;   ///< Requests processed by the SWI handler.
+static uint32_t              m_nest_depth;  ///< Requests still to be issued from the SWI trigger.
+static uint32_t              m_rng_state = 0x2545F491UL;
+static uint32_t              m_isr_rng_state = 0x9E3779B9UL;
+static volatile uint32_t     m_isr_requests;
+
+static uint32_t rng_get(uint32_t * p_state)
+{
+    *p_state ^= *p_state << 13;
+    *p_state ^= *p_state >> 17;
+    *p_state ^= *p_state << 5;
+
+    return *p_state;
+}
+
+/***************************************************************************************************
+ * @section Driver dependencies
+ **************************************************************************************************/
+
+static void request_issue(uint32_t * p_rng_state);
+
+uint32_t nrf_802154_critical_section_active_vector_priority_get(void)
+{
+    return m_swi_active ? PRIORITY_SWI : PRIORITY_ISSUER;
+}
+
+bool nrf_802154_irq_is_enabled(uint32_t irqn)
+{
+    (void)irqn;
+
+    return true;
+}
+
+uint32_t nrf_802154_irq_priority_get(uint32_t irqn)
+{
+    (void)irqn;
+
+    return PRIORITY_SWI;
+}
+
+void nrfx_host_egu_irq(NRF_EGU_Type * p_reg)
+{
+    (void)p_reg;
+
+    if (m_nest_depth != 0U)
+    {
+        // The issuer is preempted after it published its slot, before the SWI interrupt is taken.
+        m_nest_depth--;
+        request_issue(&m_rng_state);
+    }
+
+    m_swi_active = 1;
+    nrf_802154_request_swi_irq_handler();
+    m_swi_active = 0;
+}
+
+bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
+{
+    CHECK(m_swi_active);
+
+    *p_rssi = (int8_t)~*p_rssi;
+    m_processed++;
+
+    return true;
+}
+
+/* The requests below are not issued by the test. */
+
+bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
+                             req_originator_t               req_orig,
+                             nrf_802154_notification_func_t notify_function,
+                             bool                           notify_abort,
+                             uint32_t                       id)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_function;
+    (void)notify_abort;
+    (void)id;
+
+    CHECK(false);
+    return false;
+}
+
+nrf_802154_tx_error_t nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
+                                               req_originator_t               req_orig,
+                                               nrf_802154_transmit_params_t * p_params)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)p_params;
+
+    CHECK(false);
+    return NRF_802154_TX_ERROR_BUSY_CHANNEL;
+}
+
+bool nrf_802154_core_ack_timeout_handle(const nrf_802154_ack_timeout_handle_params_t * p_param)
+{
+    (void)p_param;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+{
+    (void)term_lvl;
+    (void)time_us;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
+{
+    (void)p_data;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_channel_update(req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_cca_cfg_update(void)
+{
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_rssi_measure(void)
+{
+    CHECK(false);
+    return false;
+}
+
+bool nrf_802154_core_antenna_update(void)
+{
+    CHECK(false);
+    return false;
+}
+
+nrf_802154_tx_error_t nrf_802154_csma_ca_start(
+    const nrf_802154_frame_t                     * p_frame,
+    const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)p_metadata;
+
+    CHECK(false);
+    return NRF_802154_TX_ERROR_BUSY_CHANNEL;
+}
+
+/***************************************************************************************************
+ * @section Request issuers
+ **************************************************************************************************/
+
+static void request_issue(uint32_t * p_rng_state)
+{
+    int8_t token = (int8_t)rng_get(p_rng_state);
+    int8_t rssi  = token;
+
+    CHECK(nrf_802154_request_rssi_measurement_get(&rssi));
+    CHECK(rssi == (int8_t)~token);
+}
+
+static void isr_handler(int signal)
+{
+    (void)signal;
+
+    // The handler cannot preempt the SWI interrupt, which has a higher priority.
+    if (m_swi_active || !nrfx_host_exception_enter())
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < TEST_ISR_REQUESTS; i++)
+    {
+        request_issue(&m_isr_rng_state);
+    }
+
+    m_isr_requests += TEST_ISR_REQUESTS;
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static void sequence_scenario(void)
+{
+    printf("requests issued one after another\n");
+
+    m_processed = 0U;
+
+    for (uint32_t i = 0; i < TEST_SEQUENCE_REQUESTS; i++)
+    {
+        request_issue(&m_rng_state);
+    }
+
+    CHECK(m_processed == TEST_SEQUENCE_REQUESTS);
+    CHECK(g_nrf_802154_stats.counters.request_inversions == 0U);
+}
+
+static void nested_scenario(void)
+{
+    printf("requests nested up to the pool size of %u\n", NRF_802154_REQUEST_QUEUE_SIZE);
+
+    // Each nested request publishes its slot before the previous ones are processed.
+    for (uint32_t depth = 1U; depth < NRF_802154_REQUEST_QUEUE_SIZE; depth++)
+    {
+        m_processed  = 0U;
+        m_nest_depth = depth;
+        request_issue(&m_rng_state);
+
+        CHECK(m_nest_depth == 0U);
+        CHECK(m_processed == depth + 1U);
+    }
+
+    // Published slots are processed in any order and are not counted as inversions.
+    CHECK(g_nrf_802154_stats.counters.request_inversions == 0U);
+}
+
+static void preemption_scenario(long requests, long period_us)
+{
+    struct itimerval timer;
+
+    printf("%ld requests preempted by a handler issuing requests every %ld us\n",
+           requests,
+           period_us);
+
+    m_processed = 0U;
+
+    timer.it_interval.tv_sec  = 0;
+    timer.it_interval.tv_usec = period_us;
+    timer.it_value            = timer.it_interval;
+
+    signal(SIGALRM, isr_handler);
+    setitimer(ITIMER_REAL, &timer, NULL);
+
+    for (long i = 0; i < requests; i++)
+    {
+        request_issue(&m_rng_state);
+    }
+
+    timer.it_value.tv_usec = 0;
+    setitimer(ITIMER_REAL, &timer, NULL);
+    signal(SIGALRM, SIG_IGN);
+
+    printf("  handler requests: %u, inversions: %u\n",
+           (unsigned)m_isr_requests,
+           (unsigned)g_nrf_802154_stats.counters.request_inversions);
+
+    CHECK(m_processed == (uint32_t)requests + m_isr_requests);
+    CHECK(m_isr_requests != 0U);
+    CHECK(g_nrf_802154_stats.counters.request_inversions != 0U);
+}
+
+int main(int argc, char ** argv)
+{
+    long requests  = (argc > 1) ? atol(argv[1]) : TEST_REQUESTS_DEFAULT;
+    long period_us = (argc > 2) ? atol(argv[2]) : TEST_PERIOD_US_DEFAULT;
+
+    nrf_802154_request_init();
+
+    sequence_scenario();
+    nested_scenario();
+    preemption_scenario(requests, period_us);
+
+    printf("%s\n", (m_failures == 0U) ? "OK" : "FAIL");
+
+    return (m_failures == 0U) ? 0 : 1;
+}
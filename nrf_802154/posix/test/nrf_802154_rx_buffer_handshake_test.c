@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host test of the handshake between the core and the higher layer releasing receive buffers.
+ *
+ * The higher layer releases a receive buffer in the bitmap of the rx_buffer module directly and
+ * requests @ref nrf_802154_core_notify_buffer_free only if the core awaits a buffer. The core
+ * marks that it awaits a buffer before it searches the bitmap for the second time. The test
+ * builds the core, the rx_buffer module and nrf_802154_buffer_free_raw() of the driver API
+ * module, and replaces the radio scheduler, the TRX module and the other dependencies of the
+ * core. It grants the core a timeslot and starts the reception with all receive buffers taken,
+ * then releases a buffer:
+ *  - after the core ran out of buffers, when the release requests the core to take the buffer,
+ *  - after the first search of the core failed and before the core marked that it awaits
+ *    a buffer, when the second search of the core finds the buffer,
+ *  - after the core marked that it awaits a buffer and before its second search, when the
+ *    second search finds the buffer and the request issued by the release finds nothing to do.
+ *
+ * In each case the test checks that the receiver gets the released buffer, that the core does
+ * not await a buffer anymore and that the higher layer and the rx_buffer_starvations counter
+ * are notified only when the receiver was left without a buffer.
+ *
+ * The releases are injected by intercepting the calls of the core to
+ * nrf_802154_rx_buffer_free_find() with the --wrap option of the GNU linker. The request to
+ * the core is processed once the core returns, as the SWI interrupt of the request module
+ * cannot preempt the RADIO interrupt.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -ffunction-sections -Wl,--gc-sections -Wl,--wrap=nrf_802154_rx_buffer_free_find \
+ *       -DNRF52_SERIES -DNRF_802154_EGU_INSTANCE=NRF_EGU0 \
+ *       -Iposix/include -Icommon/include -Isl/include -Idriver/include -Idriver/src \
+ *       posix/test/nrf_802154_rx_buffer_handshake_test.c posix/src/nrfx_host.c \
+ *       driver/src/nrf_802154.c driver/src/nrf_802154_core.c \
+ *       driver/src/nrf_802154_rx_buffer.c -o rx_buffer_handshake_test
+ *   ./rx_buffer_handshake_test
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_core.h"
+#include "nrf_802154_core_hooks.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_sl_ant_div.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_trx.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_tx_work_buffer.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/ack_generator/nrf_802154_ack_generator.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "rsch/nrf_802154_rsch_crit_sect.h"
+#include "timer/nrf_802154_timer_coord.h"
+
+#define CHECK(cond)                                                            \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                      \
+        }                                                                      \
+    }                                                                          \
+    while (0)
+
+#define TEST_CHANNEL 11U
+
+/** @brief Points at which a buffer is released by a context preempting the core. */
+typedef enum
+{
+    RELEASE_NONE,          ///< The buffer is not released during a search.
+    RELEASE_AFTER_MISS,    ///< After the first search of the core failed.
+    RELEASE_BEFORE_SEARCH, ///< Before the second search of the core.
+} test_release_point_t;
+
+nrf_802154_stats_t g_nrf_802154_stats;
+
+rx_buffer_t * __real_nrf_802154_rx_buffer_free_find(void);
+
+static uint32_t             m_failures;
+static void               * mp_trx_buffer;       ///< Receive buffer set in the TRX module.
+static bool                 m_trx_receiving;     ///< The TRX module receives a frame.
+static uint32_t             m_no_buffer_ntfs;    ///< NRF_802154_RX_ERROR_NO_BUFFER notifications.
+static uint8_t            * mp_requested_buffer; ///< Buffer of the pending request to the core.
+static uint32_t             m_requests;          ///< Requests issued to the core.
+static test_release_point_t m_release_point;
+static rx_buffer_t        * mp_release_buffer;   ///< Buffer released at the release point.
+static uint32_t             m_misses;            ///< Failed searches since the release was armed.
+static rx_buffer_t        * mp_buffers[NRF_802154_RX_BUFFERS]; ///< Buffers in the order of taking.
+static uint32_t             m_buffers_cnt;
+
+/***************************************************************************************************
+ * @section Radio scheduler and critical section
+ **************************************************************************************************/
+
+void nrf_802154_rsch_crit_sect_prio_request(rsch_prio_t prio)
+{
+    (void)prio;
+}
+
+void nrf_802154_rsch_continuous_ended(void)
+{
+}
+
+bool nrf_802154_rsch_timeslot_request(uint32_t length_us, rsch_timeslot_prio_t prio)
+{
+    (void)length_us;
+    (void)prio;
+
+    return true;
+}
+
+uint32_t nrf_802154_rsch_timeslot_us_left_get(void)
+{
+    return UINT32_MAX;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_ppi_update(uint32_t ppi_channel)
+{
+    (void)ppi_channel;
+
+    return true;
+}
+
+bool nrf_802154_critical_section_enter(void)
+{
+    return true;
+}
+
+void nrf_802154_critical_section_exit(void)
+{
+}
+
+void nrf_802154_critical_section_nesting_allow(void)
+{
+}
+
+void nrf_802154_critical_section_nesting_deny(void)
+{
+}
+
+/***************************************************************************************************
+ * @section TRX module
+ **************************************************************************************************/
+
+void nrf_802154_trx_init(void)
+{
+}
+
+void nrf_802154_trx_enable(void)
+{
+}
+
+void nrf_802154_trx_disable(void)
+{
+    m_trx_receiving = false;
+}
+
+void nrf_802154_trx_abort(void)
+{
+    m_trx_receiving = false;
+}
+
+bool nrf_802154_trx_go_idle(void)
+{
+    // The radio is disabled at once
+    m_trx_receiving = false;
+
+    return false;
+}
+
+void nrf_802154_trx_channel_set(uint8_t channel)
+{
+    CHECK(channel == TEST_CHANNEL);
+}
+
+bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
+{
+    bool missing = m_trx_receiving && (mp_trx_buffer == NULL);
+
+    mp_trx_buffer = p_receive_buffer;
+
+    return missing && (p_receive_buffer != NULL);
+}
+
+bool nrf_802154_trx_receive_is_buffer_missing(void)
+{
+    return m_trx_receiving && (mp_trx_buffer == NULL);
+}
+
+void nrf_802154_trx_receive_frame(uint8_t                                bcc,
+                                  nrf_802154_trx_ramp_up_trigger_mode_t  rampup_trigg_mode,
+                                  nrf_802154_trx_receive_notifications_t notifications_mask)
+{
+    (void)bcc;
+    (void)rampup_trigg_mode;
+    (void)notifications_mask;
+
+    m_trx_receiving = true;
+}
+
+bool nrf_802154_trx_psdu_is_being_received(void)
+{
+    return false;
+}
+
+uint32_t nrf_802154_trx_ramp_up_ppi_channel_get(void)
+{
+    return 0U;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_crcok_event_handle_get(void)
+{
+    return NULL;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_get(void)
+{
+    return NULL;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_ready_event_handle_get(void)
+{
+    return NULL;
+}
+
+/* The operations below are not started by the test. */
+
+void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
+                                   nrf_802154_trx_ramp_up_trigger_mode_t   rampup_trigg_mode,
+                                   uint8_t                                 cca_attempts,
+                                   const nrf_802154_fal_tx_power_split_t * p_tx_power,
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask)
+{
+    (void)p_transmit_buffer;
+    (void)rampup_trigg_mode;
+    (void)cca_attempts;
+    (void)p_tx_power;
+    (void)notifications_mask;
+
+    CHECK(false);
+}
+
+void nrf_802154_trx_standalone_cca(void)
+{
+    CHECK(false);
+}
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    (void)ed_count;
+
+    CHECK(false);
+}
+
+void nrf_802154_trx_continuous_carrier(const nrf_802154_fal_tx_power_split_t * p_tx_power)
+{
+    (void)p_tx_power;
+
+    CHECK(false);
+}
+
+void nrf_802154_trx_modulated_carrier(const void                            * p_transmit_buffer,
+                                      const nrf_802154_fal_tx_power_split_t * p_tx_power)
+{
+    (void)p_transmit_buffer;
+    (void)p_tx_power;
+
+    CHECK(false);
+}
+
+/***************************************************************************************************
+ * @section Other dependencies of the core
+ **************************************************************************************************/
+
+void nrf_802154_ack_generator_init(void)
+{
+}
+
+void nrf_802154_ack_generator_reset(void)
+{
+}
+
+bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)term_lvl;
+    (void)req_orig;
+
+    return true;
+}
+
+void nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+}
+
+void nrf_802154_core_hooks_tx_ack_failed(uint8_t * p_ack, nrf_802154_tx_error_t error)
+{
+    (void)p_ack;
+    (void)error;
+}
+
+bool nrf_802154_frame_parser_data_init(uint8_t                       * p_frame,
+                                       uint8_t                         valid_data_len,
+                                       nrf_802154_frame_parser_level_t requested_parse_level,
+                                       nrf_802154_frame_t            * p_parser_data)
+{
+    (void)p_frame;
+    (void)valid_data_len;
+    (void)requested_parse_level;
+    (void)p_parser_data;
+
+    return true;
+}
+
+uint8_t nrf_802154_pib_channel_get(void)
+{
+    return TEST_CHANNEL;
+}
+
+nrf_802154_coex_rx_request_mode_t nrf_802154_pib_coex_rx_request_mode_get(void)
+{
+    return NRF_802154_COEX_RX_REQUEST_MODE_DESTINED;
+}
+
+bool nrf_802154_wifi_coex_is_enabled(void)
+{
+    return false;
+}
+
+void nrf_802154_sl_ant_div_rx_aborted_notify(void)
+{
+}
+
+void nrf_802154_sl_ant_div_energy_detection_requested_notify(uint32_t * p_ed_time)
+{
+    (void)p_ed_time;
+}
+
+void nrf_802154_sl_ant_div_energy_detection_aborted_notify(void)
+{
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    return NRF_802154_SL_TIMER_RET_INACTIVE;
+}
+
+void nrf_802154_timer_coord_start(void)
+{
+}
+
+void nrf_802154_timer_coord_stop(void)
+{
+}
+
+void nrf_802154_timer_coord_timestamp_prepare(const nrf_802154_sl_event_handle_t * p_event)
+{
+    (void)p_event;
+}
+
+int8_t nrf_802154_tx_power_split_pib_power_get(
+    nrf_802154_fal_tx_power_split_t * const p_split_power)
+{
+    (void)p_split_power;
+
+    return 0;
+}
+
+const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame)
+{
+    return p_original_frame;
+}
+
+void nrf_802154_tx_work_buffer_original_frame_update(
+    uint8_t                              * p_original_frame,
+    nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    (void)p_original_frame;
+    (void)p_frame_props;
+}
+
+/***************************************************************************************************
+ * @section Higher layer
+ **************************************************************************************************/
+
+bool nrf_802154_request_buffer_free(uint8_t * p_data)
+{
+    // Processed by the SWI interrupt once the core returns
+    CHECK(mp_requested_buffer == NULL);
+
+    mp_requested_buffer = p_data;
+    m_requests++;
+
+    return true;
+}
+
+void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)p_data;
+    (void)power;
+    (void)lqi;
+
+    CHECK(false);
+}
+
+bool nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error, uint32_t id, bool allow_drop)
+{
+    (void)id;
+    (void)allow_drop;
+
+    CHECK(error == NRF_802154_RX_ERROR_NO_BUFFER);
+    m_no_buffer_ntfs++;
+
+    return true;
+}
+
+void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    (void)error;
+
+    CHECK(false);
+}
+
+void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
+{
+    (void)error;
+
+    CHECK(false);
+}
+
+/** @brief Releases the buffer from a context that preempted the core. */
+static void buffer_release(void)
+{
+    m_release_point = RELEASE_NONE;
+    nrf_802154_buffer_free_raw(mp_release_buffer->data);
+}
+
+rx_buffer_t * __wrap_nrf_802154_rx_buffer_free_find(void)
+{
+    if ((m_release_point == RELEASE_BEFORE_SEARCH) && (m_misses == 1U))
+    {
+        buffer_release();
+    }
+
+    rx_buffer_t * p_buffer = __real_nrf_802154_rx_buffer_free_find();
+
+    if (p_buffer == NULL)
+    {
+        m_misses++;
+
+        if ((m_release_point == RELEASE_AFTER_MISS) && (m_misses == 1U))
+        {
+            buffer_release();
+        }
+    }
+
+    return p_buffer;
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+/** @brief Processes the request issued to the core, as the SWI interrupt does. */
+static void requests_process(void)
+{
+    if (mp_requested_buffer != NULL)
+    {
+        uint8_t * p_data = mp_requested_buffer;
+
+        mp_requested_buffer = NULL;
+        CHECK(nrf_802154_core_notify_buffer_free(p_data));
+    }
+}
+
+/** @brief Takes all free receive buffers, as if frames were received into them. */
+static void buffers_take_all(void)
+{
+    rx_buffer_t * p_buffer;
+
+    while ((p_buffer = __real_nrf_802154_rx_buffer_free_find()) != NULL)
+    {
+        nrf_802154_rx_buffer_take(p_buffer);
+
+        if (m_buffers_cnt < NRF_802154_RX_BUFFERS)
+        {
+            mp_buffers[m_buffers_cnt++] = p_buffer;
+        }
+    }
+
+    CHECK(nrf_802154_rx_buffer_occupancy_get() == NRF_802154_RX_BUFFERS);
+}
+
+/**
+ * @brief Restarts the reception with all buffers taken and checks that the released buffer is
+ *        set in the receiver.
+ *
+ * @param[in]  buffer_idx     Index of the released buffer in @ref mp_buffers.
+ * @param[in]  release_point  Point of the search of the core at which the buffer is released.
+ * @param[in]  starved        The receiver is expected to be left without a buffer until
+ *                            the request to the core is processed.
+ */
+static void scenario_run(uint32_t buffer_idx, test_release_point_t release_point, bool starved)
+{
+    uint32_t requests    = m_requests;
+    uint32_t ntfs        = m_no_buffer_ntfs;
+    uint32_t starvations = g_nrf_802154_stats.counters.rx_buffer_starvations;
+
+    buffers_take_all();
+
+    mp_release_buffer = mp_buffers[buffer_idx];
+    m_misses          = 0U;
+    m_release_point   = release_point;
+
+    CHECK(nrf_802154_core_sleep(NRF_802154_TERM_802154));
+    CHECK(nrf_802154_core_state_get() == RADIO_STATE_SLEEP);
+    CHECK(nrf_802154_core_receive(NRF_802154_TERM_802154, REQ_ORIG_HIGHER_LAYER, NULL, false, 0U));
+    CHECK(nrf_802154_core_state_get() == RADIO_STATE_RX);
+
+    if (release_point == RELEASE_NONE)
+    {
+        CHECK(mp_trx_buffer == NULL);
+        CHECK(nrf_802154_trx_receive_is_buffer_missing());
+        CHECK(nrf_802154_core_rx_buffer_is_awaited());
+
+        // The buffer is released by a context that does not preempt the core
+        buffer_release();
+    }
+
+    CHECK(m_release_point == RELEASE_NONE);
+
+    requests_process();
+
+    CHECK(mp_trx_buffer == mp_release_buffer->data);
+    CHECK(!nrf_802154_core_rx_buffer_is_awaited());
+    CHECK(m_requests - requests == ((release_point == RELEASE_AFTER_MISS) ? 0U : 1U));
+    CHECK(m_no_buffer_ntfs - ntfs == (starved ? 1U : 0U));
+    CHECK(g_nrf_802154_stats.counters.rx_buffer_starvations - starvations == (starved ? 1U : 0U));
+}
+
+int main(void)
+{
+    nrf_802154_rx_buffer_init();
+    nrf_802154_core_init();
+
+    // Grant the timeslot to the core
+    nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_MAX);
+
+    printf("release after the receiver was left without a buffer\n");
+    scenario_run(3U, RELEASE_NONE, true);
+
+    printf("release between the first search and awaiting a buffer\n");
+    scenario_run(15U, RELEASE_AFTER_MISS, false);
+
+    printf("release between awaiting a buffer and the second search\n");
+    scenario_run(0U, RELEASE_BEFORE_SEARCH, false);
+
+    printf("release after the receiver was left without a buffer again\n");
+    scenario_run(8U, RELEASE_NONE, true);
+
+    printf("%s\n", (m_failures == 0U) ? "OK" : "FAIL");
+
+    return (m_failures == 0U) ? 0 : 1;
+}
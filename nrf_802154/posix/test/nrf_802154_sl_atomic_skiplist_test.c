@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host stress test of the lock-free skip list of the service layer.
+ *
+ * The exclusive load and store instructions are emulated by posix/include/nrfx.h. A periodic
+ * SIGALRM handler plays the role of an interrupt handler: it clears the exclusive monitor and
+ * modifies the list while the main loop is in the middle of its own operations, so that both
+ * contexts have to search the list again when they are preempted.
+ *
+ * Half of the items belong to the main loop and half to the handler. Each context inserts its
+ * items with random keys, removes them and removes the list head if it owns it. The key range
+ * is small, so that many items are equal. The test checks:
+ *  - that every removal of a member succeeds and that the removed head is a member,
+ *  - periodically and at the end, with the handler blocked, that each level is ordered and
+ *    holds only members, that equal items of a context are kept in the order of insertion and
+ *    that level 0 holds all the members.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -Iposix/include -Isl/include \
+ *       posix/test/nrf_802154_sl_atomic_skiplist_test.c posix/src/nrfx_host.c \
+ *       sl/sl_opensource/src/nrf_802154_sl_atomic_skiplist.c -o skiplist_test
+ *   ./skiplist_test [items] [operations] [interrupt period in us]
+ *
+ * The items are allocated in the low 4 GB of the address space, as required by the exclusive
+ * access emulation. The program returns a non-zero status if any check fails.
+ */
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+#include <nrfx.h>
+
+#include "nrf_802154_sl_atomic_skiplist.h"
+
+#define TEST_ITEMS_DEFAULT      200
+#define TEST_OPERATIONS_DEFAULT 2000000L
+#define TEST_PERIOD_US_DEFAULT  50
+#define TEST_ISR_OPERATIONS     3       ///< Operations performed by each run of the handler.
+#define TEST_CHECK_INTERVAL     0xFFFFL ///< Operations of the main loop between the list checks.
+
+#define OWNER_THREAD 1U
+#define OWNER_ISR    2U
+
+#define ITEM_CAP_OFFSET offsetof(test_item_t, cap)
+
+typedef struct
+{
+    uint32_t                                              key;
+    uint32_t                                              owner;
+    uint32_t                                              seq;       ///< Insertion order.
+    volatile bool                                         is_member;
+    nrf_802154_sl_atomic_skiplist_membership_capability_t cap;
+} test_item_t;
+
+typedef struct
+{
+    test_item_t * p_items;
+    uint32_t      count;
+    uint32_t      owner;
+    uint32_t      rng_state;
+    uint32_t      operations;
+} test_context_t;
+
+static nrf_802154_sl_atomic_skiplist_t m_list;
+static test_item_t                   * m_items;
+static uint32_t                        m_items_count;
+static uint32_t                        m_key_range;
+static uint32_t                        m_seq;
+static volatile uint32_t               m_errors;
+static test_context_t                  m_thread_ctx;
+static test_context_t                  m_isr_ctx;
+
+static uint32_t rng_get(uint32_t * p_state)
+{
+    *p_state ^= *p_state << 13;
+    *p_state ^= *p_state >> 17;
+    *p_state ^= *p_state << 5;
+
+    return *p_state;
+}
+
+static int_fast8_t item_compare(const void * p_a, const void * p_b)
+{
+    uint32_t a = ((const test_item_t *)p_a)->key;
+    uint32_t b = ((const test_item_t *)p_b)->key;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static bool item_owner_check(const void * p_item, const void * p_param)
+{
+    return ((const test_item_t *)p_item)->owner == *(const uint32_t *)p_param;
+}
+
+/** @brief Performs a random operation on an item of the context. */
+static void operation_perform(test_context_t * p_ctx)
+{
+    test_item_t * p_item = &p_ctx->p_items[rng_get(&p_ctx->rng_state) % p_ctx->count];
+
+    switch (rng_get(&p_ctx->rng_state) % 3U)
+    {
+        case 0:
+        {
+            test_item_t * p_head = nrf_802154_sl_atomic_skiplist_remove_head_if_criteria_met(
+                &m_list, ITEM_CAP_OFFSET, item_compare, item_owner_check, &p_ctx->owner);
+
+            if (p_head != NULL)
+            {
+                if (!p_head->is_member || (p_head->owner != p_ctx->owner))
+                {
+                    m_errors++;
+                }
+
+                p_head->is_member = false;
+            }
+            break;
+        }
+
+        default:
+            if (!p_item->is_member)
+            {
+                p_item->key       = rng_get(&p_ctx->rng_state) % m_key_range;
+                p_item->seq       = __atomic_add_fetch(&m_seq, 1U, __ATOMIC_RELAXED);
+                p_item->is_member = true;
+                nrf_802154_sl_atomic_skiplist_insert_ordered(&m_list,
+                                                             p_item,
+                                                             ITEM_CAP_OFFSET,
+                                                             item_compare);
+            }
+            else
+            {
+                if (!nrf_802154_sl_atomic_skiplist_remove(&m_list,
+                                                          p_item,
+                                                          ITEM_CAP_OFFSET,
+                                                          item_compare))
+                {
+                    m_errors++;
+                }
+
+                p_item->is_member = false;
+            }
+            break;
+    }
+
+    p_ctx->operations++;
+}
+
+static void isr_handler(int signal)
+{
+    (void)signal;
+
+    if (!nrfx_host_exception_enter())
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < TEST_ISR_OPERATIONS; i++)
+    {
+        operation_perform(&m_isr_ctx);
+    }
+
+    // Exception return clears the exclusive monitor as well.
+    __CLREX();
+}
+
+static bool list_check(void)
+{
+    uint32_t members = 0U;
+
+    for (uint32_t i = 0U; i < m_items_count; i++)
+    {
+        members += m_items[i].is_member ? 1U : 0U;
+    }
+
+    for (uint32_t level = 0U; level < NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS; level++)
+    {
+        const test_item_t * p_prev = NULL;
+        const test_item_t * p_item = m_list.p_head[level];
+        uint32_t            count  = 0U;
+
+        while (p_item != NULL)
+        {
+            if (!p_item->is_member)
+            {
+                printf("level %u: item that is not a member\n", (unsigned)level);
+                return false;
+            }
+
+            if ((p_prev != NULL) && (p_prev->key > p_item->key))
+            {
+                printf("level %u: items out of order\n", (unsigned)level);
+                return false;
+            }
+
+            if ((p_prev != NULL) && (p_prev->key == p_item->key) &&
+                (p_prev->owner == p_item->owner) && (p_prev->seq > p_item->seq))
+            {
+                printf("level %u: equal items out of insertion order\n", (unsigned)level);
+                return false;
+            }
+
+            if (++count > m_items_count)
+            {
+                printf("level %u: cycle\n", (unsigned)level);
+                return false;
+            }
+
+            p_prev = p_item;
+            p_item = p_item->cap.p_next[level];
+        }
+
+        if ((level == 0U) && (count != members))
+        {
+            printf("level 0: %u items, %u members\n", (unsigned)count, (unsigned)members);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char ** argv)
+{
+    long              operations = (argc > 2) ? atol(argv[2]) : TEST_OPERATIONS_DEFAULT;
+    long              period_us  = (argc > 3) ? atol(argv[3]) : TEST_PERIOD_US_DEFAULT;
+    sigset_t          isr_mask;
+    struct itimerval  timer;
+    uint32_t          members    = 0U;
+    bool              ok         = true;
+
+    m_items_count = (argc > 1) ? (uint32_t)atoi(argv[1]) : TEST_ITEMS_DEFAULT;
+    m_key_range   = m_items_count / 4U + 1U;
+
+    if (m_items_count < 2U)
+    {
+        printf("at least 2 items are needed\n");
+        return 1;
+    }
+
+    m_items = mmap(NULL, sizeof(test_item_t) * m_items_count, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+    if (m_items == MAP_FAILED)
+    {
+        printf("cannot allocate the items in the low 4 GB\n");
+        return 1;
+    }
+
+    memset(m_items, 0, sizeof(test_item_t) * m_items_count);
+
+    m_thread_ctx = (test_context_t){m_items, m_items_count / 2U, OWNER_THREAD, 12345U, 0U};
+    m_isr_ctx    = (test_context_t){m_items + m_items_count / 2U,
+                                    m_items_count - m_items_count / 2U,
+                                    OWNER_ISR,
+                                    777U,
+                                    0U};
+
+    for (uint32_t i = 0U; i < m_items_count; i++)
+    {
+        m_items[i].owner = (i < m_items_count / 2U) ? OWNER_THREAD : OWNER_ISR;
+    }
+
+    nrf_802154_sl_atomic_skiplist_init(&m_list);
+
+    sigemptyset(&isr_mask);
+    sigaddset(&isr_mask, SIGALRM);
+
+    if (period_us > 0)
+    {
+        signal(SIGALRM, isr_handler);
+        timer.it_interval.tv_sec  = 0;
+        timer.it_interval.tv_usec = period_us;
+        timer.it_value            = timer.it_interval;
+        setitimer(ITIMER_REAL, &timer, NULL);
+    }
+
+    for (long i = 0; ok && (i < operations); i++)
+    {
+        operation_perform(&m_thread_ctx);
+
+        if ((i & TEST_CHECK_INTERVAL) == 0)
+        {
+            sigprocmask(SIG_BLOCK, &isr_mask, NULL);
+            ok = list_check();
+            sigprocmask(SIG_UNBLOCK, &isr_mask, NULL);
+        }
+    }
+
+    sigprocmask(SIG_BLOCK, &isr_mask, NULL);
+    ok = ok && list_check() && (m_errors == 0U);
+
+    for (uint32_t i = 0U; i < m_items_count; i++)
+    {
+        members += m_items[i].is_member ? 1U : 0U;
+    }
+
+    printf("levels %u, items %u, members %u, operations %u + %u in the handler, "
+           "retries %u, errors %u\n",
+           (unsigned)NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS,
+           (unsigned)m_items_count,
+           (unsigned)members,
+           (unsigned)m_thread_ctx.operations,
+           (unsigned)m_isr_ctx.operations,
+           (unsigned)m_list.retries,
+           (unsigned)m_errors);
+
+    if (!ok)
+    {
+        printf("FAILED\n");
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host fuzz test of the specialized spinel packing of the frame properties.
+ *
+ * The test compares the functions in serialization/src/nrf_802154_spinel_pack.c with
+ * spinel_datatype_pack() and spinel_datatype_unpack() called with the format strings from
+ * nrf_802154_spinel_datatypes.h:
+ *  - packing of random received frames and transmit requests, with buffers of random size.
+ *    The frames must be equal byte for byte, and both functions must fail for the same
+ *    buffer sizes,
+ *  - unpacking of the packed property data after random mutations and truncations.
+ *    When the specialized function succeeds, the generic one must decode the same number
+ *    of bytes and the same values. When it fails, the generic one must fail too, unless
+ *    the property data end before the end of the frame block. The generic unpacking then
+ *    returns a non-negative value without filling the outputs, and such cases are only
+ *    counted.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DNRF_802154_SERIALIZATION_HOST=1 -Icommon/include -Iserialization/src \
+ *       -Iserialization/src/include \
+ *       posix/test/nrf_802154_spinel_pack_test.c serialization/src/nrf_802154_spinel_pack.c \
+ *       serialization/spinel_base/spinel.c -o spinel_pack_test
+ *   ./spinel_pack_test
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_pack.h"
+
+#define TEST_CASES       200000U ///< Random frames packed for each property.
+#define TEST_MUTATIONS   4U      ///< Mutated copies unpacked for each packed frame.
+#define TEST_BUFFER_SIZE 300U    ///< Larger than any spinel frame packed by the test.
+
+/** @brief Length of the header flag, the command and the vendor property of a spinel frame. */
+#define TEST_HEADER_LEN  4U
+
+#define FRAME_FMT(p_fmt) SPINEL_DATATYPE_COMMAND_S SPINEL_DATATYPE_UINT_PACKED_S p_fmt
+
+/** @brief Result of one check, counted by @ref test_result_add. */
+typedef enum
+{
+    CHECK_EQUAL,
+    CHECK_TRUNCATED,
+    CHECK_MISMATCH,
+} check_t;
+
+typedef struct
+{
+    const char * p_name;
+    uint32_t     cases;
+    uint32_t     truncated;
+    uint32_t     mismatches;
+} test_result_t;
+
+static uint32_t m_rng_state = 12345U;
+
+static uint32_t rng_get(void)
+{
+    m_rng_state = m_rng_state * 1103515245U + 12345U;
+    return m_rng_state >> 8;
+}
+
+static void rng_fill(uint8_t * p_buf, size_t len)
+{
+    for (size_t i = 0U; i < len; i++)
+    {
+        p_buf[i] = (uint8_t)rng_get();
+    }
+}
+
+static void test_result_add(test_result_t * p_result, check_t check, uint32_t seed)
+{
+    p_result->cases++;
+
+    if (check == CHECK_TRUNCATED)
+    {
+        p_result->truncated++;
+    }
+    else if (check == CHECK_MISMATCH)
+    {
+        if (p_result->mismatches < 5U)
+        {
+            printf("%s: mismatch, case seed %u\n", p_result->p_name, (unsigned)seed);
+        }
+
+        p_result->mismatches++;
+    }
+}
+
+static bool test_result_print(const test_result_t * p_result)
+{
+    printf("%-30s %8u cases, %6u truncated, %u mismatches\n",
+           p_result->p_name,
+           (unsigned)p_result->cases,
+           (unsigned)p_result->truncated,
+           (unsigned)p_result->mismatches);
+
+    return p_result->mismatches == 0U;
+}
+
+/* Mutates the packed property data: random octets, the frame block length or the length of
+ * the property data. */
+static size_t mutate(uint8_t * p_data, size_t len, size_t block_len_offset)
+{
+    switch (rng_get() % 4U)
+    {
+        case 0U:
+            p_data[rng_get() % len] = (uint8_t)rng_get();
+            break;
+
+        case 1U:
+            p_data[block_len_offset + (rng_get() % 2U)] = (uint8_t)rng_get();
+            break;
+
+        case 2U:
+            len = rng_get() % (len + 1U);
+            break;
+
+        default:
+            break;
+    }
+
+    return len;
+}
+
+/* Checks if the property data end before the end of the frame block. */
+static bool block_truncated(const uint8_t * p_data, size_t len, size_t block_len_offset)
+{
+    if (len < block_len_offset + NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE)
+    {
+        return true;
+    }
+
+    uint16_t block_len = nrf_802154_spinel_unpack_uint16(&p_data[block_len_offset]);
+
+    return (block_len_offset + NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE + block_len) > len;
+}
+
+static check_t received_unpack_check(const uint8_t * p_data, size_t len)
+{
+    uint32_t       handle;
+    const void   * p_frame;
+    size_t         hdata_len;
+    int8_t         power;
+    uint8_t        lqi;
+    uint64_t       time;
+    uint32_t       ref_handle    = 0U;
+    void         * p_ref_frame   = NULL;
+    size_t         ref_hdata_len = 0U;
+    int8_t         ref_power     = 0;
+    uint8_t        ref_lqi       = 0U;
+    uint64_t       ref_time      = 0U;
+    spinel_ssize_t siz;
+    spinel_ssize_t ref_siz;
+
+    siz = nrf_802154_spinel_unpack_received_timestamp_raw(p_data, len, &handle, &p_frame,
+                                                          &hdata_len, &power, &lqi, &time);
+    ref_siz = spinel_datatype_unpack(p_data,
+                                     len,
+                                     SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                     NRF_802154_HDATA_DECODE(ref_handle,
+                                                             p_ref_frame,
+                                                             ref_hdata_len),
+                                     &ref_power,
+                                     &ref_lqi,
+                                     &ref_time);
+
+    if (siz < 0)
+    {
+        if (ref_siz < 0)
+        {
+            return CHECK_EQUAL;
+        }
+
+        return block_truncated(p_data, len, 0U) ? CHECK_TRUNCATED : CHECK_MISMATCH;
+    }
+
+    return ((siz == ref_siz) && (handle == ref_handle) && (p_frame == p_ref_frame) &&
+            (hdata_len == ref_hdata_len) && (power == ref_power) && (lqi == ref_lqi) &&
+            (time == ref_time)) ? CHECK_EQUAL : CHECK_MISMATCH;
+}
+
+static bool received_timestamp_raw_check(void)
+{
+    const uint32_t prop   = SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW;
+    test_result_t  pack   = {.p_name = "RECEIVED_TIMESTAMP_RAW pack"};
+    test_result_t  unpack = {.p_name = "RECEIVED_TIMESTAMP_RAW unpack"};
+
+    for (uint32_t i = 0U; i < TEST_CASES; i++)
+    {
+        uint8_t        frame[MAX_PACKET_SIZE + PHR_SIZE + sizeof(uint32_t)];
+        uint8_t        buf[TEST_BUFFER_SIZE];
+        uint8_t        ref_buf[TEST_BUFFER_SIZE];
+        uint32_t       handle    = rng_get();
+        int8_t         power     = (int8_t)rng_get();
+        uint8_t        lqi       = (uint8_t)rng_get();
+        uint64_t       time      = ((uint64_t)rng_get() << 40) ^ rng_get();
+        size_t         buf_size;
+        spinel_ssize_t siz;
+        spinel_ssize_t ref_siz;
+        size_t         hdata_len;
+
+        // Every fourth frame is packed into a buffer that may be too small.
+        buf_size = TEST_BUFFER_SIZE - (rng_get() % 4U == 0U ? rng_get() % 200U : 0U);
+
+        rng_fill(frame, sizeof(frame));
+        frame[PHR_OFFSET] = (uint8_t)(rng_get() % (MAX_PACKET_SIZE + 1U));
+        hdata_len         = NRF_802154_HDATA_LENGTH(frame[PHR_OFFSET]);
+
+        memset(buf, 0, sizeof(buf));
+        memset(ref_buf, 0, sizeof(ref_buf));
+
+        siz = nrf_802154_spinel_pack_received_timestamp_raw(buf, buf_size, handle, frame,
+                                                            hdata_len, power, lqi, time);
+        ref_siz = spinel_datatype_pack(ref_buf,
+                                       buf_size,
+                                       FRAME_FMT(SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW),
+                                       SPINEL_HEADER_FLAG,
+                                       SPINEL_CMD_PROP_VALUE_IS,
+                                       prop,
+                                       NRF_802154_HDATA_ENCODE(handle, frame, frame[PHR_OFFSET]),
+                                       power,
+                                       lqi,
+                                       time);
+
+        // The generic packing returns the needed size if the buffer is too small.
+        if ((ref_siz >= 0) && ((size_t)ref_siz > buf_size))
+        {
+            test_result_add(&pack, (siz < 0) ? CHECK_EQUAL : CHECK_MISMATCH, i);
+            continue;
+        }
+
+        test_result_add(&pack,
+                        ((siz == ref_siz) && (memcmp(buf, ref_buf, sizeof(buf)) == 0)) ?
+                        CHECK_EQUAL : CHECK_MISMATCH,
+                        i);
+
+        if (siz < 0)
+        {
+            continue;
+        }
+
+        for (uint32_t m = 0U; m < TEST_MUTATIONS; m++)
+        {
+            uint8_t data[TEST_BUFFER_SIZE];
+            size_t  len = (size_t)siz - TEST_HEADER_LEN;
+
+            memcpy(data, &buf[TEST_HEADER_LEN], len);
+            len = mutate(data, len, 0U);
+
+            test_result_add(&unpack, received_unpack_check(data, len), i);
+        }
+    }
+
+    return test_result_print(&pack) & test_result_print(&unpack);
+}
+
+static bool metadata_equal(const nrf_802154_transmit_metadata_t * p_a,
+                           const nrf_802154_transmit_metadata_t * p_b)
+{
+    return (p_a->frame_props.is_secured == p_b->frame_props.is_secured) &&
+           (p_a->frame_props.dynamic_data_is_set == p_b->frame_props.dynamic_data_is_set) &&
+           (p_a->cca == p_b->cca) &&
+           (p_a->tx_power.use_metadata_value == p_b->tx_power.use_metadata_value) &&
+           (p_a->tx_power.power == p_b->tx_power.power) &&
+           (p_a->tx_channel.use_metadata_value == p_b->tx_channel.use_metadata_value) &&
+           (p_a->tx_channel.channel == p_b->tx_channel.channel) &&
+           (p_a->tx_timestamp_encode == p_b->tx_timestamp_encode);
+}
+
+static check_t transmit_unpack_check(const uint8_t * p_data, size_t len)
+{
+    nrf_802154_transmit_metadata_t metadata;
+    nrf_802154_transmit_metadata_t ref_metadata;
+    uint32_t                       handle;
+    const void                   * p_frame;
+    size_t                         hdata_len;
+    uint32_t                       ref_handle    = 0U;
+    void                         * p_ref_frame   = NULL;
+    size_t                         ref_hdata_len = 0U;
+    spinel_ssize_t                 siz;
+    spinel_ssize_t                 ref_siz;
+
+    memset(&ref_metadata, 0, sizeof(ref_metadata));
+
+    siz = nrf_802154_spinel_unpack_transmit_raw(p_data, len, &metadata, &handle, &p_frame,
+                                                &hdata_len);
+    ref_siz = spinel_datatype_unpack(p_data,
+                                     len,
+                                     SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                     NRF_802154_TRANSMIT_METADATA_DECODE(ref_metadata),
+                                     NRF_802154_HDATA_DECODE(ref_handle,
+                                                             p_ref_frame,
+                                                             ref_hdata_len));
+
+    if (siz < 0)
+    {
+        if (ref_siz < 0)
+        {
+            return CHECK_EQUAL;
+        }
+
+        return block_truncated(p_data, len, 8U) ? CHECK_TRUNCATED : CHECK_MISMATCH;
+    }
+
+    return ((siz == ref_siz) && metadata_equal(&metadata, &ref_metadata) &&
+            (handle == ref_handle) && (p_frame == p_ref_frame) &&
+            (hdata_len == ref_hdata_len)) ? CHECK_EQUAL : CHECK_MISMATCH;
+}
+
+static bool transmit_raw_check(void)
+{
+    const uint32_t prop   = SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW;
+    test_result_t  pack   = {.p_name = "TRANSMIT_RAW pack"};
+    test_result_t  unpack = {.p_name = "TRANSMIT_RAW unpack"};
+
+    for (uint32_t i = 0U; i < TEST_CASES; i++)
+    {
+        nrf_802154_transmit_metadata_t metadata;
+        uint8_t                        frame[MAX_PACKET_SIZE + PHR_SIZE + sizeof(uint32_t)];
+        uint8_t                        buf[TEST_BUFFER_SIZE];
+        uint8_t                        ref_buf[TEST_BUFFER_SIZE];
+        uint32_t                       handle = rng_get();
+        uint32_t                       bits   = rng_get();
+        size_t                         buf_size;
+        spinel_ssize_t                 siz;
+        spinel_ssize_t                 ref_siz;
+        size_t                         hdata_len;
+
+        buf_size = TEST_BUFFER_SIZE - (rng_get() % 4U == 0U ? rng_get() % 200U : 0U);
+
+        metadata.frame_props.is_secured          = (bits & 0x01U) != 0U;
+        metadata.frame_props.dynamic_data_is_set = (bits & 0x02U) != 0U;
+        metadata.cca                             = (bits & 0x04U) != 0U;
+        metadata.tx_power.use_metadata_value     = (bits & 0x08U) != 0U;
+        metadata.tx_power.power                  = (int8_t)(bits >> 8);
+        metadata.tx_channel.use_metadata_value   = (bits & 0x10U) != 0U;
+        metadata.tx_channel.channel              = (uint8_t)(bits >> 16);
+        metadata.tx_timestamp_encode             = (bits & 0x20U) != 0U;
+
+        rng_fill(frame, sizeof(frame));
+        frame[PHR_OFFSET] = (uint8_t)(rng_get() % (MAX_PACKET_SIZE + 1U));
+        hdata_len         = NRF_802154_HDATA_LENGTH(frame[PHR_OFFSET]);
+
+        memset(buf, 0, sizeof(buf));
+        memset(ref_buf, 0, sizeof(ref_buf));
+
+        siz = nrf_802154_spinel_pack_transmit_raw(buf, buf_size, &metadata, handle, frame,
+                                                  hdata_len);
+        ref_siz = spinel_datatype_pack(ref_buf,
+                                       buf_size,
+                                       FRAME_FMT(SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW),
+                                       SPINEL_HEADER_FLAG,
+                                       SPINEL_CMD_PROP_VALUE_SET,
+                                       prop,
+                                       NRF_802154_TRANSMIT_METADATA_ENCODE(metadata),
+                                       NRF_802154_HDATA_ENCODE(handle, frame, frame[PHR_OFFSET]));
+
+        if ((ref_siz >= 0) && ((size_t)ref_siz > buf_size))
+        {
+            test_result_add(&pack, (siz < 0) ? CHECK_EQUAL : CHECK_MISMATCH, i);
+            continue;
+        }
+
+        test_result_add(&pack,
+                        ((siz == ref_siz) && (memcmp(buf, ref_buf, sizeof(buf)) == 0)) ?
+                        CHECK_EQUAL : CHECK_MISMATCH,
+                        i);
+
+        if (siz < 0)
+        {
+            continue;
+        }
+
+        for (uint32_t m = 0U; m < TEST_MUTATIONS; m++)
+        {
+            uint8_t data[TEST_BUFFER_SIZE];
+            size_t  len = (size_t)siz - TEST_HEADER_LEN;
+
+            memcpy(data, &buf[TEST_HEADER_LEN], len);
+            len = mutate(data, len, 8U);
+
+            test_result_add(&unpack, transmit_unpack_check(data, len), i);
+        }
+    }
+
+    return test_result_print(&pack) & test_result_print(&unpack);
+}
+
+int main(void)
+{
+    bool ok = received_timestamp_raw_check();
+
+    ok &= transmit_raw_check();
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host loopback test of the pipelined requests of the serialization.
+ *
+ * The application core serialization runs against a fake network core implemented in this
+ * file, in place of the spinel backend. The fake network core answers each request in order,
+ * and it holds the responses until the application core waits for a response, so the number
+ * of round trips can be counted. Each scenario runs in a child process, with
+ * a fresh serialization state:
+ *  - a network core that echoes TIDs: 41 pipelined setters and setting the pending bit for
+ *    100 extended addresses, with the number of round trips of each,
+ *  - the same network core reporting a failure of one pipelined request,
+ *  - a network core built before pipelined requests were added, which responds with TID zero
+ *    and does not support SPINEL_CMD_NOOP nor the bulk pending bit request. Pipelining must
+ *    not start, and the requests must complete synchronously,
+ *  - a second pipeline started while requests are pipelined, which must be rejected,
+ *  - a spinel frame passed by the backend while another one is dispatched, which must be
+ *    rejected.
+ *
+ * In every scenario, no response may reach the response notifier unexpectedly and no
+ * serialization error may be reported, except where a scenario expects one.
+ *
+ * Build and run from the nrf_802154 directory:
+ *
+ *   gcc -O2 -DNRF_802154_SERIALIZATION_HOST=1 \
+ *       -DCONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT=1000 \
+ *       -Iposix/include -Icommon/include -Iserialization/src -Iserialization/src/include \
+ *       -Iserialization/include/platform -Iserialization/include/serialization \
+ *       posix/test/nrf_802154_spinel_pipeline_test.c serialization/spinel_base/spinel.c \
+ *       serialization/src/nrf_802154_spinel.c serialization/src/nrf_802154_spinel_app.c \
+ *       serialization/src/nrf_802154_spinel_dec.c serialization/src/nrf_802154_spinel_dec_app.c \
+ *       serialization/src/nrf_802154_spinel_pipeline.c serialization/src/nrf_802154_spinel_pack.c \
+ *       serialization/src/nrf_802154_buffer_mgr_src.c \
+ *       serialization/src/nrf_802154_buffer_mgr_dst.c \
+ *       serialization/src/nrf_802154_kvmap.c -o spinel_pipeline_test
+ *   ./spinel_pipeline_test
+ *
+ * The program returns a non-zero status if any check fails.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_spinel_backend_callouts.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_pipeline.h"
+#include "nrf_802154_spinel_response_notifier.h"
+
+#define TEST_FRAME_SIZE   SPINEL_FRAME_MAX_SIZE
+#define TEST_QUEUE_SIZE   32U ///< Responses the fake network core can hold.
+#define TEST_SETTERS      41U ///< Pipelined setters in a scenario.
+#define TEST_BULK_ADDRS   100U
+
+#define CHECK(cond)                                                 \
+    do                                                              \
+    {                                                               \
+        if (!(cond))                                                \
+        {                                                           \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                           \
+        }                                                           \
+    }                                                               \
+    while (0)
+
+/** @brief Spinel frame held by the fake network core. */
+typedef struct
+{
+    uint8_t data[TEST_FRAME_SIZE];
+    size_t  len;
+} test_frame_t;
+
+static uint32_t m_failures;
+
+static uint32_t m_crit_sect_depth;
+static uint32_t m_ser_errors;
+
+static bool                            m_notifier_locked;
+static bool                            m_notified;
+static spinel_prop_key_t               m_awaited_property;
+static nrf_802154_spinel_notify_buff_t m_notify_buff;
+static uint32_t                        m_unexpected_responses;
+
+static bool         m_net_legacy;       ///< If the fake network core does not echo TIDs.
+static uint32_t     m_net_fail_request; ///< Number of the request that fails, zero for none.
+static uint32_t     m_net_requests;     ///< Requests received by the fake network core.
+static uint32_t     m_net_unsupported;  ///< Requests the fake network core could not decode.
+static uint32_t     m_net_bulk_requests;
+static uint32_t     m_round_trips;
+static test_frame_t m_net_queue[TEST_QUEUE_SIZE];
+static size_t       m_net_queue_len;
+static bool         m_reenter_on_notify;
+static int32_t      m_reenter_result;
+
+static void net_responses_deliver(void);
+
+/***************************************************************************************************
+ * @section Platform replacements
+ **************************************************************************************************/
+
+void nrf_802154_serialization_crit_sect_enter(uint32_t * p_critical_section)
+{
+    *p_critical_section = m_crit_sect_depth++;
+}
+
+void nrf_802154_serialization_crit_sect_exit(uint32_t critical_section)
+{
+    m_crit_sect_depth = critical_section;
+}
+
+void nrf_802154_serialization_error(const nrf_802154_ser_err_data_t * p_err)
+{
+    printf("  serialization error %d\n", (int)p_err->reason);
+    m_ser_errors++;
+}
+
+void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
+                                      void                          * p_memory,
+                                      size_t                          memsize)
+{
+    (void)p_obj;
+    (void)p_memory;
+    (void)memsize;
+}
+
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj)
+{
+    (void)p_obj;
+    return NULL;
+}
+
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj, void * p_buffer)
+{
+    (void)p_obj;
+    (void)p_buffer;
+}
+
+nrf_802154_ser_err_t nrf_802154_backend_init(void)
+{
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+void nrf_802154_spinel_response_notifier_init(void)
+{
+    m_notifier_locked = false;
+    m_notified        = false;
+}
+
+void nrf_802154_spinel_response_notifier_lock_before_request(spinel_prop_key_t property)
+{
+    CHECK(!m_notifier_locked);
+
+    m_notifier_locked  = true;
+    m_notified         = false;
+    m_awaited_property = property;
+}
+
+nrf_802154_spinel_notify_buff_t * nrf_802154_spinel_response_notifier_property_await(
+    uint32_t timeout)
+{
+    (void)timeout;
+
+    // The application core waits, so the responses held by the network core arrive.
+    if (m_net_queue_len > 0U)
+    {
+        net_responses_deliver();
+    }
+
+    if (!m_notified)
+    {
+        m_notifier_locked = false;
+        return NULL;
+    }
+
+    return &m_notify_buff;
+}
+
+void nrf_802154_spinel_response_notifier_free(nrf_802154_spinel_notify_buff_t * p_notify)
+{
+    CHECK(p_notify == &m_notify_buff);
+
+    m_notifier_locked = false;
+    m_notified        = false;
+}
+
+void nrf_802154_spinel_response_notifier_property_notify(spinel_prop_key_t property,
+                                                         const void      * p_data,
+                                                         size_t            data_len)
+{
+    /* Spinel unpacks the length of DATA fields as unsigned int, which only matches the width
+     * of the decoder's size_t on a 32-bit target. Drop the bits the host leaves unset. */
+    data_len = (uint32_t)data_len;
+
+    if (m_reenter_on_notify)
+    {
+        uint8_t frame[8];
+
+        frame[0] = SPINEL_HEADER_FLAG;
+        frame[1] = SPINEL_CMD_NOOP;
+
+        m_reenter_on_notify = false;
+        m_reenter_result    = nrf_802154_spinel_decode_cmd(frame, 2U);
+    }
+
+    if (!m_notifier_locked || m_notified || (property != m_awaited_property) ||
+        (data_len > sizeof(m_notify_buff.data)))
+    {
+        printf("  unexpected response: property %u\n", (unsigned)property);
+        m_unexpected_responses++;
+        return;
+    }
+
+    memcpy(m_notify_buff.data, p_data, data_len);
+    m_notify_buff.data_len = data_len;
+    m_notified             = true;
+}
+
+/***************************************************************************************************
+ * @section Fake network core
+ **************************************************************************************************/
+
+static void net_response_queue(uint8_t tid, spinel_prop_key_t property, const char * p_fmt, ...)
+{
+    test_frame_t * p_frame;
+    spinel_ssize_t siz;
+    va_list        args;
+
+    if (m_net_queue_len >= TEST_QUEUE_SIZE)
+    {
+        CHECK(false);
+        return;
+    }
+
+    p_frame = &m_net_queue[m_net_queue_len++];
+
+    p_frame->data[0] = (uint8_t)(SPINEL_HEADER_FLAG | (tid << SPINEL_HEADER_TID_SHIFT));
+
+    siz = spinel_datatype_pack(&p_frame->data[1],
+                               sizeof(p_frame->data) - 1U,
+                               SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S,
+                               SPINEL_CMD_PROP_VALUE_IS,
+                               property);
+    CHECK(siz > 0);
+    p_frame->len = 1U + (size_t)siz;
+
+    va_start(args, p_fmt);
+    siz = spinel_datatype_vpack(&p_frame->data[p_frame->len],
+                                sizeof(p_frame->data) - p_frame->len,
+                                p_fmt,
+                                args);
+    va_end(args);
+
+    CHECK(siz >= 0);
+    p_frame->len += (size_t)siz;
+}
+
+static void net_responses_deliver(void)
+{
+    test_frame_t frames[TEST_QUEUE_SIZE];
+    size_t       count = m_net_queue_len;
+
+    // Responses may cause new requests, so the queue is emptied first.
+    memcpy(frames, m_net_queue, count * sizeof(frames[0]));
+    m_net_queue_len = 0U;
+    m_round_trips++;
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        nrf_802154_spinel_encoded_packet_received(frames[i].data, frames[i].len);
+    }
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data, size_t data_len)
+{
+    const uint8_t   * p_frame = (const uint8_t *)p_data;
+    uint8_t           tid     = SPINEL_HEADER_GET_TID(p_frame[0]);
+    uint8_t           response_tid;
+    unsigned int      cmd;
+    spinel_prop_key_t property = 0U;
+    const uint8_t   * p_prop_data;
+    size_t            prop_data_len = 0U;
+    bool              ok;
+    spinel_ssize_t    siz;
+
+    m_net_requests++;
+    ok           = (m_net_requests != m_net_fail_request);
+    response_tid = m_net_legacy ? 0U : tid;
+
+    siz = spinel_datatype_unpack(&p_frame[1], data_len - 1U, SPINEL_DATATYPE_UINT_PACKED_S, &cmd);
+    CHECK(siz > 0);
+
+    if (cmd == SPINEL_CMD_PROP_VALUE_SET)
+    {
+        siz = spinel_datatype_unpack(&p_frame[1],
+                                     data_len - 1U,
+                                     SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S
+                                     SPINEL_DATATYPE_DATA_S,
+                                     &cmd,
+                                     &property,
+                                     &p_prop_data,
+                                     &prop_data_len);
+        CHECK(siz > 0);
+    }
+
+    if ((cmd == SPINEL_CMD_NOOP) && !m_net_legacy)
+    {
+        net_response_queue(response_tid,
+                           SPINEL_PROP_LAST_STATUS,
+                           SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS,
+                           SPINEL_STATUS_OK);
+    }
+    else if (cmd != SPINEL_CMD_PROP_VALUE_SET)
+    {
+        m_net_unsupported++;
+    }
+    else
+    {
+        switch (property)
+        {
+            case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
+                net_response_queue(response_tid, property, SPINEL_DATATYPE_UINT8_S, 11U);
+                break;
+
+            case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
+                net_response_queue(response_tid, property, SPINEL_DATATYPE_BOOL_S, ok);
+                break;
+
+            case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET:
+                if (m_net_legacy)
+                {
+                    m_net_unsupported++;
+                }
+                else
+                {
+                    // The first octet is the extended flag, followed by the addresses.
+                    m_net_bulk_requests++;
+                    net_response_queue(response_tid,
+                                       property,
+                                       SPINEL_DATATYPE_UINT8_S,
+                                       (uint8_t)((prop_data_len - 1U) / EXTENDED_ADDRESS_SIZE));
+                }
+                break;
+
+            default:
+                net_response_queue(response_tid,
+                                   SPINEL_PROP_LAST_STATUS,
+                                   SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS,
+                                   ok ? SPINEL_STATUS_OK : SPINEL_STATUS_FAILURE);
+                break;
+        }
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static bool setters_call(void)
+{
+    bool    ok = true;
+    uint8_t pan_id[PAN_ID_SIZE];
+    uint8_t addr[EXTENDED_ADDRESS_SIZE];
+
+    for (uint32_t i = 0U; i < TEST_SETTERS; i++)
+    {
+        memset(addr, (int)i, sizeof(addr));
+        pan_id[0] = (uint8_t)i;
+        pan_id[1] = 0xabU;
+
+        switch (i % 3U)
+        {
+            case 0U:
+                nrf_802154_pan_id_set(pan_id);
+                break;
+
+            case 1U:
+                nrf_802154_short_address_set(addr);
+                break;
+
+            default:
+                ok &= nrf_802154_pending_bit_for_addr_set(addr, true);
+                break;
+        }
+    }
+
+    return ok;
+}
+
+static void bulk_call(void)
+{
+    uint8_t addrs[TEST_BULK_ADDRS * EXTENDED_ADDRESS_SIZE];
+    uint8_t added;
+
+    for (size_t i = 0U; i < sizeof(addrs); i++)
+    {
+        addrs[i] = (uint8_t)i;
+    }
+
+    m_round_trips = 0U;
+    added         = nrf_802154_serialization_pending_bit_for_addrs_set(addrs,
+                                                                       TEST_BULK_ADDRS,
+                                                                       true);
+
+    CHECK(added == TEST_BULK_ADDRS);
+}
+
+static void pipelined_scenario(void)
+{
+    bool started;
+    bool result;
+
+    started = nrf_802154_serialization_pipeline_begin();
+    CHECK(started);
+    CHECK(m_round_trips == 1U); // The probe request.
+
+    m_round_trips = 0U;
+    CHECK(setters_call());
+    result = nrf_802154_serialization_pipeline_end();
+    CHECK(result);
+    printf("  %u pipelined setters: %u round trips\n",
+           (unsigned)TEST_SETTERS, (unsigned)m_round_trips);
+    CHECK(m_round_trips == (TEST_SETTERS + NRF_802154_SPINEL_PIPELINE_DEPTH - 1U) /
+          NRF_802154_SPINEL_PIPELINE_DEPTH);
+
+    bulk_call();
+    printf("  pending bit for %u extended addresses: %u round trips\n",
+           (unsigned)TEST_BULK_ADDRS, (unsigned)m_round_trips);
+    CHECK(m_net_bulk_requests == m_round_trips);
+    CHECK(m_round_trips < TEST_BULK_ADDRS / 8U);
+}
+
+static void failure_scenario(void)
+{
+    bool started;
+
+    started = nrf_802154_serialization_pipeline_begin();
+    CHECK(started);
+
+    // The probe is the first request.
+    m_net_fail_request = m_net_requests + 7U;
+
+    CHECK(setters_call());
+    CHECK(!nrf_802154_serialization_pipeline_end());
+
+    // The result of a pipeline does not affect the next one.
+    m_net_fail_request = 0U;
+    started            = nrf_802154_serialization_pipeline_begin();
+    CHECK(started);
+    CHECK(setters_call());
+    CHECK(nrf_802154_serialization_pipeline_end());
+}
+
+static void legacy_scenario(void)
+{
+    bool started;
+
+    m_net_legacy = true;
+
+    started = nrf_802154_serialization_pipeline_begin();
+    CHECK(!started);
+
+    // Each setter waits for its response.
+    m_round_trips = 0U;
+    CHECK(setters_call());
+    printf("  %u synchronous setters: %u round trips\n",
+           (unsigned)TEST_SETTERS, (unsigned)m_round_trips);
+    CHECK(m_round_trips == TEST_SETTERS);
+
+    // The network core is probed only once.
+    started = nrf_802154_serialization_pipeline_begin();
+    CHECK(!started);
+
+    bulk_call();
+    CHECK(m_round_trips == TEST_BULK_ADDRS);
+    CHECK(m_net_unsupported == 0U);
+}
+
+static void nested_scenario(void)
+{
+    CHECK(nrf_802154_serialization_pipeline_begin());
+    CHECK(!nrf_802154_serialization_pipeline_begin());
+    CHECK(setters_call());
+    CHECK(nrf_802154_serialization_pipeline_end());
+}
+
+static void reentry_scenario(void)
+{
+    m_reenter_on_notify = true;
+    m_reenter_result    = NRF_802154_SERIALIZATION_ERROR_OK;
+
+    (void)nrf_802154_channel_get();
+
+    CHECK(m_reenter_result == NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE);
+    CHECK(m_net_requests == 1U);
+}
+
+static bool scenario_run(const char * p_name, void (* p_scenario)(void))
+{
+    pid_t pid;
+    int   status = 1;
+
+    printf("%s\n", p_name);
+    fflush(stdout);
+
+    pid = fork();
+
+    if (pid == 0)
+    {
+        p_scenario();
+
+        CHECK(m_unexpected_responses == 0U);
+        CHECK(m_ser_errors == 0U);
+        CHECK(m_crit_sect_depth == 0U);
+
+        fflush(stdout);
+        _exit((m_failures == 0U) ? 0 : 1);
+    }
+
+    if ((pid < 0) || (waitpid(pid, &status, 0) != pid))
+    {
+        return false;
+    }
+
+    printf("  %s\n", (WIFEXITED(status) && (WEXITSTATUS(status) == 0)) ? "OK" : "FAIL");
+
+    return WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    ok &= scenario_run("network core echoing TIDs", pipelined_scenario);
+    ok &= scenario_run("failed pipelined request", failure_scenario);
+    ok &= scenario_run("network core responding with TID zero", legacy_scenario);
+    ok &= scenario_run("pipeline started twice", nested_scenario);
+    ok &= scenario_run("frame passed during dispatch", reentry_scenario);
+
+    return ok ? 0 : 1;
+}
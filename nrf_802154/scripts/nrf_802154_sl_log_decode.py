@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Decode the debug log of the nRF 802.15.4 Radio Driver.
+
+The input is a binary dump of the g_nrf_802154_sl_log_buffer variable and the value of the
+gp_nrf_802154_sl_log_ptr variable, for example obtained with gdb:
+
+    dump binary value log.bin g_nrf_802154_sl_log_buffer
+    print gp_nrf_802154_sl_log_ptr
+
+The script prints the records of the log, oldest first, or the number of records of each
+module and event with the --summary option. The address of a function entered or exited is
+printed as its 20 least significant bits, which can be resolved with addr2line.
+
+The records must be written in the format of nrf_802154_sl_log.h, with the lap parity in bit 31
+and gp_nrf_802154_sl_log_ptr counting all records. The prebuilt service layer library writes no
+records, but a service layer library built with the debug log enabled and an earlier version of
+the header writes them in another format, which this script does not decode.
+"""
+
+import argparse
+import collections
+import struct
+import sys
+
+TYPE_FUNCTION_ENTER = 1
+TYPE_FUNCTION_EXIT = 2
+TYPE_LOCAL_EVENT = 3
+TYPE_GLOBAL_EVENT = 4
+
+TYPES = {
+    TYPE_FUNCTION_ENTER: 'enter',
+    TYPE_FUNCTION_EXIT: 'exit',
+    TYPE_LOCAL_EVENT: 'local',
+    TYPE_GLOBAL_EVENT: 'global',
+}
+
+# Must match nrf_802154_drv_modules_list_t in nrf_802154_debug_log_codes.h
+MODULES = {
+    1: 'APPLICATION',
+    2: 'CORE',
+    3: 'CRITICAL_SECTION',
+    4: 'TRX',
+    5: 'CSMACA',
+    6: 'DELAYED_TRX',
+    7: 'ACK_TIMEOUT',
+    8: 'TRX_PPI',
+    9: 'NOTIFICATION',
+    10: 'CO',
+    11: 'IMM_TX',
+}
+
+# Must match nrf_802154_drv_global_events_list_t in nrf_802154_debug_log_codes.h
+GLOBAL_EVENTS = {
+    1: 'RADIO_RESET',
+    16: 'STAGE_BCMATCH',
+    17: 'STAGE_FILTER',
+    18: 'STAGE_ACK_GEN_START',
+    19: 'STAGE_ACK_GEN_END',
+    20: 'STAGE_RX_END',
+    21: 'STAGE_CCA',
+    22: 'STAGE_TX_START',
+    23: 'STAGE_TX_END',
+    24: 'STAGE_NTF_ENQUEUE',
+    25: 'STAGE_NTF_DELIVER',
+}
+
+
+def records_read(data, head):
+    """Return the valid records of the log as (index, word) tuples, oldest first."""
+    length = len(data) // 4
+
+    if length == 0 or length & (length - 1):
+        sys.exit(f'Dump of {len(data)} bytes is not a log buffer with a power of 2 length')
+
+    words = struct.unpack_from(f'<{length}I', data)
+    records = []
+    skipped = 0
+
+    for index in range(max(0, head - length), head):
+        word = words[index % length]
+
+        # A slot reserved, but not written yet when the dump was taken, has the lap parity
+        # of the previous lap, or is empty in the first lap.
+        if word >> 31 != (index // length) & 1 or (word >> 28) & 0x7 not in TYPES:
+            skipped += 1
+            continue
+
+        records.append((index, word))
+
+    return records, skipped
+
+
+def module_name(module_id):
+    return MODULES.get(module_id, f'module {module_id}')
+
+
+def record_kind(word):
+    """Return the description of a record without its parameter or function address."""
+    record_type = (word >> 28) & 0x7
+    module_id = (word >> 22) & 0x3f
+    event_id = (word >> 16) & 0x3f
+    kind = f'{module_name(module_id)} {TYPES[record_type]}'
+
+    if record_type == TYPE_GLOBAL_EVENT:
+        kind += ' ' + GLOBAL_EVENTS.get(event_id, f'event {event_id}')
+    elif record_type == TYPE_LOCAL_EVENT:
+        kind += f' event {event_id}'
+
+    return kind
+
+
+def record_format(word):
+    """Return the description of a record."""
+    if (word >> 28) & 0x7 in (TYPE_FUNCTION_ENTER, TYPE_FUNCTION_EXIT):
+        return f'{record_kind(word)} 0x{word & 0xfffff:05x}'
+
+    return f'{record_kind(word)} param {word & 0xffff}'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dump', type=argparse.FileType('rb'),
+                        help='binary dump of the g_nrf_802154_sl_log_buffer variable')
+    parser.add_argument('head', type=lambda value: int(value, 0),
+                        help='value of the gp_nrf_802154_sl_log_ptr variable')
+    parser.add_argument('--summary', action='store_true',
+                        help='print the number of records of each module and event')
+    args = parser.parse_args()
+
+    records, skipped = records_read(args.dump.read(), args.head)
+
+    print(f'{len(records)} records, {skipped} incomplete records skipped\n')
+
+    if args.summary:
+        counts = collections.Counter(record_kind(word) for _, word in records)
+
+        for name, count in counts.most_common():
+            print(f'{count:>7} {name}')
+    else:
+        for index, word in records:
+            print(f'{index:>10} {record_format(word)}')
+
+
+if __name__ == '__main__':
+    main()
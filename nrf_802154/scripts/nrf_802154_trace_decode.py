@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Decode the trace ring of the nRF 802.15.4 Radio Driver.
+
+The input is a binary dump of the g_nrf_802154_trace variable, for example obtained with gdb:
+
+    dump binary value trace.bin g_nrf_802154_trace
+
+The script prints a latency histogram for each pair of consecutive stage transitions and
+for the notifications waiting in the notification queue.
+"""
+
+import argparse
+import collections
+import struct
+import sys
+
+TRACE_MAGIC = 0x54353134
+HEADER_FORMAT = '<III'
+ENTRY_FORMAT = '<II'
+
+# Must match nrf_802154_drv_global_events_list_t in nrf_802154_debug_log_codes.h
+STAGES = {
+    16: 'BCMATCH',
+    17: 'FILTER',
+    18: 'ACK_GEN_START',
+    19: 'ACK_GEN_END',
+    20: 'RX_END',
+    21: 'CCA',
+    22: 'TX_START',
+    23: 'TX_END',
+    24: 'NTF_ENQUEUE',
+    25: 'NTF_DELIVER',
+}
+
+
+def entries_read(data):
+    """Return the valid entries of the ring as (timestamp, stage, param) tuples, oldest first."""
+    magic, length, head = struct.unpack_from(HEADER_FORMAT, data, 0)
+
+    if magic != TRACE_MAGIC:
+        sys.exit(f'Invalid magic 0x{magic:08x}, expected 0x{TRACE_MAGIC:08x}')
+
+    entries_offset = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+
+    if len(data) < entries_offset + length * entry_size:
+        sys.exit(f'Dump too short for {length} entries')
+
+    entries = []
+    skipped = 0
+
+    for index in range(max(0, head - length), head):
+        timestamp, word = struct.unpack_from(ENTRY_FORMAT, data,
+                                             entries_offset + (index % length) * entry_size)
+        lap = word >> 24
+        stage = (word >> 16) & 0xff
+        param = word & 0xffff
+
+        # An entry reserved, but not written yet when the dump was taken, has an older lap.
+        if lap != (index // length) & 0xff or stage not in STAGES:
+            skipped += 1
+            continue
+
+        entries.append((timestamp, stage, param))
+
+    return entries, skipped
+
+
+def delta_us(start, end):
+    """Return the difference between two 32-bit timestamps."""
+    delta = (end - start) & 0xffffffff
+    return delta - (1 << 32) if delta & 0x80000000 else delta
+
+
+def histogram_print(name, samples):
+    samples = sorted(samples)
+    buckets = collections.Counter()
+
+    for sample in samples:
+        buckets[max(sample, 0).bit_length()] += 1
+
+    print(f'{name}: {len(samples)} samples, min {samples[0]} us, '
+          f'median {samples[len(samples) // 2]} us, max {samples[-1]} us')
+
+    peak = max(buckets.values())
+
+    for bucket in sorted(buckets):
+        low = 0 if bucket == 0 else 1 << (bucket - 1)
+        high = 1 << bucket
+        bar = '#' * max(1, buckets[bucket] * 40 // peak)
+        print(f'  [{low:>7} .. {high:>7}) us {buckets[bucket]:>7} {bar}')
+
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dump', type=argparse.FileType('rb'),
+                        help='binary dump of the g_nrf_802154_trace variable')
+    args = parser.parse_args()
+
+    entries, skipped = entries_read(args.dump.read())
+
+    print(f'{len(entries)} entries, {skipped} incomplete entries skipped\n')
+
+    latencies = collections.defaultdict(list)
+    queued = collections.defaultdict(collections.deque)
+
+    for previous, current in zip(entries, entries[1:]):
+        name = f'{STAGES[previous[1]]} -> {STAGES[current[1]]}'
+        latencies[name].append(delta_us(previous[0], current[0]))
+
+    # The notifications are delivered in the order they were enqueued. The parameter of both
+    # stages is the type of the notification, so a notification enqueued before the oldest
+    # entry of the ring is not matched with a newer one of a different type.
+    for timestamp, stage, param in entries:
+        if STAGES[stage] == 'NTF_ENQUEUE':
+            queued[param].append(timestamp)
+        elif STAGES[stage] == 'NTF_DELIVER' and queued[param]:
+            latencies['NTF_ENQUEUE => NTF_DELIVER (queued)'].append(
+                delta_us(queued[param].popleft(), timestamp))
+
+    for name in sorted(latencies):
+        histogram_print(name, latencies[name])
+
+
+if __name__ == '__main__':
+    main()
@@ -51,6 +51,8 @@ extern "C" {
 /**
  * @brief Notifies that spinel frame was received over spinel backend.
  *
+ * The backend shall call this function from a single context at a time.
+ *
  * @param[in]  p_data    Pointer to a buffer that contains received frame.
  * @param[in]  data_len  Size of the @ref p_data buffer.
  *
@@ -42,6 +42,9 @@
 #ifndef NRF_802154_SERIALIZATION_H_
 #define NRF_802154_SERIALIZATION_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,6 +55,74 @@ extern "C" {
  */
 void nrf_802154_serialization_init(void);
 
+/**
+ * @brief Starts pipelining of requests sent to the core with the 802.15.4 radio driver.
+ *
+ * Until @ref nrf_802154_serialization_pipeline_end is called, the following functions send
+ * their requests without waiting for the responses:
+ * - nrf_802154_pan_id_set
+ * - nrf_802154_short_address_set
+ * - nrf_802154_alternate_short_address_set
+ * - nrf_802154_extended_address_set
+ * - nrf_802154_pan_coord_set
+ * - nrf_802154_promiscuous_set
+ * - nrf_802154_rx_on_when_idle_set
+ * - nrf_802154_src_addr_matching_method_set
+ * - nrf_802154_auto_pending_bit_set
+ * - nrf_802154_ack_data_set
+ * - nrf_802154_ack_data_clear
+ * - nrf_802154_ack_data_remove_all
+ * - nrf_802154_pending_bit_for_addr_set
+ * - nrf_802154_pending_bit_for_addr_clear
+ * - nrf_802154_pending_bit_for_addr_reset
+ *
+ * The functions that return a result return true. Failures are reported by
+ * @ref nrf_802154_serialization_pipeline_end. When 15 requests await a response, the next
+ * request waits for all of them. Other functions wait for their responses as usual.
+ *
+ * The first call checks if the core with the 802.15.4 radio driver supports pipelined
+ * requests. A core built before pipelined requests were added does not, and the requests
+ * then wait for their responses as if this function was not called.
+ *
+ * @note While requests are pipelined, the functions listed above send pipelined requests
+ *       regardless of the thread that calls them.
+ *
+ * @retval true   Requests are pipelined. @ref nrf_802154_serialization_pipeline_end shall be
+ *                called to stop pipelining.
+ * @retval false  Requests are not pipelined, because requests are already pipelined by another
+ *                caller or the core with the 802.15.4 radio driver does not support pipelined
+ *                requests. @ref nrf_802154_serialization_pipeline_end shall not be called.
+ */
+bool nrf_802154_serialization_pipeline_begin(void);
+
+/**
+ * @brief Waits for the responses to pipelined requests and stops pipelining of requests.
+ *
+ * @retval true   All requests pipelined since @ref nrf_802154_serialization_pipeline_begin
+ *                succeeded.
+ * @retval false  At least one pipelined request failed.
+ */
+bool nrf_802154_serialization_pipeline_end(void);
+
+/**
+ * @brief Adds multiple addresses to the list of addresses for which the pending bit is set.
+ *
+ * This function has the same effect as calling nrf_802154_pending_bit_for_addr_set for each
+ * address, but it sends many addresses in a single request. If the core with the 802.15.4
+ * radio driver does not support pipelined requests, it does not support this request either,
+ * and nrf_802154_pending_bit_for_addr_set is called for each address instead.
+ *
+ * @param[in]  p_addrs     Pointer to concatenated addresses in little-endian byte order.
+ * @param[in]  addr_count  Number of addresses.
+ * @param[in]  extended    If the addresses are extended (true) or short (false).
+ *
+ * @returns  Number of added addresses. The addresses are added in order and adding stops
+ *           at the first address that cannot be added.
+ */
+uint8_t nrf_802154_serialization_pending_bit_for_addrs_set(const uint8_t * p_addrs,
+                                                           uint8_t         addr_count,
+                                                           bool            extended);
+
 #ifdef __cplusplus
 }
 #endif
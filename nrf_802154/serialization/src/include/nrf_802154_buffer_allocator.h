@@ -51,26 +51,29 @@
  */
 #define NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN 128
 
+/**@brief Calculates number of 32-bit words of the bitmap of free buffers. */
+#define NRF_802154_BUFFER_ALLOCATOR_FREE_MASK_WORDS(capacity) \
+    (((capacity) + 31U) / 32U)
+
 /**@brief Calculates byte size of memory required to store a buffer allocator.
  *
  * Example:
  * @code
- * static uint8_t m_memory[NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(10)];
+ * static uint8_t m_memory[NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(10)] __ALIGN(4);
  * static nrf_802154_buffer_allocator_t m_buffer_allocator;
  *
  * nrf_802154_buffer_allocator_init(&m_buffer_allocator, m_memory, sizeof(m_memory));
  * @endcode
  */
 #define NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(capacity) \
-    ((capacity) * (sizeof(nrf_802154_buffer_t)))
+    (((capacity) * (sizeof(nrf_802154_buffer_t))) +  \
+     (NRF_802154_BUFFER_ALLOCATOR_FREE_MASK_WORDS(capacity) * sizeof(uint32_t)))
 
 /** @brief Structure representing a buffer. */
 typedef struct
 {
     /** @brief Stored data. */
-    uint8_t       data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
-    /** @brief Flag indicating if a buffer is currently in use. */
-    volatile bool taken;
+    uint8_t data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
 } nrf_802154_buffer_t;
 
 /** @brief Structure representing a buffer allocator. */
@@ -79,7 +82,13 @@ typedef struct
     /** @brief Pointer to a memory used to store buffers. */
     void * p_memory;
     /** @brief Maximum number of buffers the buffer allocator instance is able to store. */
-    size_t capacity;
+    size_t              capacity;
+    /** @brief Bitmap of free buffers, stored in the memory behind the buffers. */
+    volatile uint32_t * p_free_mask;
+    /** @brief Number of buffers currently in use. */
+    volatile uint32_t   count;
+    /** @brief Maximum number of buffers that were in use at the same time. */
+    volatile uint32_t   high_water;
 } nrf_802154_buffer_allocator_t;
 
 /**
@@ -92,6 +101,8 @@ typedef struct
  *                      Memory pointed by this pointer should persist as long as
  *                      the buffer allocator pointed by @p p_obj is in use.
  *                      Cannot be NULL (with exception, when memsize is 0)
+ *                      Must be aligned to 4 bytes, as the bitmap of free buffers
+ *                      stored in it is accessed with exclusive word operations.
  * @param[in] memsize   Size of the memory pointed by @p p_memory. When defining
  *                      storage you can use @ref NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE
  *                      helper macro.
@@ -103,11 +114,14 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
 /**
  * @brief Allocates buffer for 802.15.4 reception or transmission.
  *
+ * The buffer is allocated in constant time with exclusive load and store instructions,
+ * without entering a critical section. The function can be called from any context.
+ *
  * @param[in] p_obj  Pointer to a buffer allocator that stores the buffer pool to allocate from.
  *
  * @return Pointer to allocated buffer or NULL if no buffer could be allocated.
  */
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj);
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj);
 
 /**
  * @brief Frees buffer allocated for 802.15.4 reception or transmission.
@@ -117,7 +131,7 @@ void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p
  *
  * @note This function should be used complementary to @ref nrf_802154_buffer_allocator_alloc.
  */
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
 
 /**
  * @brief Gets total number of buffers a buffer allocator can store.
@@ -132,4 +146,40 @@ static inline size_t nrf_802154_buffer_allocator_capacity(
     return p_obj->capacity;
 }
 
+/**
+ * @brief Gets number of buffers currently allocated from a buffer allocator.
+ *
+ * @param[in] p_obj  Pointer to a buffer allocator to check.
+ *
+ * @return  Number of buffers currently allocated.
+ */
+static inline size_t nrf_802154_buffer_allocator_count(
+    const nrf_802154_buffer_allocator_t * p_obj)
+{
+    return p_obj->count;
+}
+
+/**
+ * @brief Gets maximum number of buffers that were allocated at the same time.
+ *
+ * The value can be used to size the buffer pool from measured data.
+ *
+ * @param[in] p_obj  Pointer to a buffer allocator to check.
+ *
+ * @return  Maximum number of buffers allocated at the same time since the initialization
+ *          or since the last call to @ref nrf_802154_buffer_allocator_high_water_reset.
+ */
+static inline size_t nrf_802154_buffer_allocator_high_water(
+    const nrf_802154_buffer_allocator_t * p_obj)
+{
+    return p_obj->high_water;
+}
+
+/**
+ * @brief Resets the high-water mark of a buffer allocator to the number of buffers in use.
+ *
+ * @param[in] p_obj  Pointer to a buffer allocator to reset.
+ */
+void nrf_802154_buffer_allocator_high_water_reset(nrf_802154_buffer_allocator_t * p_obj);
+
 #endif // NRF_802154_BUFFER_ALLOCATOR_H__
@@ -83,6 +83,17 @@ extern "C" {
  */
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...);
 
+/**
+ * @brief Sends an already packed spinel frame over spinel backend.
+ *
+ * @param[in]  p_frame    Pointer to a buffer that contains the spinel frame.
+ * @param[in]  frame_len  Length of the spinel frame.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_packed_send(const void * p_frame, size_t frame_len);
+
 /**
  * @brief Gets buffer manager for transactions originated by the remote serialization peer.
  *
@@ -488,6 +488,12 @@ typedef enum
      */
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ALTERNATE_SHORT_ADDRESS_SET =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 70,
+
+    /**
+     * Vendor property for nrf_802154_serialization_pending_bit_for_addrs_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 71,
 } spinel_prop_vendor_key_t;
 
 /**
@@ -1089,6 +1095,21 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_serialization_pending_bit_for_addrs_set.
+ *
+ * The data contains concatenated addresses of the same type.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDRS_SET \
+    SPINEL_DATATYPE_BOOL_S /* Extended flag */               \
+    SPINEL_DATATYPE_DATA_S /* Addresses */
+
+/**
+ * @brief Spinel data type description for nrf_802154_serialization_pending_bit_for_addrs_set
+ *        return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDRS_SET_RET SPINEL_DATATYPE_UINT8_S
+
 /**
  * @brief Spinel data type description for nrf_802154_pending_bit_for_addr_reset.
  */
@@ -44,6 +44,7 @@
 
 #include <stddef.h>
 
+#include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
 
 #ifdef __cplusplus
@@ -53,6 +54,9 @@ extern "C" {
 /**
  * @brief Decode and dispatch spinel command.
  *
+ * Frames shall be passed one at a time. A frame passed while another one is dispatched is
+ * dropped and @ref NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE is returned.
+ *
  * @param[in]  p_packet_data    Pointer to a buffer that contains spinel packet to be decoded.
  * @param[in]  packet_data_len  Size of the @ref p_packet_data buffer.
  *
@@ -62,6 +66,19 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len);
 
+/**
+ * @brief Gets the TID of the spinel frame that is being dispatched.
+ *
+ * The TID is taken from the header of the frame passed to @ref nrf_802154_spinel_decode_cmd.
+ * Zero means that the frame does not belong to a pipelined request.
+ *
+ * @note The returned value is valid only within @ref nrf_802154_spinel_dispatch_cmd. Outside
+ *       of it, zero is returned.
+ *
+ * @returns  TID of the spinel frame.
+ */
+spinel_tid_t nrf_802154_spinel_rx_tid_get(void);
+
 /**
  * @brief Dispatches spinel command.
  *
@@ -66,6 +66,25 @@ extern "C" {
                            cmd,                             \
                            __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command with a TID.
+ *
+ * @param[in]  tid    Spinel TID to be put in the frame header. Zero if the frame does not
+ *                    belong to a pipelined request.
+ * @param[in]  cmd    Spinel command to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd_with_tid(tid, cmd, p_fmt, ...)                 \
+    nrf_802154_spinel_send(SPINEL_DATATYPE_COMMAND_S p_fmt,                        \
+                           SPINEL_HEADER_FLAG | ((tid) << SPINEL_HEADER_TID_SHIFT), \
+                           cmd,                                                    \
+                           __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 #define NRF_802154_SPINEL_ENC_NET_H_
 
 #include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc.h"
 #include "nrf_802154_spinel_datatypes.h"
 
@@ -58,10 +59,10 @@ extern "C" {
  * @returns  number of bytes sent or negative error value on failure.
  *
  */
-#define nrf_802154_spinel_send_prop_last_status_is(status)                            \
-    nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_LAST_STATUS,                 \
-                                             SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS, \
-                                             status)
+#define nrf_802154_spinel_send_prop_last_status_is(status)                                 \
+    nrf_802154_spinel_send_response_prop_value_is(SPINEL_PROP_LAST_STATUS,                 \
+                                                  SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS, \
+                                                  status)
 
 /**
  * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS.
@@ -80,6 +81,29 @@ extern "C" {
                                prop,                                \
                                __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS as a response to a request.
+ *
+ * The response carries the TID of the request that is being dispatched, so that responses
+ * to pipelined requests can be matched with their requests.
+ *
+ * @note This macro shall be used only while a request is dispatched.
+ *
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_response_prop_value_is(prop, p_fmt, ...)          \
+    nrf_802154_spinel_send_cmd_with_tid(nrf_802154_spinel_rx_tid_get(),          \
+                                        SPINEL_CMD_PROP_VALUE_IS,                \
+                                        SPINEL_DATATYPE_UINT_PACKED_S p_fmt,     \
+                                        prop,                                    \
+                                        __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
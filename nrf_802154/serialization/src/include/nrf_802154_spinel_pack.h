@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_pack
+ * 802.15.4 radio driver spinel serialization specialized packing
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_PACK_H_
+#define NRF_802154_SPINEL_PACK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the length field preceding a struct or a data block that is not the last
+ *        element of a spinel frame.
+ */
+#define NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE sizeof(uint16_t)
+
+/**
+ * @brief Calculates size of an unsigned integer encoded as @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ */
+static inline size_t nrf_802154_spinel_pack_uint_packed_size(uint32_t value)
+{
+    size_t size = 1U;
+
+    while (value >= 0x80U)
+    {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+/**
+ * @brief Encodes an unsigned integer as @ref SPINEL_DATATYPE_UINT_PACKED_S.
+ *
+ * @param[in]  p_out  Pointer to a buffer with at least
+ *                    @ref nrf_802154_spinel_pack_uint_packed_size bytes.
+ * @param[in]  value  Value to encode.
+ *
+ * @returns  Pointer to the first byte after the encoded value.
+ */
+static inline uint8_t * nrf_802154_spinel_pack_uint_packed(uint8_t * p_out, uint32_t value)
+{
+    while (value >= 0x80U)
+    {
+        *p_out++ = (uint8_t)(value | 0x80U);
+        value  >>= 7;
+    }
+
+    *p_out++ = (uint8_t)value;
+
+    return p_out;
+}
+
+/**
+ * @brief Encodes a 16-bit unsigned integer as @ref SPINEL_DATATYPE_UINT16_S.
+ */
+static inline uint8_t * nrf_802154_spinel_pack_uint16(uint8_t * p_out, uint16_t value)
+{
+    *p_out++ = (uint8_t)value;
+    *p_out++ = (uint8_t)(value >> 8);
+
+    return p_out;
+}
+
+/**
+ * @brief Encodes a 32-bit unsigned integer as @ref SPINEL_DATATYPE_UINT32_S.
+ */
+static inline uint8_t * nrf_802154_spinel_pack_uint32(uint8_t * p_out, uint32_t value)
+{
+    p_out = nrf_802154_spinel_pack_uint16(p_out, (uint16_t)value);
+
+    return nrf_802154_spinel_pack_uint16(p_out, (uint16_t)(value >> 16));
+}
+
+/**
+ * @brief Encodes a 64-bit unsigned integer as @ref SPINEL_DATATYPE_UINT64_S.
+ */
+static inline uint8_t * nrf_802154_spinel_pack_uint64(uint8_t * p_out, uint64_t value)
+{
+    p_out = nrf_802154_spinel_pack_uint32(p_out, (uint32_t)value);
+
+    return nrf_802154_spinel_pack_uint32(p_out, (uint32_t)(value >> 32));
+}
+
+/**
+ * @brief Decodes a 16-bit unsigned integer encoded as @ref SPINEL_DATATYPE_UINT16_S.
+ */
+static inline uint16_t nrf_802154_spinel_unpack_uint16(const uint8_t * p_in)
+{
+    return (uint16_t)(p_in[0] | ((uint16_t)p_in[1] << 8));
+}
+
+/**
+ * @brief Decodes a 32-bit unsigned integer encoded as @ref SPINEL_DATATYPE_UINT32_S.
+ */
+static inline uint32_t nrf_802154_spinel_unpack_uint32(const uint8_t * p_in)
+{
+    return nrf_802154_spinel_unpack_uint16(p_in) |
+           ((uint32_t)nrf_802154_spinel_unpack_uint16(p_in + 2) << 16);
+}
+
+/**
+ * @brief Decodes a 64-bit unsigned integer encoded as @ref SPINEL_DATATYPE_UINT64_S.
+ */
+static inline uint64_t nrf_802154_spinel_unpack_uint64(const uint8_t * p_in)
+{
+    return nrf_802154_spinel_unpack_uint32(p_in) |
+           ((uint64_t)nrf_802154_spinel_unpack_uint32(p_in + 4) << 32);
+}
+
+/**
+ * @brief Packs a complete spinel frame with SPINEL_CMD_PROP_VALUE_IS command for
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW property.
+ *
+ * The result is identical to packing the frame with
+ * @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW format string, but the format string
+ * is not interpreted at runtime.
+ *
+ * @param[out] p_buf      Pointer to a buffer for the spinel frame.
+ * @param[in]  buf_size   Size of the buffer pointed by @p p_buf.
+ * @param[in]  handle     Handle of the received frame.
+ * @param[in]  p_data     Pointer to the received frame.
+ * @param[in]  hdata_len  Length of the frame with its handle, as encoded by
+ *                        @ref NRF_802154_HDATA_ENCODE.
+ * @param[in]  power      RSSI of the received frame.
+ * @param[in]  lqi        LQI of the received frame.
+ * @param[in]  time       Timestamp of the received frame.
+ *
+ * @returns  Length of the spinel frame or a negative value if the buffer is too small.
+ */
+spinel_ssize_t nrf_802154_spinel_pack_received_timestamp_raw(uint8_t       * p_buf,
+                                                             size_t          buf_size,
+                                                             uint32_t        handle,
+                                                             const uint8_t * p_data,
+                                                             size_t          hdata_len,
+                                                             int8_t          power,
+                                                             uint8_t         lqi,
+                                                             uint64_t        time);
+
+/**
+ * @brief Unpacks property data of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * The result is identical to unpacking the data with
+ * @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW format string, except that a truncated
+ * frame with its handle is always reported as an error.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ * @param[out] p_handle           Handle of the received frame.
+ * @param[out] pp_data            Pointer to the received frame within @p p_property_data.
+ * @param[out] p_hdata_len        Length of the frame with its handle.
+ * @param[out] p_power            RSSI of the received frame.
+ * @param[out] p_lqi              LQI of the received frame.
+ * @param[out] p_time             Timestamp of the received frame.
+ *
+ * @returns  Number of decoded bytes or a negative value if the data is malformed.
+ */
+spinel_ssize_t nrf_802154_spinel_unpack_received_timestamp_raw(const void   * p_property_data,
+                                                               size_t         property_data_len,
+                                                               uint32_t     * p_handle,
+                                                               const void  ** pp_data,
+                                                               size_t       * p_hdata_len,
+                                                               int8_t       * p_power,
+                                                               uint8_t      * p_lqi,
+                                                               uint64_t     * p_time);
+
+/**
+ * @brief Packs a complete spinel frame with SPINEL_CMD_PROP_VALUE_SET command for
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW property.
+ *
+ * The result is identical to packing the frame with
+ * @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW format string, but the format string
+ * is not interpreted at runtime.
+ *
+ * @param[out] p_buf       Pointer to a buffer for the spinel frame.
+ * @param[in]  buf_size    Size of the buffer pointed by @p p_buf.
+ * @param[in]  p_metadata  Pointer to the transmit metadata.
+ * @param[in]  handle      Handle of the frame to transmit.
+ * @param[in]  p_data      Pointer to the frame to transmit.
+ * @param[in]  hdata_len   Length of the frame with its handle, as encoded by
+ *                         @ref NRF_802154_HDATA_ENCODE.
+ *
+ * @returns  Length of the spinel frame or a negative value if the buffer is too small.
+ */
+spinel_ssize_t nrf_802154_spinel_pack_transmit_raw(
+    uint8_t                              * p_buf,
+    size_t                                 buf_size,
+    const nrf_802154_transmit_metadata_t * p_metadata,
+    uint32_t                               handle,
+    const uint8_t                        * p_data,
+    size_t                                 hdata_len);
+
+/**
+ * @brief Unpacks property data of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW.
+ *
+ * The result is identical to unpacking the data with
+ * @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW format string, except that a truncated
+ * frame with its handle is always reported as an error.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ * @param[out] p_metadata         Transmit metadata.
+ * @param[out] p_handle           Handle of the frame to transmit.
+ * @param[out] pp_data            Pointer to the frame to transmit within @p p_property_data.
+ * @param[out] p_hdata_len        Length of the frame with its handle.
+ *
+ * @returns  Number of decoded bytes or a negative value if the data is malformed.
+ */
+spinel_ssize_t nrf_802154_spinel_unpack_transmit_raw(
+    const void                     * p_property_data,
+    size_t                           property_data_len,
+    nrf_802154_transmit_metadata_t * p_metadata,
+    uint32_t                       * p_handle,
+    const void                    ** pp_data,
+    size_t                         * p_hdata_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_PACK_H_ */
+
+/** @} */
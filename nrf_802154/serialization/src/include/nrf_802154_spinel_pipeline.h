@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @defgroup nrf_802154_spinel_serialization_pipeline
+ * 802.15.4 radio driver spinel serialization request pipeline
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SPINEL_PIPELINE_H_
+#define NRF_802154_SPINEL_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_serialization_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of pipelined requests awaiting a response.
+ *
+ * Each pipelined request awaiting a response has a unique non-zero spinel TID.
+ */
+#define NRF_802154_SPINEL_PIPELINE_DEPTH SPINEL_HEADER_TID_MASK
+
+/**
+ * @brief Support of pipelined requests by the network core.
+ */
+typedef enum
+{
+    NRF_802154_SPINEL_PIPELINE_SUPPORT_UNKNOWN,     ///< The network core was not probed yet.
+    NRF_802154_SPINEL_PIPELINE_SUPPORT_PROBING,     ///< The probe awaits its response.
+    NRF_802154_SPINEL_PIPELINE_SUPPORT_AVAILABLE,   ///< The network core echoes TIDs.
+    NRF_802154_SPINEL_PIPELINE_SUPPORT_UNAVAILABLE, ///< The network core responds with TID zero.
+} nrf_802154_spinel_pipeline_support_t;
+
+/**
+ * @brief Gets the support of pipelined requests by the network core.
+ *
+ * @returns  Support of pipelined requests.
+ */
+nrf_802154_spinel_pipeline_support_t nrf_802154_spinel_pipeline_support_get(void);
+
+/**
+ * @brief Starts probing the support of pipelined requests by the network core.
+ *
+ * The caller shall send a request of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET with
+ * the returned TID and await its response. A network core that supports pipelined requests
+ * echoes the TID in the response. A network core built before pipelined requests were added
+ * ignores the TID of the request and responds with TID zero.
+ *
+ * @returns  TID of the probe request.
+ */
+spinel_tid_t nrf_802154_spinel_pipeline_probe_begin(void);
+
+/**
+ * @brief Ends probing the support of pipelined requests.
+ *
+ * If the response to the probe request was not received, the support remains unknown and
+ * the network core is probed again before the next pipeline.
+ */
+void nrf_802154_spinel_pipeline_probe_end(void);
+
+/**
+ * @brief Starts pipelining of requests.
+ *
+ * @retval true   Requests are pipelined.
+ * @retval false  Requests are already pipelined by another caller, or the network core does
+ *                not support pipelined requests.
+ */
+bool nrf_802154_spinel_pipeline_begin(void);
+
+/**
+ * @brief Stops pipelining of requests.
+ *
+ * Requests that are still awaiting a response are considered failed.
+ *
+ * @returns  true if all requests pipelined since @ref nrf_802154_spinel_pipeline_begin succeeded,
+ *           false otherwise.
+ */
+bool nrf_802154_spinel_pipeline_end(void);
+
+/**
+ * @brief Checks if requests are pipelined.
+ *
+ * @returns  true if requests are pipelined, false otherwise.
+ */
+bool nrf_802154_spinel_pipeline_is_active(void);
+
+/**
+ * @brief Checks if any pipelined request awaits a response.
+ *
+ * @returns  true if any pipelined request awaits a response, false otherwise.
+ */
+bool nrf_802154_spinel_pipeline_is_pending(void);
+
+/**
+ * @brief Allocates a TID for a pipelined request.
+ *
+ * @param[in]  awaited_property  Property of the response to the request.
+ *                               Only SPINEL_PROP_LAST_STATUS and properties
+ *                               with a @c bool response are supported.
+ *
+ * @returns  TID of the request or zero if requests are not pipelined or
+ *           @ref NRF_802154_SPINEL_PIPELINE_DEPTH requests await a response.
+ */
+spinel_tid_t nrf_802154_spinel_pipeline_request_add(spinel_prop_key_t awaited_property);
+
+/**
+ * @brief Marks all pipelined requests that still await a response as failed.
+ *
+ * This function shall be called after a synchronous request, which is processed after
+ * all pipelined requests sent before it, completes.
+ */
+void nrf_802154_spinel_pipeline_flush(void);
+
+/**
+ * @brief Checks if a received response is handled by the pipeline.
+ *
+ * A response with a non-zero TID belongs to a pipelined request. A response to the probe
+ * request of @ref nrf_802154_spinel_pipeline_probe_begin records the support of pipelined
+ * requests, and it is passed to the response notifier like other responses with TID zero.
+ *
+ * @param[in]  tid       TID of the response.
+ * @param[in]  property  Property of the response.
+ *
+ * @returns  true if the response shall be processed by
+ *           @ref nrf_802154_spinel_pipeline_response_process, false otherwise.
+ */
+bool nrf_802154_spinel_pipeline_response_is_handled(spinel_tid_t      tid,
+                                                    spinel_prop_key_t property);
+
+/**
+ * @brief Processes a response to a pipelined request.
+ *
+ * @param[in]  tid                TID of the response.
+ * @param[in]  property           Property of the response.
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_pipeline_response_process(
+    spinel_tid_t      tid,
+    spinel_prop_key_t property,
+    const void      * p_property_data,
+    size_t            property_data_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_PIPELINE_H_ */
+
+/** @} */
@@ -39,72 +39,86 @@
 
 #include "nrf_802154_buffer_allocator.h"
 
-#include "nrf_802154_serialization_crit_sect.h"
-
 #include "nrf_802154_assert.h"
+#include "nrfx.h"
 #include <stdbool.h>
 #include <stdint.h>
 
-static uint8_t * buffer_alloc(nrf_802154_buffer_t * p_buffer_pool, size_t buffer_pool_len)
+/* Finds a free buffer in a single word of the free mask and marks it as taken. */
+static bool free_mask_word_take(volatile uint32_t * p_word, uint32_t * p_bit)
 {
-    nrf_802154_buffer_t * p_buffer  = NULL;
-    bool                  success   = false;
-    bool                  retry     = false;
-    uint32_t              crit_sect = 0UL;
+    uint32_t mask;
+    uint32_t bit;
 
     do
     {
-        retry = false;
+        mask = __LDREXW(p_word);
 
-        // Iterate over the buffer pool to search for a free buffer
-        for (uint32_t i = 0; i < buffer_pool_len; i++)
+        if (mask == 0UL)
         {
-            p_buffer = &p_buffer_pool[i];
-
-            if (!p_buffer->taken)
-            {
-                // Free buffer detected. Enter critical section to take it
-                nrf_802154_serialization_crit_sect_enter(&crit_sect);
-
-                if (p_buffer->taken)
-                {
-                    // The allocation was preempted and the buffer was taken by higher priority
-                    // Reiterate over the buffer pool and search for a free buffer again
-                    retry = true;
-                }
-                else
-                {
-                    // The allocation can be performed safely
-                    p_buffer->taken = true;
-                    success         = true;
-                }
-
-                nrf_802154_serialization_crit_sect_exit(crit_sect);
-
-                break;
-            }
+            // All buffers tracked by this word are taken
+            __CLREX();
+            return false;
         }
+
+        // Take the lowest free buffer
+        bit = 31UL - __CLZ(mask & (~mask + 1UL));
     }
-    while (retry);
+    while (__STREXW(mask & ~(1UL << bit), p_word));
+
+    __DMB();
 
-    return success ? p_buffer->data : NULL;
+    *p_bit = bit;
+
+    return true;
 }
 
-static void buffer_free(nrf_802154_buffer_t * p_buffer_to_free,
-                        nrf_802154_buffer_t * p_buffer_pool,
-                        size_t                buffer_pool_len)
+static void free_mask_word_give(volatile uint32_t * p_word, uint32_t bit)
 {
-    uint32_t crit_sect = 0UL;
-    size_t   idx       =
-        ((uintptr_t)p_buffer_to_free - (uintptr_t)p_buffer_pool) / sizeof(nrf_802154_buffer_t);
+    uint32_t mask;
 
-    NRF_802154_ASSERT(idx < buffer_pool_len);
+    __DMB();
 
-    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    do
+    {
+        mask = __LDREXW(p_word);
+    }
+    while (__STREXW(mask | (1UL << bit), p_word));
+}
 
-    p_buffer_pool[idx].taken = false;
+static void usage_increment(nrf_802154_buffer_allocator_t * p_obj)
+{
+    uint32_t count;
+    uint32_t high_water;
 
-    nrf_802154_serialization_crit_sect_exit(crit_sect);
+    do
+    {
+        count = __LDREXW(&p_obj->count) + 1UL;
+    }
+    while (__STREXW(count, &p_obj->count));
+
+    do
+    {
+        high_water = __LDREXW(&p_obj->high_water);
+
+        if (high_water >= count)
+        {
+            __CLREX();
+            break;
+        }
+    }
+    while (__STREXW(count, &p_obj->high_water));
+}
+
+static void usage_decrement(nrf_802154_buffer_allocator_t * p_obj)
+{
+    uint32_t count;
+
+    do
+    {
+        count = __LDREXW(&p_obj->count);
+    }
+    while (__STREXW(count - 1UL, &p_obj->count));
 }
 
 void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
@@ -113,26 +127,63 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
 {
     size_t capacity = memsize / sizeof(nrf_802154_buffer_t);
 
+    // The bitmap of free buffers is stored behind the buffers
+    while ((capacity != 0U) &&
+           (NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(capacity) > memsize))
+    {
+        capacity--;
+    }
+
     NRF_802154_ASSERT((capacity == 0U) || ((capacity != 0U) && (p_memory != NULL)));
+    NRF_802154_ASSERT(((uintptr_t)p_memory % sizeof(uint32_t)) == 0U);
+
+    p_obj->p_memory    = p_memory;
+    p_obj->capacity    = capacity;
+    p_obj->p_free_mask = (volatile uint32_t *)((nrf_802154_buffer_t *)p_memory + capacity);
+    p_obj->count       = 0UL;
+    p_obj->high_water  = 0UL;
+
+    for (size_t i = 0; i < NRF_802154_BUFFER_ALLOCATOR_FREE_MASK_WORDS(capacity); i++)
+    {
+        size_t remaining = capacity - (i * 32U);
 
-    p_obj->p_memory = p_memory;
-    p_obj->capacity = capacity;
+        p_obj->p_free_mask[i] = (remaining >= 32U) ? UINT32_MAX : ((1UL << remaining) - 1UL);
+    }
+}
 
-    nrf_802154_buffer_t * p_buffer = (nrf_802154_buffer_t *)p_obj->p_memory;
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj)
+{
+    nrf_802154_buffer_t * p_buffer_pool = (nrf_802154_buffer_t *)p_obj->p_memory;
+    uint32_t              bit;
 
-    for (size_t i = 0; i < p_obj->capacity; i++)
+    for (size_t i = 0; i < NRF_802154_BUFFER_ALLOCATOR_FREE_MASK_WORDS(p_obj->capacity); i++)
     {
-        p_buffer[i].taken = false;
+        if (free_mask_word_take(&p_obj->p_free_mask[i], &bit))
+        {
+            usage_increment(p_obj);
+
+            return p_buffer_pool[(i * 32U) + bit].data;
+        }
     }
+
+    return NULL;
 }
 
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj)
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj,
+                                      void                          * p_buffer)
 {
-    return buffer_alloc((nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    size_t idx = ((uintptr_t)p_buffer - (uintptr_t)p_obj->p_memory) /
+                 sizeof(nrf_802154_buffer_t);
+
+    NRF_802154_ASSERT(idx < p_obj->capacity);
+    NRF_802154_ASSERT((p_obj->p_free_mask[idx / 32U] & (1UL << (idx % 32U))) == 0UL);
+
+    usage_decrement(p_obj);
+    free_mask_word_give(&p_obj->p_free_mask[idx / 32U], idx % 32U);
 }
 
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj,
-                                      void                                * p_buffer)
+void nrf_802154_buffer_allocator_high_water_reset(nrf_802154_buffer_allocator_t * p_obj)
 {
-    buffer_free(p_buffer, (nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    // Concurrent allocations may be missed, which is acceptable for statistics
+    p_obj->high_water = p_obj->count;
 }
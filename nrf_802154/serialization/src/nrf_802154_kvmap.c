@@ -34,6 +34,10 @@
 
 /**@file nrf_802154_kvmap.c
  * @brief Simple key-value map.
+ *
+ * Items are stored in a sorted array. Searching for a key takes logarithmic time and
+ * adding or removing an item moves at most all items in a single @c memmove, so the time
+ * spent in the serialization critical section is bounded by the capacity of the map.
  */
 
 #include "nrf_802154_kvmap.h"
@@ -61,23 +65,40 @@ static void item_value_write(const nrf_802154_kvmap_t * p_kvmap,
     }
 }
 
-static size_t item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap, const void * p_key)
+/* Items are kept sorted by key, so that a key is found with a binary search. */
+static bool item_idx_by_key_search(const nrf_802154_kvmap_t * p_kvmap,
+                                   const void               * p_key,
+                                   size_t                   * p_idx)
 {
-    size_t    item_size = NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
-    uint8_t * p_item    = p_kvmap->p_memory;
-    size_t    idx;
+    size_t a = 0U;
+    size_t b = p_kvmap->count;
 
-    /* Linear search */
-    for (idx = 0U; idx < p_kvmap->count; ++idx, p_item += item_size)
+    while (a < b)
     {
-        if (memcmp(p_item, p_key, p_kvmap->key_size) == 0)
+        size_t c          = a + (b - a) / 2U;
+        int    cmp_result = memcmp(p_key, item_ptr_by_idx_get(p_kvmap, c), p_kvmap->key_size);
+
+        if (cmp_result == 0)
         {
             /* Hit! */
-            break;
+            *p_idx = c;
+            return true;
+        }
+
+        if (cmp_result < 0)
+        {
+            b = c;
+        }
+        else
+        {
+            a = c + 1U;
         }
     }
 
-    return idx;
+    /* Not found, a is the index where the key should be inserted. */
+    *p_idx = a;
+
+    return false;
 }
 
 void nrf_802154_kvmap_init(nrf_802154_kvmap_t * p_kvmap,
@@ -101,8 +122,7 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx < p_kvmap->count)
+    if (item_idx_by_key_search(p_kvmap, p_key, &idx))
     {
         /* Item already present */
         uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, idx);
@@ -116,8 +136,13 @@ bool nrf_802154_kvmap_add(nrf_802154_kvmap_t * p_kvmap, const void * p_key, cons
     }
     else
     {
-        /* Not found, try to add next at p_kvmap->count */
-        uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
+        /* Not found, make room for the item at idx to keep the items sorted */
+        uint8_t * p_item = item_ptr_by_idx_get(p_kvmap, idx);
+
+        memmove(item_ptr_by_idx_get(p_kvmap, idx + 1U),
+                p_item,
+                (p_kvmap->count - idx) *
+                NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
 
         memcpy(p_item, p_key, p_kvmap->key_size);
         item_value_write(p_kvmap, p_item, p_value);
@@ -138,8 +163,7 @@ bool nrf_802154_kvmap_remove(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    if (!item_idx_by_key_search(p_kvmap, p_key, &idx))
     {
         /* Key not found */
         success = false;
@@ -149,12 +173,11 @@ bool nrf_802154_kvmap_remove(nrf_802154_kvmap_t * p_kvmap, const void * p_key)
         p_kvmap->count--;
         if (idx < p_kvmap->count)
         {
-            const uint8_t * p_last_item = item_ptr_by_idx_get(p_kvmap, p_kvmap->count);
-            uint8_t       * p_item      = item_ptr_by_idx_get(p_kvmap, idx);
-
-            memcpy(p_item,
-                   p_last_item,
-                   NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
+            /* Close the gap keeping the items sorted */
+            memmove(item_ptr_by_idx_get(p_kvmap, idx),
+                    item_ptr_by_idx_get(p_kvmap, idx + 1U),
+                    (p_kvmap->count - idx) *
+                    NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size));
         }
         else
         {
@@ -177,8 +200,7 @@ bool nrf_802154_kvmap_search(const nrf_802154_kvmap_t * p_kvmap,
 
     nrf_802154_serialization_crit_sect_enter(&crit_sect);
 
-    idx = item_idx_by_key_search(p_kvmap, p_key);
-    if (idx >= p_kvmap->count)
+    if (!item_idx_by_key_search(p_kvmap, p_key, &idx))
     {
         /* Key not found */
         success = false;
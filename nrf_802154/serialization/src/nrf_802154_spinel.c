@@ -107,10 +107,15 @@ nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
     }
 
+    return nrf_802154_spinel_packed_send(command_buff, (size_t)siz);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_packed_send(const void * p_frame, size_t frame_len)
+{
     NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
-    NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_frame, frame_len, "data");
 
-    return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+    return nrf_802154_spinel_encoded_packet_send(p_frame, frame_len);
 }
 
 void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
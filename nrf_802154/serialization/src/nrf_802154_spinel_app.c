@@ -54,6 +54,8 @@
 #include "nrf_802154_spinel_enc_app.h"
 #include "nrf_802154_spinel_dec_app.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
+#include "nrf_802154_spinel_pipeline.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
@@ -64,6 +66,12 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
+/**
+ * @brief Maximum size of addresses sent in a single
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET request.
+ */
+#define PENDING_BIT_FOR_ADDRS_MAX_SIZE 256U
+
 /**
  * @brief Wait with timeout for SPINEL_STATUS_OK to be received.
  *
@@ -412,6 +420,271 @@ bail:
     return error;
 }
 
+/**
+ * @brief Wait with timeout until all pipelined requests are processed.
+ *
+ * The network core processes requests in order, so when the response to SPINEL_CMD_NOOP is
+ * received, responses to all requests sent before it have been received too.
+ *
+ * @param[in]  timeout   Timeout in us.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t pipeline_sync(uint32_t timeout)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send(SPINEL_DATATYPE_COMMAND_S, SPINEL_HEADER_FLAG, SPINEL_CMD_NOOP);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = status_ok_await(timeout);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    nrf_802154_spinel_pipeline_flush();
+
+    return error;
+}
+
+/**
+ * @brief Prepare sending a request.
+ *
+ * If requests are pipelined, a TID is allocated for the request and its response is not
+ * awaited. Otherwise, the response notifier is locked so that the response can be awaited.
+ *
+ * @param[in]  awaited_property  Property of the response to the request.
+ *
+ * @returns  TID of a pipelined request or zero if the response shall be awaited.
+ *
+ */
+static spinel_tid_t request_prepare(spinel_prop_key_t awaited_property)
+{
+    nrf_802154_ser_err_t res;
+    spinel_tid_t         tid = 0U;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    if (nrf_802154_spinel_pipeline_is_active())
+    {
+        tid = nrf_802154_spinel_pipeline_request_add(awaited_property);
+
+        if (tid == 0U)
+        {
+            // All TIDs are in use. Wait until the pipeline drains
+            res = pipeline_sync(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+            SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+            tid = nrf_802154_spinel_pipeline_request_add(awaited_property);
+        }
+    }
+
+bail:
+    if (tid == 0U)
+    {
+        nrf_802154_spinel_response_notifier_lock_before_request(awaited_property);
+    }
+
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return tid;
+}
+
+/**
+ * @brief Wait with timeout for SPINEL_STATUS_OK to be received unless the request is pipelined.
+ *
+ * @param[in]  tid       TID returned by @ref request_prepare.
+ * @param[in]  timeout   Timeout in us.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t request_status_ok_await(spinel_tid_t tid, uint32_t timeout)
+{
+    return (tid == 0U) ? status_ok_await(timeout) : NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Wait with timeout for some single bool property to be received unless the request
+ *        is pipelined.
+ *
+ * The result of a pipelined request is reported by nrf_802154_serialization_pipeline_end,
+ * so true is returned for it.
+ *
+ * @param[in]  tid              TID returned by @ref request_prepare.
+ * @param[in]  timeout          Timeout in us.
+ * @param[out] p_net_response   Pointer to the bool variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t request_bool_response_await(spinel_tid_t tid,
+                                                        uint32_t     timeout,
+                                                        bool       * p_net_response)
+{
+    if (tid != 0U)
+    {
+        *p_net_response = true;
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    return net_generic_bool_response_await(timeout, p_net_response);
+}
+
+/**
+ * @brief Check if the network core supports pipelined requests.
+ *
+ * The first call probes the network core with a SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET
+ * request, which every version of the network core supports, sent with a non-zero TID.
+ * Only a network core that supports pipelined requests and
+ * SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET echoes the TID.
+ *
+ * @returns  true if the network core supports pipelined requests, false otherwise.
+ *
+ */
+static bool pipeline_support_check(void)
+{
+    nrf_802154_ser_err_t res;
+    spinel_tid_t         tid;
+    uint8_t              channel;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    if (nrf_802154_spinel_pipeline_support_get() != NRF_802154_SPINEL_PIPELINE_SUPPORT_UNKNOWN)
+    {
+        return nrf_802154_spinel_pipeline_support_get() ==
+               NRF_802154_SPINEL_PIPELINE_SUPPORT_AVAILABLE;
+    }
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET);
+
+    tid = nrf_802154_spinel_pipeline_probe_begin();
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
+        SPINEL_DATATYPE_NRF_802154_CHANNEL_GET,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_uint8_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                           &channel);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    nrf_802154_spinel_pipeline_probe_end();
+
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return nrf_802154_spinel_pipeline_support_get() ==
+           NRF_802154_SPINEL_PIPELINE_SUPPORT_AVAILABLE;
+}
+
+bool nrf_802154_serialization_pipeline_begin(void)
+{
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    return pipeline_support_check() && nrf_802154_spinel_pipeline_begin();
+}
+
+bool nrf_802154_serialization_pipeline_end(void)
+{
+    nrf_802154_ser_err_t res = NRF_802154_SERIALIZATION_ERROR_OK;
+    bool                 result;
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    if (nrf_802154_spinel_pipeline_is_pending())
+    {
+        res = pipeline_sync(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    }
+
+    result = nrf_802154_spinel_pipeline_end();
+
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(res);
+
+    return result && (res == NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+uint8_t nrf_802154_serialization_pending_bit_for_addrs_set(const uint8_t * p_addrs,
+                                                           uint8_t         addr_count,
+                                                           bool            extended)
+{
+    nrf_802154_ser_err_t res;
+    size_t               addr_size   = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t              addrs_added = 0U;
+    uint8_t              chunk_count;
+    uint8_t              chunk_added;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_BUFF(p_addrs, addr_count * addr_size);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    if (!pipeline_support_check())
+    {
+        // The network core does not support the bulk request. Add the addresses one by one
+        while ((addrs_added < addr_count) &&
+               nrf_802154_pending_bit_for_addr_set(&p_addrs[addrs_added * addr_size], extended))
+        {
+            addrs_added++;
+        }
+
+        return addrs_added;
+    }
+
+    while (addrs_added < addr_count)
+    {
+        chunk_count = addr_count - addrs_added;
+
+        if ((chunk_count * addr_size) > PENDING_BIT_FOR_ADDRS_MAX_SIZE)
+        {
+            chunk_count = PENDING_BIT_FOR_ADDRS_MAX_SIZE / addr_size;
+        }
+
+        nrf_802154_spinel_response_notifier_lock_before_request(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET,
+            SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDRS_SET,
+            extended,
+            &p_addrs[addrs_added * addr_size],
+            chunk_count * addr_size);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_uint8_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                               &chunk_added);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+        SERIALIZATION_ERROR_IF(chunk_added > chunk_count,
+                               NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID,
+                               error,
+                               bail);
+
+        addrs_added += chunk_added;
+
+        if (chunk_added < chunk_count)
+        {
+            break;
+        }
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return addrs_added;
+}
+
 void nrf_802154_init(void)
 {
     nrf_802154_serialization_init();
@@ -611,16 +884,18 @@ void nrf_802154_pan_id_set(const uint8_t * p_pan_id)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_pan_id, PAN_ID_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
-                                                    SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
-                                                    p_pan_id,
-                                                    PAN_ID_SIZE);
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+        p_pan_id,
+        PAN_ID_SIZE);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -638,9 +913,10 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_short_address, SHORT_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET,
         SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
         p_short_address,
@@ -648,7 +924,7 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -674,9 +950,10 @@ void nrf_802154_alternate_short_address_set(const uint8_t * p_short_address)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_short_address, SHORT_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ALTERNATE_SHORT_ADDRESS_SET,
         SPINEL_DATATYPE_NRF_802154_ALTERNATE_SHORT_ADDRESS_SET,
         data_valid,
@@ -685,7 +962,7 @@ void nrf_802154_alternate_short_address_set(const uint8_t * p_short_address)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -703,9 +980,10 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_extended_address, EXTENDED_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET,
         SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
         p_extended_address,
@@ -713,7 +991,7 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -765,16 +1043,17 @@ void nrf_802154_pan_coord_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET,
         SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -792,16 +1071,17 @@ void nrf_802154_promiscuous_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET,
         SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -817,16 +1097,17 @@ void nrf_802154_rx_on_when_idle_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RX_ON_WHEN_IDLE_SET,
         SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -842,16 +1123,17 @@ void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_m
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", match_method);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
         SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
         match_method);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -873,10 +1155,10 @@ bool nrf_802154_ack_data_set(const uint8_t       * p_addr,
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET,
         p_addr,
@@ -887,8 +1169,9 @@ bool nrf_802154_ack_data_set(const uint8_t       * p_addr,
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
-                                          &ack_data_set_res);
+    res = request_bool_response_await(tid,
+                                      CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                      &ack_data_set_res);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -911,10 +1194,10 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR,
         p_addr,
@@ -923,8 +1206,9 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
-                                          &ack_data_clear_res);
+    res = request_bool_response_await(tid,
+                                      CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                      &ack_data_clear_res);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -943,10 +1227,10 @@ void nrf_802154_ack_data_remove_all(bool extended, nrf_802154_ack_data_t data_ty
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_REMOVE_ALL);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_REMOVE_ALL,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL,
         extended,
@@ -954,7 +1238,7 @@ void nrf_802154_ack_data_remove_all(bool extended, nrf_802154_ack_data_t data_ty
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -970,16 +1254,17 @@ void nrf_802154_auto_pending_bit_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (enabled ? "true" : "false"), "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET,
         SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -997,10 +1282,10 @@ bool nrf_802154_pending_bit_for_addr_set(const uint8_t * p_addr, bool extended)
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
         p_addr,
@@ -1008,8 +1293,9 @@ bool nrf_802154_pending_bit_for_addr_set(const uint8_t * p_addr, bool extended)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
-                                          &addr_set_res);
+    res = request_bool_response_await(tid,
+                                      CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                      &addr_set_res);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1030,10 +1316,10 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
         p_addr,
@@ -1041,8 +1327,9 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
-                                          &addr_clr_res);
+    res = request_bool_response_await(tid,
+                                      CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                      &addr_clr_res);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1061,16 +1348,17 @@ void nrf_802154_pending_bit_for_addr_reset(bool extended)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    spinel_tid_t tid = request_prepare(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_with_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
         extended);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = request_status_ok_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1567,6 +1855,8 @@ nrf_802154_tx_error_t nrf_802154_transmit_raw(uint8_t
     nrf_802154_ser_err_t  res;
     uint32_t              data_handle;
     nrf_802154_tx_error_t transmit_result = NRF_802154_TX_ERROR_NONE;
+    uint8_t               command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    spinel_ssize_t        siz;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -1596,11 +1886,15 @@ nrf_802154_tx_error_t nrf_802154_transmit_raw(uint8_t
     nrf_802154_spinel_response_notifier_lock_before_request(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_TRANSMIT_METADATA_ENCODE(*p_metadata),
-        NRF_802154_HDATA_ENCODE(data_handle, p_data, p_data[0]));
+    siz = nrf_802154_spinel_pack_transmit_raw(command_buff,
+                                              sizeof(command_buff),
+                                              p_metadata,
+                                              data_handle,
+                                              p_data,
+                                              NRF_802154_HDATA_LENGTH(p_data[0]));
+
+    res = (siz < 0) ? NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE :
+          nrf_802154_spinel_packed_send(command_buff, (size_t)siz);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
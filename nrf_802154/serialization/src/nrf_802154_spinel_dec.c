@@ -32,20 +32,28 @@
  *
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_serialization_crit_sect.h"
 #include "nrf_802154_serialization_error.h"
 
+static spinel_tid_t  m_rx_tid;      ///< TID of the spinel frame being dispatched.
+static volatile bool m_dispatching; ///< If a spinel frame is being dispatched.
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len)
 {
-    uint8_t          header;
-    spinel_command_t cmd;
-    const void     * p_cmd_data;
-    size_t           cmd_data_len;
+    uint8_t              header;
+    spinel_command_t     cmd;
+    const void         * p_cmd_data;
+    size_t               cmd_data_len;
+    bool                 busy;
+    uint32_t             crit_sect = 0UL;
+    nrf_802154_ser_err_t res;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_packet_data,
                                                 packet_data_len,
@@ -60,5 +68,31 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    return nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    busy          = m_dispatching;
+    m_dispatching = true;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (busy)
+    {
+        // The backend passed a frame while another one is dispatched. Dispatching it would
+        // overwrite the TID that responses to the other frame are sent with
+        return NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+    }
+
+    m_rx_tid = SPINEL_HEADER_GET_TID(header);
+
+    res = nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+
+    m_rx_tid      = 0U;
+    m_dispatching = false;
+
+    return res;
+}
+
+spinel_tid_t nrf_802154_spinel_rx_tid_get(void)
+{
+    return m_rx_tid;
 }
@@ -45,6 +45,8 @@
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
+#include "nrf_802154_spinel_pipeline.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
@@ -171,23 +173,22 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    uint64_t timestamp;
-    void   * p_local_ptr;
-
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-                                                NRF_802154_HDATA_DECODE(remote_frame_handle,
-                                                                        p_frame,
-                                                                        frame_hdata_len),
-                                                &power,
-                                                &lqi,
-                                                &timestamp);
+    uint32_t     remote_frame_handle;
+    const void * p_frame;
+    size_t       frame_hdata_len;
+    int8_t       power;
+    uint8_t      lqi;
+    uint64_t     timestamp;
+    void       * p_local_ptr;
+
+    spinel_ssize_t siz = nrf_802154_spinel_unpack_received_timestamp_raw(p_property_data,
+                                                                         property_data_len,
+                                                                         &remote_frame_handle,
+                                                                         &p_frame,
+                                                                         &frame_hdata_len,
+                                                                         &power,
+                                                                         &lqi,
+                                                                         &timestamp);
 
     if (siz < 0)
     {
@@ -573,6 +574,15 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
+    if (nrf_802154_spinel_pipeline_response_is_handled(nrf_802154_spinel_rx_tid_get(), property))
+    {
+        // Responses to pipelined requests are not awaited through the response notifier
+        return nrf_802154_spinel_pipeline_response_process(nrf_802154_spinel_rx_tid_get(),
+                                                           property,
+                                                           p_property_data,
+                                                           property_data_len);
+    }
+
     switch (property)
     {
         case SPINEL_PROP_LAST_STATUS:
@@ -640,6 +650,9 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
             SWITCH_CASE_FALLTHROUGH;
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET:
+            SWITCH_CASE_FALLTHROUGH;
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET:
             SWITCH_CASE_FALLTHROUGH;
 
@@ -33,6 +33,7 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "nrf_802154_const.h"
 
@@ -41,6 +42,7 @@
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc_net.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
@@ -71,9 +73,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_sleep(const void * p_p
 
     sleep_response = nrf_802154_sleep();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
-                                                    SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
-                                                    sleep_response);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
+        SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+        sleep_response);
 }
 
 /**
@@ -92,7 +95,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_sleep_if_idle(
 
     nrf_802154_sleep_error_t sleep_response = nrf_802154_sleep_if_idle();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE,
         SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
         sleep_response);
@@ -115,9 +118,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive(const void * p
 
     receive_response = nrf_802154_receive();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
-                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
-                                                    receive_response);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+        receive_response);
 }
 
 #if NRF_802154_DELAYED_TRX_ENABLED
@@ -153,7 +157,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at(
 
     bool result = nrf_802154_receive_at(rx_time, timeout, channel, id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
         result);
@@ -185,7 +189,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_cancel(
 
     bool result = nrf_802154_receive_at_cancel(id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
         result);
@@ -217,7 +221,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_scheduled_c
 
     bool result = nrf_802154_receive_at_scheduled_cancel(id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_SCHEDULED_CANCEL,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_SCHEDULED_CANCEL_RET,
         result);
@@ -233,7 +237,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_channel_get(const void
 
     uint8_t channel = nrf_802154_channel_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
         SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
         channel);
@@ -451,7 +455,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pan_coord_get(
 
     bool result = nrf_802154_pan_coord_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_GET,
         SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
         result);
@@ -532,9 +536,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca(const void * p_pro
 
     bool result = nrf_802154_cca();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
-                                                    SPINEL_DATATYPE_NRF_802154_CCA_RET,
-                                                    result);
+    return nrf_802154_spinel_send_response_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
+        SPINEL_DATATYPE_NRF_802154_CCA_RET,
+        result);
 }
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -555,7 +560,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_continuous_carrier(
 
     bool result = nrf_802154_continuous_carrier();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER,
         SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
         result);
@@ -594,7 +599,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_modulated_carrier(
 
     bool result = nrf_802154_modulated_carrier(p_buffer);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER,
         SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
         result);
@@ -628,7 +633,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
 
     bool result = nrf_802154_energy_detection(time_us);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION,
         SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
         result);
@@ -704,12 +709,62 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_s
 
     result = nrf_802154_pending_bit_for_addr_set(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addrs_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t * p_addrs;
+    size_t          addrs_len;
+    size_t          addr_size;
+    bool            extended;
+    uint8_t         addrs_added = 0U;
+    spinel_ssize_t  siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDRS_SET,
+                                 &extended,
+                                 &p_addrs,
+                                 &addrs_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    if (((addrs_len % addr_size) != 0U) || ((addrs_len / addr_size) > UINT8_MAX))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    // Stop at the first address that cannot be added, like a sequence of single requests would
+    while (((addrs_added * addr_size) < addrs_len) &&
+           nrf_802154_pending_bit_for_addr_set(&p_addrs[addrs_added * addr_size], extended))
+    {
+        addrs_added++;
+    }
+
+    return nrf_802154_spinel_send_response_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET,
+        SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDRS_SET_RET,
+        addrs_added);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR.
  *
@@ -753,7 +808,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pending_bit_for_addr_c
 
     result = nrf_802154_pending_bit_for_addr_clear(p_addr, extended);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
         result);
@@ -882,7 +937,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_set(
         (uint16_t)length,
         data_type);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
         ack_data_set_res);
@@ -932,7 +987,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_clear(
 
     bool ack_data_clear_res = nrf_802154_ack_data_clear(p_addr, extended, data_type);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR,
         SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
         ack_data_clear_res);
@@ -1015,7 +1070,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(
                                                           p_local_frame_ptr);
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
         result);
@@ -1048,7 +1103,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_min_be_set(
 
     result = nrf_802154_csma_ca_min_be_set(min_be);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
         result);
@@ -1070,7 +1125,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_min_be_get(
 
     uint8_t min_be = nrf_802154_csma_ca_min_be_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
         min_be);
@@ -1103,7 +1158,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_be_set(
 
     result = nrf_802154_csma_ca_max_be_set(max_be);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
         result);
@@ -1125,7 +1180,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_be_get(
 
     uint8_t max_be = nrf_802154_csma_ca_max_be_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
         max_be);
@@ -1176,7 +1231,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_g
 
     uint8_t max_backoffs = nrf_802154_csma_ca_max_backoffs_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
         max_backoffs);
@@ -1230,7 +1285,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_test_mode_csmaca_backo
 
     nrf_802154_test_mode_csmaca_backoff_t value = nrf_802154_test_mode_csmaca_backoff_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET,
         SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
         value);
@@ -1267,7 +1322,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_mode_set(
 
     result = nrf_802154_ifs_mode_set(value);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
         SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
         result);
@@ -1289,7 +1344,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_mode_get(
 
     nrf_802154_ifs_mode_t value = nrf_802154_ifs_mode_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
         value);
@@ -1340,7 +1395,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_sifs_period_ge
 
     uint16_t value = nrf_802154_ifs_min_sifs_period_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
         value);
@@ -1391,7 +1446,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ifs_min_lifs_period_ge
 
     uint16_t value = nrf_802154_ifs_min_lifs_period_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
         value);
@@ -1416,12 +1471,12 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
     void                         * p_local_frame_ptr;
     nrf_802154_transmit_metadata_t tx_metadata;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(
-        p_property_data,
-        property_data_len,
-        SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
-        NRF_802154_TRANSMIT_METADATA_DECODE(tx_metadata),
-        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len));
+    spinel_ssize_t siz = nrf_802154_spinel_unpack_transmit_raw(p_property_data,
+                                                               property_data_len,
+                                                               &tx_metadata,
+                                                               &remote_frame_handle,
+                                                               &p_frame,
+                                                               &frame_hdata_len);
 
     if (siz < 0)
     {
@@ -1449,7 +1504,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw(
                                                           p_local_frame_ptr);
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
         result);
@@ -1522,7 +1577,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_raw_at(
         mp_transmit_at_frame = p_local_frame_ptr;
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
         result);
@@ -1564,7 +1619,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_transmit_at_cancel(
         }
     }
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
         result);
@@ -1667,7 +1722,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_power_get(
 
     power = nrf_802154_tx_power_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
         SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
         power);
@@ -1691,7 +1746,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_capabilities_get(
 
     caps = nrf_802154_capabilities_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
         SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
         caps);
@@ -1715,7 +1770,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_time_get(
 
     time = nrf_802154_time_get();
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
         SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
         time);
@@ -1731,7 +1786,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_cca_cfg_get(const void
 
     nrf_802154_cca_cfg_get(&cfg);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET,
         SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
         NRF_802154_CCA_CFG_ENCODE(cfg));
@@ -1748,7 +1803,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_stat_timestamps_get(
 
     nrf_802154_stat_timestamps_get(&t);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET,
         SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
         NRF_802154_STAT_TIMESTAMPS_ENCODE(t));
@@ -1860,7 +1915,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_store(
 
     err = nrf_802154_security_key_store(&key);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
         SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
         err);
@@ -1894,7 +1949,7 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_security_key_remove(
 
     err = nrf_802154_security_key_remove(&key_id);
 
-    return nrf_802154_spinel_send_cmd_prop_value_is(
+    return nrf_802154_spinel_send_response_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
         SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
         err);
@@ -2041,6 +2096,10 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear(p_property_data,
                                                                             property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDRS_SET:
+            return spinel_decode_prop_nrf_802154_pending_bit_for_addrs_set(p_property_data,
+                                                                           property_data_len);
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET:
             return spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset(p_property_data,
                                                                             property_data_len);
@@ -2269,6 +2328,10 @@ nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
         case SPINEL_CMD_PROP_VALUE_SET:
             return nrf_802154_spinel_decode_cmd_prop_value_set(p_cmd_data, cmd_data_len);
 
+        case SPINEL_CMD_NOOP:
+            // Used by the application core to wait until all pipelined requests are processed
+            return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+
         default:
             NRF_802154_SPINEL_LOG_RAW("Unsupported command: %s(%u)\n",
                                       spinel_command_to_cstr(cmd),
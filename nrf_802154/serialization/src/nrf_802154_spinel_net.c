@@ -51,6 +51,7 @@
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_net.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_spinel_pack.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_serialization_error_helper.h"
@@ -210,6 +211,8 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
 {
     nrf_802154_ser_err_t res;
     uint32_t             local_data_handle;
+    uint8_t              command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    spinel_ssize_t       siz;
 
     SERIALIZATION_ERROR_INIT(error);
 
@@ -231,14 +234,19 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         SERIALIZATION_ERROR(NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
     }
 
-    // Serialize the call
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
-        power,
-        lqi,
-        time);
+    // Serialize the call. Received frames are the most frequent property, so they are packed
+    // without interpreting the SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW format string.
+    siz = nrf_802154_spinel_pack_received_timestamp_raw(command_buff,
+                                                        sizeof(command_buff),
+                                                        local_data_handle,
+                                                        p_data,
+                                                        NRF_802154_HDATA_LENGTH(p_data[0]),
+                                                        power,
+                                                        lqi,
+                                                        time);
+
+    res = (siz < 0) ? NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE :
+          nrf_802154_spinel_packed_send(command_buff, (size_t)siz);
 
     if (res < 0)
     {
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_pack.c
+ * @brief Specialized spinel packing of the most frequent 802.15.4 serialization properties.
+ *
+ * The functions in this file produce and accept the same bytes as the generic
+ * @ref spinel_datatype_pack and @ref spinel_datatype_unpack functions called with the format
+ * strings from nrf_802154_spinel_datatypes.h, but they do not interpret the format strings
+ * at runtime. They must be kept in sync with the format strings.
+ */
+
+#include "nrf_802154_spinel_pack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
+
+/* Size of the payload of SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW after the frame. */
+#define RECEIVED_TIMESTAMP_RAW_TAIL_SIZE (sizeof(int8_t) + sizeof(uint8_t) + sizeof(uint64_t))
+
+/* Size of SPINEL_DATATYPE_NRF_802154_TRANSMIT_METADATA_S. */
+#define TRANSMIT_METADATA_SIZE           8U
+
+/* Packs the spinel frame header, the command and the property. */
+static uint8_t * header_pack(uint8_t * p_out, uint32_t cmd, uint32_t prop)
+{
+    *p_out++ = SPINEL_HEADER_FLAG;
+    p_out    = nrf_802154_spinel_pack_uint_packed(p_out, cmd);
+
+    return nrf_802154_spinel_pack_uint_packed(p_out, prop);
+}
+
+static size_t header_size(uint32_t cmd, uint32_t prop)
+{
+    return sizeof(uint8_t) +
+           nrf_802154_spinel_pack_uint_packed_size(cmd) +
+           nrf_802154_spinel_pack_uint_packed_size(prop);
+}
+
+/* Packs SPINEL_DATATYPE_NRF_802154_HDATA_S. */
+static uint8_t * hdata_pack(uint8_t       * p_out,
+                            uint32_t        handle,
+                            const uint8_t * p_data,
+                            size_t          hdata_len)
+{
+    p_out = nrf_802154_spinel_pack_uint16(p_out, (uint16_t)(sizeof(uint32_t) + hdata_len));
+    p_out = nrf_802154_spinel_pack_uint32(p_out, handle);
+
+    memcpy(p_out, p_data, hdata_len);
+
+    return p_out + hdata_len;
+}
+
+static size_t hdata_size(size_t hdata_len)
+{
+    return NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE + sizeof(uint32_t) + hdata_len;
+}
+
+/* Unpacks SPINEL_DATATYPE_NRF_802154_HDATA_S. Returns number of decoded bytes or -1. */
+static spinel_ssize_t hdata_unpack(const uint8_t * p_in,
+                                   size_t          in_len,
+                                   uint32_t      * p_handle,
+                                   const void   ** pp_data,
+                                   size_t        * p_hdata_len)
+{
+    uint16_t block_len;
+
+    if (in_len < NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE)
+    {
+        return -1;
+    }
+
+    block_len = nrf_802154_spinel_unpack_uint16(p_in);
+
+    if ((block_len >= SPINEL_FRAME_MAX_SIZE) ||
+        (block_len < sizeof(uint32_t)) ||
+        (in_len < (NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE + block_len)))
+    {
+        return -1;
+    }
+
+    p_in += NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE;
+
+    *p_handle    = nrf_802154_spinel_unpack_uint32(p_in);
+    *pp_data     = p_in + sizeof(uint32_t);
+    *p_hdata_len = block_len - sizeof(uint32_t);
+
+    return (spinel_ssize_t)(NRF_802154_SPINEL_PACK_BLOCK_LEN_SIZE + block_len);
+}
+
+spinel_ssize_t nrf_802154_spinel_pack_received_timestamp_raw(uint8_t       * p_buf,
+                                                             size_t          buf_size,
+                                                             uint32_t        handle,
+                                                             const uint8_t * p_data,
+                                                             size_t          hdata_len,
+                                                             int8_t          power,
+                                                             uint8_t         lqi,
+                                                             uint64_t        time)
+{
+    const uint32_t prop = SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW;
+    size_t         size = header_size(SPINEL_CMD_PROP_VALUE_IS, prop) +
+                          hdata_size(hdata_len) +
+                          RECEIVED_TIMESTAMP_RAW_TAIL_SIZE;
+    uint8_t * p_out = p_buf;
+
+    if (size > buf_size)
+    {
+        return -1;
+    }
+
+    p_out    = header_pack(p_out, SPINEL_CMD_PROP_VALUE_IS, prop);
+    p_out    = hdata_pack(p_out, handle, p_data, hdata_len);
+    *p_out++ = (uint8_t)power;
+    *p_out++ = lqi;
+    p_out    = nrf_802154_spinel_pack_uint64(p_out, time);
+
+    return (spinel_ssize_t)(p_out - p_buf);
+}
+
+spinel_ssize_t nrf_802154_spinel_unpack_received_timestamp_raw(const void   * p_property_data,
+                                                               size_t         property_data_len,
+                                                               uint32_t     * p_handle,
+                                                               const void  ** pp_data,
+                                                               size_t       * p_hdata_len,
+                                                               int8_t       * p_power,
+                                                               uint8_t      * p_lqi,
+                                                               uint64_t     * p_time)
+{
+    const uint8_t * p_in = (const uint8_t *)p_property_data;
+    spinel_ssize_t  siz  = hdata_unpack(p_in, property_data_len, p_handle, pp_data, p_hdata_len);
+
+    if ((siz < 0) || ((property_data_len - (size_t)siz) < RECEIVED_TIMESTAMP_RAW_TAIL_SIZE))
+    {
+        return -1;
+    }
+
+    p_in += siz;
+
+    *p_power = (int8_t)p_in[0];
+    *p_lqi   = p_in[1];
+    *p_time  = nrf_802154_spinel_unpack_uint64(&p_in[2]);
+
+    return siz + (spinel_ssize_t)RECEIVED_TIMESTAMP_RAW_TAIL_SIZE;
+}
+
+spinel_ssize_t nrf_802154_spinel_pack_transmit_raw(
+    uint8_t                              * p_buf,
+    size_t                                 buf_size,
+    const nrf_802154_transmit_metadata_t * p_metadata,
+    uint32_t                               handle,
+    const uint8_t                        * p_data,
+    size_t                                 hdata_len)
+{
+    const uint32_t prop = SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW;
+    size_t         size = header_size(SPINEL_CMD_PROP_VALUE_SET, prop) +
+                          TRANSMIT_METADATA_SIZE +
+                          hdata_size(hdata_len);
+    uint8_t * p_out = p_buf;
+
+    if (size > buf_size)
+    {
+        return -1;
+    }
+
+    p_out    = header_pack(p_out, SPINEL_CMD_PROP_VALUE_SET, prop);
+    *p_out++ = p_metadata->frame_props.is_secured;
+    *p_out++ = p_metadata->frame_props.dynamic_data_is_set;
+    *p_out++ = p_metadata->cca;
+    *p_out++ = p_metadata->tx_power.use_metadata_value;
+    *p_out++ = (uint8_t)p_metadata->tx_power.power;
+    *p_out++ = p_metadata->tx_channel.use_metadata_value;
+    *p_out++ = p_metadata->tx_channel.channel;
+    *p_out++ = p_metadata->tx_timestamp_encode;
+    p_out    = hdata_pack(p_out, handle, p_data, hdata_len);
+
+    return (spinel_ssize_t)(p_out - p_buf);
+}
+
+spinel_ssize_t nrf_802154_spinel_unpack_transmit_raw(
+    const void                     * p_property_data,
+    size_t                           property_data_len,
+    nrf_802154_transmit_metadata_t * p_metadata,
+    uint32_t                       * p_handle,
+    const void                    ** pp_data,
+    size_t                         * p_hdata_len)
+{
+    const uint8_t * p_in = (const uint8_t *)p_property_data;
+    spinel_ssize_t  siz;
+
+    if (property_data_len < TRANSMIT_METADATA_SIZE)
+    {
+        return -1;
+    }
+
+    p_metadata->frame_props.is_secured          = (p_in[0] != 0U);
+    p_metadata->frame_props.dynamic_data_is_set = (p_in[1] != 0U);
+    p_metadata->cca                             = (p_in[2] != 0U);
+    p_metadata->tx_power.use_metadata_value     = (p_in[3] != 0U);
+    p_metadata->tx_power.power                  = (int8_t)p_in[4];
+    p_metadata->tx_channel.use_metadata_value   = (p_in[5] != 0U);
+    p_metadata->tx_channel.channel              = p_in[6];
+    p_metadata->tx_timestamp_encode             = (p_in[7] != 0U);
+
+    siz = hdata_unpack(&p_in[TRANSMIT_METADATA_SIZE],
+                       property_data_len - TRANSMIT_METADATA_SIZE,
+                       p_handle,
+                       pp_data,
+                       p_hdata_len);
+
+    if (siz < 0)
+    {
+        return -1;
+    }
+
+    return siz + (spinel_ssize_t)TRANSMIT_METADATA_SIZE;
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_spinel_pipeline.c
+ *
+ * @brief Tracking of pipelined requests sent from the application core.
+ *
+ * A pipelined request is sent with a non-zero spinel TID and the sender does not wait for its
+ * response. The network core processes requests in order and echoes the TID of each request
+ * in its response, so responses to pipelined requests are matched with their requests here
+ * instead of being passed to the response notifier.
+ *
+ * A network core built before pipelined requests were added responds with TID zero, so its
+ * responses could not be told apart from responses to synchronous requests. Before the first
+ * pipeline, the network core is probed with a request that every version supports, sent with
+ * a non-zero TID. If the TID is not echoed, requests are not pipelined.
+ *
+ * The state is shared by the thread that pipelines requests and the context that dispatches
+ * responses, so it is modified only within the serialization critical section.
+ */
+
+#include "nrf_802154_spinel_pipeline.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_dec_app.h"
+#include "nrf_802154_spinel_log.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+
+#define TID_BIT(tid) (1UL << (tid))
+
+/// TID of the probe request. No pipelined request awaits a response while probing.
+#define PROBE_TID    NRF_802154_SPINEL_PIPELINE_DEPTH
+
+static volatile bool m_active;           ///< If requests are pipelined.
+static volatile bool m_failed;           ///< If any pipelined request failed.
+static volatile uint32_t m_pending_tids; ///< Bitmask of TIDs of requests awaiting a response.
+
+/// Support of pipelined requests by the network core.
+static volatile nrf_802154_spinel_pipeline_support_t m_support;
+
+/// Properties of the responses awaited by pipelined requests, indexed by TID.
+static spinel_prop_key_t m_awaited_properties[NRF_802154_SPINEL_PIPELINE_DEPTH + 1];
+
+nrf_802154_spinel_pipeline_support_t nrf_802154_spinel_pipeline_support_get(void)
+{
+    return m_support;
+}
+
+spinel_tid_t nrf_802154_spinel_pipeline_probe_begin(void)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_support = NRF_802154_SPINEL_PIPELINE_SUPPORT_PROBING;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return PROBE_TID;
+}
+
+void nrf_802154_spinel_pipeline_probe_end(void)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (m_support == NRF_802154_SPINEL_PIPELINE_SUPPORT_PROBING)
+    {
+        m_support = NRF_802154_SPINEL_PIPELINE_SUPPORT_UNKNOWN;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+bool nrf_802154_spinel_pipeline_begin(void)
+{
+    bool     started   = false;
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (!m_active && (m_support == NRF_802154_SPINEL_PIPELINE_SUPPORT_AVAILABLE))
+    {
+        m_failed = false;
+        m_active = true;
+        started  = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return started;
+}
+
+bool nrf_802154_spinel_pipeline_end(void)
+{
+    bool     failed;
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_spinel_pipeline_flush();
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    failed   = m_failed;
+    m_active = false;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return !failed;
+}
+
+bool nrf_802154_spinel_pipeline_is_active(void)
+{
+    return m_active;
+}
+
+bool nrf_802154_spinel_pipeline_is_pending(void)
+{
+    return m_pending_tids != 0UL;
+}
+
+spinel_tid_t nrf_802154_spinel_pipeline_request_add(spinel_prop_key_t awaited_property)
+{
+    spinel_tid_t tid       = 0U;
+    uint32_t     crit_sect = 0UL;
+
+    if (!m_active)
+    {
+        return 0U;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    for (spinel_tid_t i = 1U; i <= NRF_802154_SPINEL_PIPELINE_DEPTH; i++)
+    {
+        if ((m_pending_tids & TID_BIT(i)) == 0UL)
+        {
+            tid                       = i;
+            m_awaited_properties[tid] = awaited_property;
+            m_pending_tids           |= TID_BIT(tid);
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return tid;
+}
+
+void nrf_802154_spinel_pipeline_flush(void)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (m_pending_tids != 0UL)
+    {
+        m_pending_tids = 0UL;
+        m_failed       = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+bool nrf_802154_spinel_pipeline_response_is_handled(spinel_tid_t      tid,
+                                                    spinel_prop_key_t property)
+{
+    uint32_t crit_sect = 0UL;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if ((m_support == NRF_802154_SPINEL_PIPELINE_SUPPORT_PROBING) &&
+        (property == SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET))
+    {
+        m_support = (tid == PROBE_TID) ? NRF_802154_SPINEL_PIPELINE_SUPPORT_AVAILABLE :
+                    NRF_802154_SPINEL_PIPELINE_SUPPORT_UNAVAILABLE;
+        tid = 0U;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return tid != 0U;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_pipeline_response_process(
+    spinel_tid_t      tid,
+    spinel_prop_key_t property,
+    const void      * p_property_data,
+    size_t            property_data_len)
+{
+    nrf_802154_ser_err_t res;
+    bool                 success   = false;
+    uint32_t             crit_sect = 0UL;
+
+    if ((tid > NRF_802154_SPINEL_PIPELINE_DEPTH) || ((m_pending_tids & TID_BIT(tid)) == 0UL) ||
+        (m_awaited_properties[tid] != property))
+    {
+        NRF_802154_SPINEL_LOG_RAW("Unexpected response: %s(%u), tid %u\n",
+                                  spinel_prop_key_to_cstr(property),
+                                  property,
+                                  tid);
+        return NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+    if (property == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status = SPINEL_STATUS_FAILURE;
+
+        res     = nrf_802154_spinel_decode_prop_last_status(p_property_data,
+                                                            property_data_len,
+                                                            &status);
+        success = (status == SPINEL_STATUS_OK);
+    }
+    else
+    {
+        res = nrf_802154_spinel_decode_prop_generic_bool(p_property_data,
+                                                         property_data_len,
+                                                         &success);
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_pending_tids &= ~TID_BIT(tid);
+
+    if ((res != NRF_802154_SERIALIZATION_ERROR_OK) || !success)
+    {
+        m_failed = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return res;
+}
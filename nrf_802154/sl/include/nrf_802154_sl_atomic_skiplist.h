@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_SL_ATOMIC_SKIPLIST_H__
+#define NRF_802154_SL_ATOMIC_SKIPLIST_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_sl_atomic_list.h"
+#include "nrf_802154_sl_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Type representing an ordered skip list.
+ *
+ * The skip list keeps the same order as @ref nrf_802154_sl_atomic_list_t, but finds the place
+ * of an item in logarithmic instead of linear time. It is intended for lists that hold hundreds
+ * of items, such as pending timers.
+ *
+ * Each item is linked at level 0 and, with decreasing probability, at a number of higher levels
+ * that skip over more and more items. Every modification is committed with an exclusive store
+ * that fails if any other modification of the list was committed since the searched state was
+ * read, as reported by @c bump_counter . In that case the operation searches the list again.
+ * Operations may preempt each other, as the thread mode and interrupt handlers of a single core
+ * do, and none of them disables interrupts.
+ */
+typedef struct
+{
+    /**@brief Pointers to the first item at each level. */
+    void * volatile p_head[NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS];
+    /**@brief Counter incremented every time the list changes. */
+    uint32_t        bump_counter;
+    /**@brief Number of times an operation searched the list again, because it changed. */
+    uint32_t        retries;
+    /**@brief State of the generator of item levels. */
+    uint32_t        random;
+} nrf_802154_sl_atomic_skiplist_t;
+
+/**@brief Structure that needs to be contained in every struct capable of being stored in a skip list.
+ *
+ * It plays the same role as @ref nrf_802154_sl_atomic_list_membership_capability_t . The field
+ * is initialized when the item is inserted to the list.
+ */
+typedef struct
+{
+    void * volatile p_next[NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS];
+} nrf_802154_sl_atomic_skiplist_membership_capability_t;
+
+/**@brief Initializes an empty skip list.
+ *
+ * Any API function for skip list manipulation is forbidden before call to this function.
+ *
+ * @param p_list    Pointer to the skip list to initialize.
+ */
+void nrf_802154_sl_atomic_skiplist_init(nrf_802154_sl_atomic_skiplist_t * p_list);
+
+/**@brief Atomically inserts an item to a skip list.
+ *
+ * The item is inserted after all items for which compare_func(p_item, entry) does not return -1,
+ * as in @ref nrf_802154_sl_atomic_list_insert_ordered . An item must not be inserted if it is
+ * already a member of the list.
+ *
+ * @param p_list                         Pointer to the skip list the item is to be inserted.
+ * @param p_item                         Pointer to the item to add.
+ * @param offsetof_membership_capability Offset of @ref nrf_802154_sl_atomic_skiplist_membership_capability_t
+ *                                       structure to be used to build the list.
+ * @param compare_func                   Pointer to a function that determines the order in the list.
+ */
+void nrf_802154_sl_atomic_skiplist_insert_ordered(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    void                            * p_item,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func);
+
+/**@brief Atomically removes an item from a skip list.
+ *
+ * Unlike @ref nrf_802154_sl_atomic_list_remove , the function needs the compare function
+ * to find the item. The order of the item must not change while it is a member of the list.
+ *
+ * @param p_list                         Pointer to the skip list from which the item is to be removed.
+ * @param p_item                         Pointer to the item to be removed from the list.
+ * @param offsetof_membership_capability Offset of @ref nrf_802154_sl_atomic_skiplist_membership_capability_t
+ *                                       structure to be used to build the list.
+ * @param compare_func                   Pointer to the function used to insert the item.
+ *
+ * @retval true     The item was found in the list and has been removed.
+ * @retval false    The item was not a member of the list, has been not removed.
+ */
+bool nrf_802154_sl_atomic_skiplist_remove(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    void                            * p_item,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func);
+
+/**@brief Peeks at the value of skip list head.
+ *
+ * @param p_list  Pointer to the skip list to peek at.
+ *
+ * @returns Pointer of list head.
+ */
+void * nrf_802154_sl_atomic_skiplist_head_peek(nrf_802154_sl_atomic_skiplist_t * p_list);
+
+/**@brief Atomically removes the head item from a skip list if the head item meets user-defined
+ *        criteria.
+ *
+ * @param p_list                         Pointer to a skip list from which the item is to be removed.
+ * @param offsetof_membership_capability Offset of @ref nrf_802154_sl_atomic_skiplist_membership_capability_t
+ *                                       structure to be used to build the list.
+ * @param compare_func                   Pointer to the function used to insert the items.
+ * @param checker_func                   Pointer to a function to be called to determine if an head
+ *                                       item should be removed.
+ * @param p_checker_func_param           Parameter passed to @p checker_func
+ *
+ * @retval NULL when there was no head item or the head item didn't pass criteria imposed by
+ *              @p checker_func .
+ * @retval other Pointer to the removed item.
+ */
+void * nrf_802154_sl_atomic_skiplist_remove_head_if_criteria_met(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func,
+    nrf_802154_sl_checker_func_t      checker_func,
+    const void                      * p_checker_func_param);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SL_ATOMIC_SKIPLIST_H__
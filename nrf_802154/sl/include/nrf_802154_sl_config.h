@@ -81,4 +81,21 @@
 #endif
 #endif
 
+/**
+ * @def NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS
+ *
+ * The number of levels of the skip lists implemented in nrf_802154_sl_atomic_skiplist.c.
+ *
+ * Each level links about a quarter of the items of the level below, so the skip lists find
+ * the place of an item in logarithmic time as long as they hold less than about 4 to the power
+ * of this value items. Every item stores a pointer for each level.
+ *
+ * The timer implementation in the open-source service layer keeps the pending timers in a skip
+ * list, with the pointers stored in the private fields of @ref nrf_802154_sl_timer_t. These fit
+ * at most 4 levels.
+ */
+#ifndef NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS
+#define NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS 4
+#endif
+
 #endif // NRF_802154_SL_CONFIG_H__
@@ -50,6 +50,34 @@
  *   - [ 32 .. 39 ] for global events in 802.15.4 MPSL
  *   - [ 40 .. 63 ] for global events in 802.15.4 SL
  *
+ * Each log record is a single word of the log buffer:
+ * - bit 31: parity of the lap of the log buffer in which the record was written,
+ * - bits 30-28: type of the record (NRF_802154_LOG_TYPE_..),
+ * - bits 27-22: module id,
+ * - bits 21-16: event id, for the event records,
+ * - bits 15-0: parameter of the event, or bits 19-0: address of the function, for the
+ *   function entry and exit records.
+ *
+ * @c gp_nrf_802154_sl_log_ptr counts the records written since the start, so the record
+ * with the index @c n is stored in the word <tt>n % NRF_802154_SL_DEBUG_LOG_BUFFER_LEN</tt>.
+ * A slot for a record is reserved with an exclusive increment of the counter, and only the
+ * reserving context writes to it. A slot reserved, but not written yet, holds a record
+ * with the parity of the previous lap, so it is recognized and skipped by the
+ * @c nrf_802154_sl_log_decode.py script, which decodes a memory dump of the log buffer.
+ *
+ * The prebuilt service layer library is built with the debug log disabled. It does not write
+ * any records, and only defines @c g_nrf_802154_sl_log_buffer, @c gp_nrf_802154_sl_log_ptr
+ * and an empty @ref nrf_802154_sl_log_init, so all the records in the buffer are written by
+ * modules built with this header. A service layer library built with an earlier version of
+ * this header and with the debug log enabled must not be linked, as it writes the records
+ * at @c gp_nrf_802154_sl_log_ptr without the lap parity and without wrapping the counter.
+ * The prebuilt library defines the buffer with 1024 records, so
+ * @ref NRF_802154_SL_DEBUG_LOG_BUFFER_LEN must keep its default value when it is linked.
+ *
+ * Records can be filtered out at compile time by the module id (@ref NRF_802154_SL_LOG_MODULES_MASK)
+ * and by the event id (@ref NRF_802154_SL_LOG_LOCAL_EVENTS_MASK and
+ * @ref NRF_802154_SL_LOG_GLOBAL_EVENTS_MASK). A filtered out record does not generate any code.
+ *
  */
 
 #ifndef NRF_802154_SL_LOG_H__
@@ -74,12 +102,13 @@
  *
  * Setting this macro to 1 has following consequences:
  * - Interrupts are automatically disabled during write to log buffer. This ensures
- *   thread-safety and always coherent log.
+ *   that the records are written to the log buffer in the order of their slots.
  * - Higher priority interrupts may be delayed, so logging has impact on timing.
  *
  * Setting this macro to 0 has following consequences:
- * - Interrupts are NOT disabled during write to log buffer. This may lead to missing
- *   logs if higher priority interrupt preempts current write log operation.
+ * - Interrupts are NOT disabled during write to log buffer. A record whose write is
+ *   preempted by a higher priority interrupt is written when the write resumes,
+ *   after the records of the interrupt that reserved their slots later.
  * - Logging does not introduce delay to execution of higher priority interrupts.
  */
 #ifndef NRF_802154_SL_DEBUG_LOG_BLOCKS_INTERRUPTS
@@ -96,6 +125,34 @@
 #define NRF_802154_SL_LOG_VERBOSITY   NRF_802154_LOG_VERBOSITY_LOW
 #endif
 
+/**@def NRF_802154_SL_LOG_MODULES_MASK
+ * @brief Bit mask of the module ids whose logs are recorded.
+ *
+ * The bit @c n enables the logs of the module with the id @c n.
+ */
+#ifndef NRF_802154_SL_LOG_MODULES_MASK
+#define NRF_802154_SL_LOG_MODULES_MASK        UINT64_MAX
+#endif
+
+/**@def NRF_802154_SL_LOG_LOCAL_EVENTS_MASK
+ * @brief Bit mask of the ids of the local events that are recorded.
+ *
+ * The bit @c n enables the local event with the id @c n. Define this macro in your @c .c file
+ * before inclusion of @c nrf_802154_sl_log.h to select the local events per-module basis.
+ */
+#ifndef NRF_802154_SL_LOG_LOCAL_EVENTS_MASK
+#define NRF_802154_SL_LOG_LOCAL_EVENTS_MASK   UINT64_MAX
+#endif
+
+/**@def NRF_802154_SL_LOG_GLOBAL_EVENTS_MASK
+ * @brief Bit mask of the ids of the global events that are recorded.
+ *
+ * The bit @c n enables the global event with the id @c n.
+ */
+#ifndef NRF_802154_SL_LOG_GLOBAL_EVENTS_MASK
+#define NRF_802154_SL_LOG_GLOBAL_EVENTS_MASK  UINT64_MAX
+#endif
+
 #define NRF_802154_LOG_VERBOSITY_NONE 0
 #define NRF_802154_LOG_VERBOSITY_LOW  1
 #define NRF_802154_LOG_VERBOSITY_HIGH 2
@@ -136,30 +193,50 @@
 #define nrf_802154_sl_log_verbosity_allows(verbosity) \
     (((verbosity) > 0) && ((verbosity) <= NRF_802154_SL_LOG_VERBOSITY))
 
+/**@brief Checks if the bit of the provided @p id is set in the provided @p mask. */
+#define nrf_802154_sl_log_mask_allows(mask, id) \
+    (((uint64_t)(mask) >> ((uint32_t)(id) & 63U)) & 1U)
+
+/**@brief Checks if the module has its logs recorded. */
+#define nrf_802154_sl_log_module_allows() \
+    nrf_802154_sl_log_mask_allows(NRF_802154_SL_LOG_MODULES_MASK, NRF_802154_MODULE_ID)
+
 #if !defined(CU_TEST) && (NRF_802154_SL_ENABLE_DEBUG_LOG)
 
+#include <nrfx.h>
+
+#if (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN & (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U)) != 0U
+#error "NRF_802154_SL_DEBUG_LOG_BUFFER_LEN must be a power of 2"
+#endif
+
 extern volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
 extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 
 /**@brief Writes one word into debug log buffer. */
-#define nrf_802154_sl_debug_log_write_raw(value)                                                \
-    do                                                                                          \
-    {                                                                                           \
-        uint32_t nrf_802154_sl_debug_log_wr_raw_value = (value);                                \
-                                                                                                \
-        nrf_802154_sl_debug_log_saved_interrupt_st_variable(nrf_802154_sl_debug_log_wr_raw_sv); \
-        nrf_802154_sl_debug_log_disable_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);          \
-                                                                                                \
-        uint32_t nrf_802154_sl_debug_log_write_raw_ptr = gp_nrf_802154_sl_log_ptr;              \
-                                                                                                \
-        g_nrf_802154_sl_log_buffer[nrf_802154_sl_debug_log_write_raw_ptr] =                     \
-            nrf_802154_sl_debug_log_wr_raw_value;                                               \
-        nrf_802154_sl_debug_log_write_raw_ptr += 1U;                                            \
-        nrf_802154_sl_debug_log_write_raw_ptr &= (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U);     \
-        gp_nrf_802154_sl_log_ptr               = nrf_802154_sl_debug_log_write_raw_ptr;         \
-                                                                                                \
-        nrf_802154_sl_debug_log_restore_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);          \
-    }                                                                                           \
+#define nrf_802154_sl_debug_log_write_raw(value)                                                 \
+    do                                                                                           \
+    {                                                                                            \
+        uint32_t nrf_802154_sl_debug_log_wr_raw_value = (value);                                 \
+        uint32_t nrf_802154_sl_debug_log_write_raw_ptr;                                          \
+                                                                                                 \
+        nrf_802154_sl_debug_log_saved_interrupt_st_variable(nrf_802154_sl_debug_log_wr_raw_sv);  \
+        nrf_802154_sl_debug_log_disable_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);           \
+                                                                                                 \
+        do                                                                                       \
+        {                                                                                        \
+            nrf_802154_sl_debug_log_write_raw_ptr = __LDREXW(&gp_nrf_802154_sl_log_ptr);         \
+        }                                                                                        \
+        while (__STREXW(nrf_802154_sl_debug_log_write_raw_ptr + 1U, &gp_nrf_802154_sl_log_ptr)); \
+                                                                                                 \
+        nrf_802154_sl_debug_log_wr_raw_value |=                                                  \
+            ((nrf_802154_sl_debug_log_write_raw_ptr / NRF_802154_SL_DEBUG_LOG_BUFFER_LEN) & 1U)  \
+            << NRF_802154_SL_DEBUG_LOG_LAP_BITPOS;                                               \
+        g_nrf_802154_sl_log_buffer[nrf_802154_sl_debug_log_write_raw_ptr &                       \
+                                   (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U)] =                  \
+            nrf_802154_sl_debug_log_wr_raw_value;                                                \
+                                                                                                 \
+        nrf_802154_sl_debug_log_restore_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);           \
+    }                                                                                            \
     while (0)
 
 #else // !defined(CU_TEST) && (NRF_802154_SL_ENABLE_DEBUG_LOG)
@@ -176,7 +253,7 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
  * @brief Types of log entries.
  *
  * Value 0 is reserved and can't be used (reserved for empty log entry).
- * Allowed values are in range [ 1 .. 15 ].
+ * Allowed values are in range [ 1 .. 7 ].
  *
  * @{
  */
@@ -188,6 +265,9 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
  *@}
  **/
 
+/**@brief Bit shift of field "lap parity" in log word. */
+#define NRF_802154_SL_DEBUG_LOG_LAP_BITPOS       31
+
 /**@brief Bit shift of field "log type" in log word. */
 #define NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS      28
 
@@ -204,7 +284,8 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 #define nrf_802154_sl_log_function_enter(verbosity)                                             \
     do                                                                                          \
     {                                                                                           \
-        if (nrf_802154_sl_log_verbosity_allows(verbosity))                                      \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity) &&                                    \
+            nrf_802154_sl_log_module_allows())                                                  \
         {                                                                                       \
             nrf_802154_sl_debug_log_write_raw(                                                  \
                 ((NRF_802154_LOG_TYPE_FUNCTION_ENTER) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) | \
@@ -221,7 +302,8 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 #define nrf_802154_sl_log_function_exit(verbosity)                                             \
     do                                                                                         \
     {                                                                                          \
-        if (nrf_802154_sl_log_verbosity_allows(verbosity))                                     \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity) &&                                   \
+            nrf_802154_sl_log_module_allows())                                                 \
         {                                                                                      \
             nrf_802154_sl_debug_log_write_raw(                                                 \
                 ((NRF_802154_LOG_TYPE_FUNCTION_EXIT) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) | \
@@ -240,18 +322,20 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
  *                              of the parameter is defined by the module in which
  *                              the log is recorded and @p local_event_id.
  */
-#define nrf_802154_sl_log_local_event(verbosity, local_event_id, param_u16)                  \
-    do                                                                                       \
-    {                                                                                        \
-        if (nrf_802154_sl_log_verbosity_allows(verbosity))                                   \
-        {                                                                                    \
-            nrf_802154_sl_debug_log_write_raw(                                               \
-                ((NRF_802154_LOG_TYPE_LOCAL_EVENT) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) | \
-                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |       \
-                (((uint32_t)(local_event_id)) << NRF_802154_SL_DEBUG_LOG_EVENT_ID_BITPOS) |  \
-                ((uint16_t)(param_u16) << 0));                                               \
-        }                                                                                    \
-    }                                                                                        \
+#define nrf_802154_sl_log_local_event(verbosity, local_event_id, param_u16)                     \
+    do                                                                                          \
+    {                                                                                           \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity) &&                                    \
+            nrf_802154_sl_log_module_allows() &&                                                \
+            nrf_802154_sl_log_mask_allows(NRF_802154_SL_LOG_LOCAL_EVENTS_MASK, local_event_id)) \
+        {                                                                                       \
+            nrf_802154_sl_debug_log_write_raw(                                                  \
+                ((NRF_802154_LOG_TYPE_LOCAL_EVENT) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |    \
+                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |          \
+                (((uint32_t)(local_event_id)) << NRF_802154_SL_DEBUG_LOG_EVENT_ID_BITPOS) |     \
+                ((uint16_t)(param_u16) << 0));                                                  \
+        }                                                                                       \
+    }                                                                                           \
     while (0)
 
 /**@brief Records log about event (with parameter) related to global resource.
@@ -261,18 +345,20 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
  * @param[in] param_u16     Additional parameter to be logged with event. Meaning
  *                          of the parameter is defined by value of @p global_event_id.
  */
-#define nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16)                 \
-    do                                                                                        \
-    {                                                                                         \
-        if (nrf_802154_sl_log_verbosity_allows(verbosity))                                    \
-        {                                                                                     \
-            nrf_802154_sl_debug_log_write_raw(                                                \
-                ((NRF_802154_LOG_TYPE_GLOBAL_EVENT) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) | \
-                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |        \
-                (((uint32_t)(global_event_id)) << NRF_802154_SL_DEBUG_LOG_EVENT_ID_BITPOS) |  \
-                ((uint16_t)(param_u16) << 0));                                                \
-        }                                                                                     \
-    }                                                                                         \
+#define nrf_802154_sl_log_global_event(verbosity, global_event_id, param_u16)                     \
+    do                                                                                            \
+    {                                                                                             \
+        if (nrf_802154_sl_log_verbosity_allows(verbosity) &&                                      \
+            nrf_802154_sl_log_module_allows() &&                                                  \
+            nrf_802154_sl_log_mask_allows(NRF_802154_SL_LOG_GLOBAL_EVENTS_MASK, global_event_id)) \
+        {                                                                                         \
+            nrf_802154_sl_debug_log_write_raw(                                                    \
+                ((NRF_802154_LOG_TYPE_GLOBAL_EVENT) << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |     \
+                ((NRF_802154_MODULE_ID) << NRF_802154_SL_DEBUG_LOG_MODULE_ID_BITPOS) |            \
+                (((uint32_t)(global_event_id)) << NRF_802154_SL_DEBUG_LOG_EVENT_ID_BITPOS) |      \
+                ((uint16_t)(param_u16) << 0));                                                    \
+        }                                                                                         \
+    }                                                                                             \
     while (0)
 
 /**@brief Helper macro for defining one element of the list of local events.
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements an ordered skip list modified without critical sections.
+ *
+ */
+
+#include "nrf_802154_sl_atomic_skiplist.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <nrfx.h>
+
+#include "nrf_802154_sl_atomics.h"
+
+#define LEVELS      NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS
+#define RANDOM_SEED 0x2545F491UL
+
+typedef nrf_802154_sl_atomic_skiplist_membership_capability_t capability_t;
+
+/**@brief Position in a skip list found by a search. */
+typedef struct
+{
+    /**@brief Item preceding the position at each level or NULL for the list head. */
+    void * p_pred[LEVELS];
+    /**@brief Item following the position at each level or NULL for the list end. */
+    void * p_succ[LEVELS];
+} position_t;
+
+static inline capability_t * capability_get(void * p_item, size_t offset)
+{
+    return (capability_t *)((uint8_t *)p_item + offset);
+}
+
+/**
+ * @brief Gets the pointer to the next item at given level.
+ *
+ * @param[in]  p_list  Pointer to the skip list.
+ * @param[in]  p_pred  Pointer to the item the pointer belongs to, NULL for the list head.
+ * @param[in]  offset  Offset of the membership capability within the item.
+ * @param[in]  level   Level of the pointer.
+ */
+static inline void * volatile * next_slot_get(nrf_802154_sl_atomic_skiplist_t * p_list,
+                                              void                            * p_pred,
+                                              size_t                            offset,
+                                              uint32_t                          level)
+{
+    return (p_pred == NULL) ? &p_list->p_head[level] :
+           &capability_get(p_pred, offset)->p_next[level];
+}
+
+static inline bool list_unchanged(nrf_802154_sl_atomic_skiplist_t * p_list, uint32_t bump)
+{
+    return *(volatile uint32_t *)&p_list->bump_counter == bump;
+}
+
+/**
+ * @brief Stores a pointer if it was not changed and the list did not change.
+ *
+ * Any exception taken between the exclusive load and the exclusive store makes the store fail.
+ * As every other modification of the list is made by an operation that preempts this one,
+ * no modification can take place between the checks and the store.
+ *
+ * @param[in]  p_list      Pointer to the skip list.
+ * @param[in]  p_slot      Pointer to the pointer to store.
+ * @param[in]  p_expected  Expected value of the pointer.
+ * @param[in]  p_desired   New value of the pointer.
+ * @param[in]  bump        Expected value of the list bump counter.
+ *
+ * @retval true   The pointer has been stored.
+ * @retval false  The pointer or the list has been changed, the pointer has not been stored.
+ */
+static bool guarded_store(nrf_802154_sl_atomic_skiplist_t * p_list,
+                          void * volatile                 * p_slot,
+                          void                            * p_expected,
+                          void                            * p_desired,
+                          uint32_t                          bump)
+{
+    __DMB();
+
+    do
+    {
+        void * p_value = (void *)(uintptr_t)__LDREXW((volatile uint32_t *)p_slot);
+
+        if ((p_value != p_expected) || !list_unchanged(p_list, bump))
+        {
+            __CLREX();
+            return false;
+        }
+    }
+    while (__STREXW((uintptr_t)p_desired, (volatile uint32_t *)p_slot));
+
+    __DMB();
+
+    return true;
+}
+
+/**
+ * @brief Increments the list bump counter after a modification.
+ *
+ * @param[in]    p_list  Pointer to the skip list.
+ * @param[inout] p_bump  Value of the bump counter that the modification was guarded with.
+ *                       Incremented if the function succeeds.
+ *
+ * @retval true   The bump counter has been incremented.
+ * @retval false  Another operation modified the list after the modification.
+ */
+static bool bump_advance(nrf_802154_sl_atomic_skiplist_t * p_list, uint32_t * p_bump)
+{
+    uint32_t expected = *p_bump;
+
+    if (!nrf_802154_sl_atomic_cas_u32(&p_list->bump_counter, &expected, expected + 1))
+    {
+        return false;
+    }
+
+    (*p_bump)++;
+
+    return true;
+}
+
+static void retry_count(nrf_802154_sl_atomic_skiplist_t * p_list)
+{
+    nrf_802154_sl_atomic_add_u32(&p_list->retries, 1);
+}
+
+/**
+ * @brief Draws the number of levels of a new item, with a probability of 1/4 for each next level.
+ *
+ * Concurrent calls may draw the same value, which does not affect the correctness of the list.
+ */
+static uint32_t levels_draw(nrf_802154_sl_atomic_skiplist_t * p_list)
+{
+    uint32_t random = p_list->random;
+    uint32_t levels = 1;
+
+    random        ^= random << 13;
+    random        ^= random >> 17;
+    random        ^= random << 5;
+    p_list->random = random;
+
+    while ((levels < LEVELS) && ((random & 3) == 0))
+    {
+        levels++;
+        random >>= 2;
+    }
+
+    return levels;
+}
+
+/**
+ * @brief Finds the position after all items that precede an item or are equal to it.
+ *
+ * @retval true   The position has been found.
+ * @retval false  The list changed during the search.
+ */
+static bool insert_position_find(nrf_802154_sl_atomic_skiplist_t * p_list,
+                                 void                            * p_item,
+                                 size_t                            offset,
+                                 nrf_802154_sl_compare_func_t      compare_func,
+                                 uint32_t                          bump,
+                                 position_t                      * p_pos)
+{
+    void * p_pred = NULL;
+
+    for (int32_t level = LEVELS - 1; level >= 0; level--)
+    {
+        void * p_succ = *next_slot_get(p_list, p_pred, offset, level);
+
+        while ((p_succ != NULL) && (compare_func(p_item, p_succ) >= 0))
+        {
+            if (!list_unchanged(p_list, bump))
+            {
+                return false;
+            }
+
+            p_pred = p_succ;
+            p_succ = *next_slot_get(p_list, p_pred, offset, level);
+        }
+
+        p_pos->p_pred[level] = p_pred;
+        p_pos->p_succ[level] = p_succ;
+    }
+
+    return list_unchanged(p_list, bump);
+}
+
+/**
+ * @brief Finds the items that precede an item at each level.
+ *
+ * At the levels at which the item is not linked, the preceding item is set to the item itself.
+ *
+ * @retval true   The search has been completed.
+ * @retval false  The list changed during the search.
+ */
+static bool item_position_find(nrf_802154_sl_atomic_skiplist_t * p_list,
+                               void                            * p_item,
+                               size_t                            offset,
+                               nrf_802154_sl_compare_func_t      compare_func,
+                               uint32_t                          bump,
+                               position_t                      * p_pos)
+{
+    void * p_pred = NULL;
+
+    for (int32_t level = LEVELS - 1; level >= 0; level--)
+    {
+        void * p_succ = *next_slot_get(p_list, p_pred, offset, level);
+        void * p_equal;
+
+        while ((p_succ != NULL) && (compare_func(p_succ, p_item) < 0))
+        {
+            if (!list_unchanged(p_list, bump))
+            {
+                return false;
+            }
+
+            p_pred = p_succ;
+            p_succ = *next_slot_get(p_list, p_pred, offset, level);
+        }
+
+        // Items equal to the searched one may precede it. The search continues at the lower
+        // level from the last item that precedes all of them.
+        p_equal = p_pred;
+
+        while ((p_succ != NULL) && (p_succ != p_item) && (compare_func(p_succ, p_item) == 0))
+        {
+            if (!list_unchanged(p_list, bump))
+            {
+                return false;
+            }
+
+            p_equal = p_succ;
+            p_succ  = *next_slot_get(p_list, p_equal, offset, level);
+        }
+
+        if (p_succ == p_item)
+        {
+            p_pos->p_pred[level] = p_equal;
+            p_pos->p_succ[level] = capability_get(p_item, offset)->p_next[level];
+        }
+        else
+        {
+            p_pos->p_pred[level] = p_item;
+            p_pos->p_succ[level] = NULL;
+        }
+    }
+
+    return list_unchanged(p_list, bump);
+}
+
+void nrf_802154_sl_atomic_skiplist_init(nrf_802154_sl_atomic_skiplist_t * p_list)
+{
+    for (uint32_t level = 0; level < LEVELS; level++)
+    {
+        p_list->p_head[level] = NULL;
+    }
+
+    p_list->bump_counter = 0;
+    p_list->retries      = 0;
+    p_list->random       = RANDOM_SEED;
+}
+
+void nrf_802154_sl_atomic_skiplist_insert_ordered(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    void                            * p_item,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func)
+{
+    capability_t * p_cap  = capability_get(p_item, offsetof_membership_capability);
+    uint32_t       levels = levels_draw(p_list);
+    position_t     pos;
+    uint32_t       bump;
+
+    while (true)
+    {
+        bump = nrf_802154_sl_atomic_load_u32(&p_list->bump_counter);
+
+        if (insert_position_find(p_list, p_item, offsetof_membership_capability, compare_func,
+                                 bump, &pos))
+        {
+            for (uint32_t level = 0; level < LEVELS; level++)
+            {
+                p_cap->p_next[level] = (level < levels) ? pos.p_succ[level] : NULL;
+            }
+
+            if (guarded_store(p_list,
+                              next_slot_get(p_list, pos.p_pred[0],
+                                            offsetof_membership_capability, 0),
+                              pos.p_succ[0],
+                              p_item,
+                              bump))
+            {
+                break;
+            }
+        }
+
+        retry_count(p_list);
+    }
+
+    // The item is a member of the list now. It is linked at the higher levels bottom-up, as long
+    // as no other operation modifies the list. Otherwise it is left linked at fewer levels, which
+    // only makes the searches slightly longer.
+    for (uint32_t level = 1; bump_advance(p_list, &bump) && (level < levels); level++)
+    {
+        if (!guarded_store(p_list,
+                           next_slot_get(p_list, pos.p_pred[level],
+                                         offsetof_membership_capability, level),
+                           pos.p_succ[level],
+                           p_item,
+                           bump))
+        {
+            break;
+        }
+    }
+}
+
+bool nrf_802154_sl_atomic_skiplist_remove(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    void                            * p_item,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func)
+{
+    position_t pos;
+    uint32_t   bump;
+    int32_t    level;
+
+    while (true)
+    {
+        bump = nrf_802154_sl_atomic_load_u32(&p_list->bump_counter);
+
+        if (item_position_find(p_list, p_item, offsetof_membership_capability, compare_func,
+                               bump, &pos))
+        {
+            if (pos.p_pred[0] == p_item)
+            {
+                // The item is linked at level 0 until it is removed.
+                return false;
+            }
+
+            // The item is unlinked top-down, so that it is a member of the list until it is
+            // unlinked at level 0.
+            for (level = LEVELS - 1; level >= 0; level--)
+            {
+                if (pos.p_pred[level] == p_item)
+                {
+                    continue;
+                }
+
+                if (!guarded_store(p_list,
+                                   next_slot_get(p_list, pos.p_pred[level],
+                                                 offsetof_membership_capability, level),
+                                   p_item,
+                                   pos.p_succ[level],
+                                   bump))
+                {
+                    break;
+                }
+
+                if (!bump_advance(p_list, &bump) && (level > 0))
+                {
+                    break;
+                }
+            }
+
+            if (level < 0)
+            {
+                return true;
+            }
+        }
+
+        retry_count(p_list);
+    }
+}
+
+void * nrf_802154_sl_atomic_skiplist_head_peek(nrf_802154_sl_atomic_skiplist_t * p_list)
+{
+    return p_list->p_head[0];
+}
+
+void * nrf_802154_sl_atomic_skiplist_remove_head_if_criteria_met(
+    nrf_802154_sl_atomic_skiplist_t * p_list,
+    size_t                            offsetof_membership_capability,
+    nrf_802154_sl_compare_func_t      compare_func,
+    nrf_802154_sl_checker_func_t      checker_func,
+    const void                      * p_checker_func_param)
+{
+    void * p_head;
+
+    // The removal fails only if another operation removed the head in the meantime.
+    do
+    {
+        p_head = p_list->p_head[0];
+
+        if ((p_head == NULL) || !checker_func(p_head, p_checker_func_param))
+        {
+            return NULL;
+        }
+    }
+    while (!nrf_802154_sl_atomic_skiplist_remove(p_list,
+                                                 p_head,
+                                                 offsetof_membership_capability,
+                                                 compare_func));
+
+    return p_head;
+}
@@ -40,7 +40,8 @@
 volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
 
 /**
- * @brief Index of the log buffer pointing to the element that should be filled with next log message.
+ * @brief Number of log messages written since the start. The next log message is written to
+ *        the element of the log buffer at this index modulo the buffer length.
  */
 volatile uint32_t gp_nrf_802154_sl_log_ptr = 0;
 
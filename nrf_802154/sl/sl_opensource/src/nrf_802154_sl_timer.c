@@ -40,11 +40,62 @@
 #include <zephyr/kernel.h>
 
 #include "nrf_802154_sl_timer.h"
+#include "nrf_802154_sl_atomic_skiplist.h"
+
+/* Pending timers are kept in a skip list ordered by the trigger time. The membership capability
+ * is stored in the private fields of the timer. The kernel timer is armed for the list head.
+ */
+#define TIMER_CAP_OFFSET offsetof(nrf_802154_sl_timer_t, priv)
+
+BUILD_ASSERT(sizeof(nrf_802154_sl_atomic_skiplist_membership_capability_t) <=
+             sizeof(nrf_802154_sl_timer_priv_placeholder_t),
+             "Reduce NRF_802154_SL_ATOMIC_SKIPLIST_LEVELS to fit the private fields of a timer");
 
 static void timeout_handler(struct k_timer * timer_id);
 
 K_TIMER_DEFINE(timer, timeout_handler, NULL);
 
+static nrf_802154_sl_atomic_skiplist_t m_timers;
+
+static int_fast8_t timer_compare(const void * p_a, const void * p_b)
+{
+    uint64_t a = ((const nrf_802154_sl_timer_t *)p_a)->trigger_time;
+    uint64_t b = ((const nrf_802154_sl_timer_t *)p_b)->trigger_time;
+
+    return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static bool timer_is_due(const void * p_item, const void * p_param)
+{
+    return ((const nrf_802154_sl_timer_t *)p_item)->trigger_time <= *(const uint64_t *)p_param;
+}
+
+/* Arms the kernel timer for the earliest pending timer, or stops it if no timer is pending.
+ * The head is read and the kernel timer is started with interrupts locked, so that the kernel
+ * timer is never left armed for a head that was replaced by a preempting context.
+ */
+static void timer_rearm(void)
+{
+    unsigned int key = irq_lock();
+
+    const nrf_802154_sl_timer_t * p_head = nrf_802154_sl_atomic_skiplist_head_peek(&m_timers);
+
+    if (p_head == NULL)
+    {
+        k_timer_stop(&timer);
+    }
+    else
+    {
+        int64_t target = (int64_t)(p_head->trigger_time - nrf_802154_sl_timer_current_time_get());
+
+        target = MAX(target, 1);
+
+        k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    }
+
+    irq_unlock(key);
+}
+
 void nrf_802154_timer_coord_init(void)
 {
     // Intentionally empty
@@ -67,12 +118,13 @@ void nrf_802154_timer_coord_stop(void)
 
 void nrf_802154_sl_timer_module_init(void)
 {
-    // Intentionally empty
+    nrf_802154_sl_atomic_skiplist_init(&m_timers);
 }
 
 void nrf_802154_sl_timer_module_uninit(void)
 {
-    // Intentionally empty
+    k_timer_stop(&timer);
+    nrf_802154_sl_atomic_skiplist_init(&m_timers);
 }
 
 uint64_t nrf_802154_sl_timer_current_time_get(void)
@@ -105,13 +157,15 @@ nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_time
         return NRF_802154_SL_TIMER_RET_BAD_REQUEST;
     }
 
-    uint64_t now    = nrf_802154_sl_timer_current_time_get();
-    int32_t  target = p_timer->trigger_time - now;
-
-    target = MAX(target, 1);
+    nrf_802154_sl_atomic_skiplist_insert_ordered(&m_timers,
+                                                 p_timer,
+                                                 TIMER_CAP_OFFSET,
+                                                 timer_compare);
 
-    k_timer_user_data_set(&timer, p_timer); // Passing arguments is not supported.
-    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    if (nrf_802154_sl_atomic_skiplist_head_peek(&m_timers) == p_timer)
+    {
+        timer_rearm();
+    }
 
     return NRF_802154_SL_TIMER_RET_SUCCESS;
 }
@@ -123,38 +177,37 @@ nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_t
         return NRF_802154_SL_TIMER_RET_BAD_REQUEST;
     }
 
-    if (k_timer_status_get(&timer) > 0)
+    if (!nrf_802154_sl_atomic_skiplist_remove(&m_timers,
+                                              p_timer,
+                                              TIMER_CAP_OFFSET,
+                                              timer_compare))
     {
-        /* Timer has expired. */
+        /* Timer has expired or was not added. */
         return NRF_802154_SL_TIMER_RET_INACTIVE;
     }
 
-    if (k_timer_remaining_get(&timer) == 0)
-    {
-        /* Timer was stopped (by someone else) before expiring. */
-        return NRF_802154_SL_TIMER_RET_INACTIVE;
-    }
-
-    /* Timer is still running. */
-    k_timer_stop(&timer);
+    timer_rearm();
 
     return NRF_802154_SL_TIMER_RET_SUCCESS;
 }
 
 static void timeout_handler(struct k_timer * timer_id)
 {
-    nrf_802154_sl_timer_t * p_timer =
-        (nrf_802154_sl_timer_t *)k_timer_user_data_get(timer_id);
+    uint64_t                now = nrf_802154_sl_timer_current_time_get();
+    nrf_802154_sl_timer_t * p_timer;
 
-    if (p_timer == NULL)
-    {
-        return;
-    }
+    (void)timer_id;
 
-    if (p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK)
+    while ((p_timer = nrf_802154_sl_atomic_skiplist_remove_head_if_criteria_met(
+                &m_timers, TIMER_CAP_OFFSET, timer_compare, timer_is_due, &now)) != NULL)
     {
-        p_timer->action.callback.callback(p_timer);
+        if (p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK)
+        {
+            p_timer->action.callback.callback(p_timer);
+        }
     }
+
+    timer_rearm();
 }
 
 void nrf_802154_platform_sl_lp_timer_init(void)
@@ -15,6 +15,7 @@
 #include <nrf_rpc_common.h>
 #include <nrf_rpc_tr.h>
 #include <nrf_rpc_os.h>
+#include <nrf_rpc_stats.h>
 
 /**
  * @defgroup nrf_rpc nRF RPC (Remote Procedure Calls) module.
@@ -55,6 +56,7 @@ enum nrf_rpc_packet_type {
 	NRF_RPC_PACKET_TYPE_ACK  = 0x02, /**< @brief Event acknowledge */
 	NRF_RPC_PACKET_TYPE_ERR  = 0x03, /**< @brief Error report from remote */
 	NRF_RPC_PACKET_TYPE_INIT = 0x04, /**< @brief Initialization packet */
+	NRF_RPC_PACKET_TYPE_EVT_BATCH = 0x05, /**< @brief Batch of events */
 	NRF_RPC_PACKET_TYPE_CMD  = 0x80, /**< @brief Command */
 };
 
@@ -121,12 +123,46 @@ struct _nrf_rpc_decoder {
 	void *handler_data;
 };
 
+#if defined(CONFIG_NRF_RPC_PRIO_LANE) || defined(__DOXYGEN__)
+/* Structure used internally to declare a command or event sent over the priority lane.
+ * The size is a multiple of the pointer size, so that items of the automatically
+ * registered array are contiguous.
+ */
+struct _nrf_rpc_prio_id {
+	uint8_t type;
+	uint8_t id;
+} __attribute__((aligned(sizeof(void *))));
+#endif
+
 /** @brief Group data structure. It contains no constant group data. */
 struct nrf_rpc_group_data {
 	uint8_t src_group_id;
 	uint8_t dst_group_id;
 	struct nrf_rpc_os_event decode_done_event;
 	bool transport_initialized;
+#ifdef CONFIG_NRF_RPC_DECODER_INDEX
+	/* Index of the command decoder in the group's array for each command ID. */
+	uint8_t cmd_index[NRF_RPC_ID_UNKNOWN];
+	/* Index of the event decoder in the group's array for each event ID. */
+	uint8_t evt_index[NRF_RPC_ID_UNKNOWN];
+#endif
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	/* Received batch of events that is currently being decoded. */
+	const uint8_t *batch_packet;
+	size_t batch_len;
+#endif
+#ifdef CONFIG_NRF_RPC_STATS
+	struct nrf_rpc_group_stats stats;
+#endif
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	/* Packet received over the priority transport that is currently being decoded. */
+	const uint8_t *prio_packet;
+	struct nrf_rpc_os_event prio_decode_done_event;
+	bool prio_transport_initialized;
+	/* Bitmaps of command and event IDs sent over the priority transport. */
+	uint32_t prio_cmds[8];
+	uint32_t prio_evts[8];
+#endif
 };
 
 /** @brief Defines a group of commands and events.
@@ -147,6 +183,28 @@ struct nrf_rpc_group {
 	nrf_rpc_err_handler_t err_handler;
 	nrf_rpc_group_bound_handler_t bound_handler;
 	const uint32_t flags;
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	const void *prio_array;
+	const struct nrf_rpc_tr *prio_transport;
+#endif
+};
+
+/** @brief Batch of events.
+ *
+ * Collects events of one group in a single packet, so that they are passed to
+ * the transport with one send operation and acknowledged by the remote with
+ * a single ACK packet.
+ *
+ * Fields of this structure are used internally by nRF RPC and not intended to
+ * be used by the user.
+ */
+struct nrf_rpc_evt_batch {
+	const struct nrf_rpc_group *group;
+	uint8_t *packet;
+	size_t capacity;
+	size_t len;
+	uint8_t count;
+	uint32_t start_us;
 };
 
 /** @brief Error report.
@@ -194,6 +252,19 @@ struct nrf_rpc_cleanup_handler
 	struct nrf_rpc_cleanup_handler *next;
 };
 
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+/* Internal macros adding the priority lane to a group definition. */
+#define _NRF_RPC_GROUP_PRIO_ARR(_name)						  \
+	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _prio_array),			  \
+			 "prio_" NRF_RPC_STRINGIFY(_name));
+#define _NRF_RPC_GROUP_PRIO_INIT(_name, _prio_transport)			  \
+	.prio_array = &NRF_RPC_CONCAT(_name, _prio_array),			  \
+	.prio_transport = _prio_transport,
+#else
+#define _NRF_RPC_GROUP_PRIO_ARR(_name)
+#define _NRF_RPC_GROUP_PRIO_INIT(_name, _prio_transport)
+#endif
+
 /** @brief Internal macro for parametrizing nrf_rpc groups.
  *
  * @param _name          Symbol name of the group.
@@ -220,10 +291,27 @@ struct nrf_rpc_cleanup_handler
 #define NRF_RPC_GROUP_DEFINE_INTERNAL__(_name, _strid, _transport, _ack_handler,  \
 					_ack_data, _err_handler, _bound_handler,  \
 					_wait_on_init, _initiator)	          \
+	NRF_RPC_GROUP_DEFINE_PRIO_INTERNAL__(_name, _strid, _transport, NULL,     \
+					     _ack_handler, _ack_data,		  \
+					     _err_handler, _bound_handler,	  \
+					     _wait_on_init, _initiator)
+
+/** @brief Internal macro for parametrizing nrf_rpc groups with a priority lane.
+ *
+ * The parameters are the same as for @ref NRF_RPC_GROUP_DEFINE_INTERNAL__, and
+ * `_prio_transport` is the transport of the priority lane or NULL. It is ignored
+ * if @kconfig{CONFIG_NRF_RPC_PRIO_LANE} is disabled.
+ */
+#define NRF_RPC_GROUP_DEFINE_PRIO_INTERNAL__(_name, _strid, _transport,	  \
+					     _prio_transport, _ack_handler,	  \
+					     _ack_data, _err_handler,		  \
+					     _bound_handler, _wait_on_init,	  \
+					     _initiator)			  \
 	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _cmd_array),		          \
 			 "cmd_" NRF_RPC_STRINGIFY(_name));		          \
 	NRF_RPC_AUTO_ARR(NRF_RPC_CONCAT(_name, _evt_array),		          \
 			 "evt_" NRF_RPC_STRINGIFY(_name));		          \
+	_NRF_RPC_GROUP_PRIO_ARR(_name)					          \
 										  \
 	static struct nrf_rpc_group_data NRF_RPC_CONCAT(_name, _group_data) = {   \
 		.src_group_id = NRF_RPC_ID_UNKNOWN,                               \
@@ -244,6 +332,7 @@ struct nrf_rpc_cleanup_handler
 		.bound_handler = _bound_handler,				      \
 		.flags = NRF_RPC_FLAG_COND(_wait_on_init, NRF_RPC_FLAGS_WAIT_ON_INIT) \
 		       | NRF_RPC_FLAG_COND(_initiator, NRF_RPC_FLAGS_INITIATOR),      \
+		_NRF_RPC_GROUP_PRIO_INIT(_name, _prio_transport)		      \
 	}
 
 /** @brief Define a group of commands and events.
@@ -267,6 +356,42 @@ struct nrf_rpc_cleanup_handler
 					IS_ENABLED(CONFIG_NRF_RPC_GROUP_DEFAULT_WAIT_ON_INIT),     \
 					IS_ENABLED(CONFIG_NRF_RPC_GROUP_DEFAULT_INITIATOR))
 
+#if defined(CONFIG_NRF_RPC_PRIO_LANE) || defined(__DOXYGEN__)
+
+/** @brief Define a group of commands and events with a priority lane.
+ *
+ * The group works in the same way as a group defined with @ref NRF_RPC_GROUP_DEFINE,
+ * but commands and events declared with @ref NRF_RPC_PRIO_CMD and @ref NRF_RPC_PRIO_EVT
+ * are sent over `_prio_transport`, together with the responses and ACKs to them.
+ * The remote decodes packets received over the priority transport in a separate
+ * thread pool, so they do not wait until the packets received over `_transport`,
+ * for example bulk events, are decoded.
+ *
+ * The group is bound over `_transport` only. The packets are encoded in buffers
+ * allocated from `_transport`, and copied to a buffer of `_prio_transport` when
+ * they are sent over the priority lane. Batches of events always use `_transport`.
+ *
+ * @param _name           Symbol name of the group.
+ * @param _strid          String containing unique identifier of the group.
+ * @param _transport      Group transport.
+ * @param _prio_transport Transport of the priority lane. It must connect to the
+ *                        priority transport of the same group on the remote side.
+ * @param _ack_handler    Handler of type @ref nrf_rpc_ack_handler_t called when
+ *                        ACK was received after event completion. Can be NULL.
+ * @param _ack_data       Opaque pointer for the `_ack_handler`.
+ * @param _err_handler    Handler of type @ref nrf_rpc_err_handler_t called when
+ *                        error occurred in context of this group. Can be NULL.
+ */
+#define NRF_RPC_GROUP_DEFINE_PRIO(_name, _strid, _transport, _prio_transport,	     \
+				  _ack_handler, _ack_data, _err_handler)	     \
+	NRF_RPC_GROUP_DEFINE_PRIO_INTERNAL__(_name, _strid, _transport,		     \
+					     _prio_transport, _ack_handler,	     \
+					     _ack_data, _err_handler, NULL,	     \
+					     IS_ENABLED(CONFIG_NRF_RPC_GROUP_DEFAULT_WAIT_ON_INIT), \
+					     IS_ENABLED(CONFIG_NRF_RPC_GROUP_DEFAULT_INITIATOR))
+
+#endif /* CONFIG_NRF_RPC_PRIO_LANE */
+
 /** @brief Define a non-blocking group of commands and events.
  *
  * The NOWAIT group does not block the @ref nrf_rpc_init until binding completion.
@@ -352,6 +477,49 @@ struct nrf_rpc_cleanup_handler
 		.handler_data = _data,					       \
 	}
 
+#if defined(CONFIG_NRF_RPC_PRIO_LANE) || defined(__DOXYGEN__)
+
+/** @brief Send a command over the priority lane.
+ *
+ * Declares that the local side sends the command over the priority transport of
+ * a group defined with @ref NRF_RPC_GROUP_DEFINE_PRIO. The declaration belongs to
+ * the side that sends the command, and it has no effect if the group has no
+ * priority transport.
+ *
+ * @param _group Group that the command belongs to.
+ * @param _name  Name of the declaration.
+ * @param _cmd   Command id. Can be from 0 to 254.
+ */
+#define NRF_RPC_PRIO_CMD(_group, _name, _cmd)					       \
+	NRF_RPC_STATIC_ASSERT(_cmd <= 0xFE, "Command out of range");	       \
+	NRF_RPC_AUTO_ARR_ITEM(const struct _nrf_rpc_prio_id,		       \
+			      NRF_RPC_CONCAT(_name, _prio_cmd),		       \
+			      "prio_" NRF_RPC_STRINGIFY(_group),		       \
+			      NRF_RPC_STRINGIFY(_name)) = {		       \
+		.type = NRF_RPC_PACKET_TYPE_CMD,				       \
+		.id = _cmd,						       \
+	}
+
+/** @brief Send an event over the priority lane.
+ *
+ * Works in the same way as @ref NRF_RPC_PRIO_CMD, but for an event.
+ *
+ * @param _group Group that the event belongs to.
+ * @param _name  Name of the declaration.
+ * @param _evt   Event id. Can be from 0 to 254.
+ */
+#define NRF_RPC_PRIO_EVT(_group, _name, _evt)					       \
+	NRF_RPC_STATIC_ASSERT(_evt <= 0xFE, "Event out of range");	       \
+	NRF_RPC_AUTO_ARR_ITEM(const struct _nrf_rpc_prio_id,		       \
+			      NRF_RPC_CONCAT(_name, _prio_evt),		       \
+			      "prio_" NRF_RPC_STRINGIFY(_group),		       \
+			      NRF_RPC_STRINGIFY(_name)) = {		       \
+		.type = NRF_RPC_PACKET_TYPE_EVT,				       \
+		.id = _evt,						       \
+	}
+
+#endif /* CONFIG_NRF_RPC_PRIO_LANE */
+
 /** @brief Check group status.
  *
  * Macro checks whether the group and the transport assigned to it have been initialized.
@@ -502,6 +670,35 @@ int nrf_rpc_cmd(const struct nrf_rpc_group *group, uint8_t cmd, uint8_t *packet,
 int nrf_rpc_cmd_rsp(const struct nrf_rpc_group *group, uint8_t cmd, uint8_t *packet,
 		    size_t len, const uint8_t **rsp_packet, size_t *rsp_len);
 
+/** @brief Send a command without waiting for the response.
+ *
+ * The function returns as soon as the command is passed to the transport, so
+ * a single thread can have several commands in flight. Each command occupies
+ * one context from the command context pool until its response is received, so
+ * the number of commands in flight is limited by
+ * @kconfig{CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE}. If no context is available, this
+ * function waits for one.
+ *
+ * The response is matched with the command by the context id and passed to
+ * the `handler`, which is called from the transport receive thread. The handler
+ * must not block and must not send synchronous commands. If the command is
+ * canceled by @ref nrf_rpc_stop, the handler is called with NULL packet.
+ *
+ * @param group        Group that command belongs to.
+ * @param cmd          Command id.
+ * @param packet       Packet allocated by @ref nrf_rpc_alloc_tx_buf and filled with
+ *                     an encoded data.
+ * @param len          Length of the packet. Can be smaller than allocated.
+ * @param handler      Callback that handles the response. It is not called if
+ *                     this function returns an error.
+ * @param handler_data Opaque pointer that will be passed to `handler`.
+ *
+ * @return             0 on success or negative error code if a transport layer
+ *                     reported a sending error.
+ */
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd, uint8_t *packet,
+		      size_t len, nrf_rpc_handler_t handler, void *handler_data);
+
 /** @brief Send a command, provide callback to handle response and pass any
  * error to an error handler.
  *
@@ -569,6 +766,74 @@ int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
 void nrf_rpc_evt_no_err(const struct nrf_rpc_group *group, uint8_t evt,
 			uint8_t *packet, size_t len);
 
+/** @brief Start a batch of events.
+ *
+ * Allocates a packet that will collect events added with
+ * @ref nrf_rpc_evt_batch_add. The batch must be sent with
+ * @ref nrf_rpc_evt_batch_send.
+ *
+ * @note Both sides must enable the @kconfig{CONFIG_NRF_RPC_EVT_BATCH} Kconfig
+ *       option to use batches.
+ *
+ * @param group    Group that events belong to.
+ * @param batch    Batch to start.
+ * @param capacity Size of the packet payload that collects the events.
+ *
+ * @return         0 on success or negative error code.
+ */
+int nrf_rpc_evt_batch_begin(const struct nrf_rpc_group *group, struct nrf_rpc_evt_batch *batch,
+			    size_t capacity);
+
+/** @brief Add an event to a batch.
+ *
+ * Event data is copied into the batch. If the event does not fit into the
+ * batch or the batch already holds
+ * @kconfig{CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT} events, the batch is sent
+ * and a new one with the same capacity is started before adding the event.
+ * The batch is also sent after adding the event if its flush deadline has
+ * passed, see @ref nrf_rpc_evt_batch_flush_expired.
+ *
+ * @param batch Batch started with @ref nrf_rpc_evt_batch_begin.
+ * @param evt   Event id.
+ * @param data  Event data.
+ * @param len   Length of the event data.
+ *
+ * @return      0 on success or negative error code. -NRF_EMSGSIZE is
+ *              returned if the event does not fit into an empty batch.
+ */
+int nrf_rpc_evt_batch_add(struct nrf_rpc_evt_batch *batch, uint8_t evt, const uint8_t *data,
+			  size_t len);
+
+/** @brief Send a batch of events.
+ *
+ * The batch packet is released even if sending fails. An empty batch is not
+ * sent.
+ *
+ * @param batch Batch started with @ref nrf_rpc_evt_batch_begin.
+ *
+ * @return      0 on success or negative error code if a transport layer
+ *              reported a sending error.
+ */
+int nrf_rpc_evt_batch_send(struct nrf_rpc_evt_batch *batch);
+
+/** @brief Send a batch of events if its flush deadline has passed.
+ *
+ * nRF RPC has no timers, so the deadline set with the
+ * @kconfig{CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US} Kconfig option is only
+ * checked when an event is added to the batch and when this function is
+ * called. Nothing else sends a batch whose deadline has passed. If no more
+ * events may be added for a while, the thread that fills the batch must call
+ * this function periodically, for example when it becomes idle, or send the
+ * batch with @ref nrf_rpc_evt_batch_send. The function does nothing if the
+ * deadline is 0.
+ *
+ * @param batch Batch started with @ref nrf_rpc_evt_batch_begin.
+ *
+ * @return      0 on success or negative error code if a transport layer
+ *              reported a sending error.
+ */
+int nrf_rpc_evt_batch_flush_expired(struct nrf_rpc_evt_batch *batch);
+
 /** @brief Send a response.
  *
  * @param group  Group that response belongs to.
@@ -648,8 +913,9 @@ void nrf_rpc_err_impl(int code, enum nrf_rpc_err_src src,
 
 /** @brief Allocates buffer for a packet.
  *
- * Memory is automatically deallocated after packet sending. If not, @ref nrf_rpc_free_tx_buf
- * can be used.
+ * Memory is automatically deallocated after packet sending, also when sending fails. If the
+ * packet is not sent, @ref nrf_rpc_free_tx_buf must be used. If the buffer cannot be allocated,
+ * @p buf is set to NULL and nothing needs to be released.
  *
  * @param[in] group nRF RPC group
  * @param[in, out] buf Pointer to allocated packet buffer.
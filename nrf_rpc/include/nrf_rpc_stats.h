@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _NRF_RPC_STATS_H_
+#define _NRF_RPC_STATS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @defgroup nrf_rpc_stats nRF RPC statistics
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Per-group traffic and latency statistics of nRF RPC.
+ *
+ * Statistics are collected when @kconfig{CONFIG_NRF_RPC_STATS} is enabled.
+ * Counters are updated with atomic operations, without locks and logging,
+ * so they can be read at any time. Each field of a snapshot is consistent on
+ * its own, but the snapshot as a whole is not taken atomically.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of buckets in a latency histogram.
+ *
+ * Bucket 0 counts latencies below 1 us, bucket @c n counts latencies from
+ * 2^(n-1) us to 2^n - 1 us. The last bucket also counts all longer latencies.
+ */
+#define NRF_RPC_STATS_LATENCY_BUCKETS 22
+
+/** @brief Number of slots used to match sent events with their ACKs. */
+#define NRF_RPC_STATS_ACK_SLOTS 8
+
+struct nrf_rpc_group;
+
+/** @brief Latency statistics. */
+struct nrf_rpc_stats_latency {
+	/** @brief Number of samples. */
+	uint32_t count;
+
+	/** @brief Sum of all samples in microseconds. Wraps around on overflow. */
+	uint32_t sum_us;
+
+	/** @brief Minimum sample in microseconds or UINT32_MAX if there are no samples. */
+	uint32_t min_us;
+
+	/** @brief Maximum sample in microseconds. */
+	uint32_t max_us;
+
+	/** @brief Histogram of samples in logarithmic buckets. */
+	uint32_t histogram[NRF_RPC_STATS_LATENCY_BUCKETS];
+};
+
+/** @brief Statistics of commands with a specific id sent by the local side. */
+struct nrf_rpc_stats_cmd {
+	/** @brief Number of completed commands. */
+	uint32_t count;
+
+	/** @brief Sum of command round trip times in microseconds. */
+	uint32_t sum_us;
+
+	/** @brief Maximum command round trip time in microseconds. */
+	uint32_t max_us;
+};
+
+/** @brief Statistics of a group. */
+struct nrf_rpc_group_stats {
+	/** @brief Number of commands sent. */
+	uint32_t cmds_sent;
+
+	/** @brief Number of commands received. */
+	uint32_t cmds_received;
+
+	/** @brief Number of events sent, including events sent in batches. */
+	uint32_t evts_sent;
+
+	/** @brief Number of events received, including events received in batches. */
+	uint32_t evts_received;
+
+	/** @brief Number of event acknowledgments received. */
+	uint32_t acks_received;
+
+	/** @brief Number of bytes passed to the transport, including headers. */
+	uint32_t bytes_out;
+
+	/** @brief Number of bytes received from the transport, including headers. */
+	uint32_t bytes_in;
+
+	/** @brief Round trip time of commands sent by the local side. */
+	struct nrf_rpc_stats_latency cmd_latency;
+
+	/** @brief Time between sending an event and receiving its ACK. */
+	struct nrf_rpc_stats_latency ack_latency;
+
+	/* Sent events waiting for ACK: valid flag, 23-bit timestamp and event id.
+	 * Used internally.
+	 */
+	uint32_t _ack_slots[NRF_RPC_STATS_ACK_SLOTS];
+
+#if defined(CONFIG_NRF_RPC_STATS_PER_CMD) || defined(__DOXYGEN__)
+	/** @brief Statistics of commands sent by the local side for each command id. */
+	struct nrf_rpc_stats_cmd cmd[0xFF];
+#endif
+};
+
+/** @brief Statistics of the command context pool. */
+struct nrf_rpc_stats_ctx_pool {
+	/** @brief Number of contexts in use. */
+	uint32_t in_use;
+
+	/** @brief Maximum number of contexts that were in use at the same time. */
+	uint32_t high_water;
+
+	/** @brief Number of contexts that threads took again from their own cache. */
+	uint32_t cache_hits;
+
+	/** @brief Number of contexts taken over from the cache of another thread. */
+	uint32_t reclaimed;
+
+	/** @brief Number of times a thread waited because the pool was exhausted. */
+	uint32_t waits;
+
+	/** @brief Total time spent waiting for a context in microseconds. Wraps around on
+	 *         overflow.
+	 */
+	uint32_t wait_us;
+
+	/** @brief Longest wait for a context in microseconds. */
+	uint32_t max_wait_us;
+};
+
+/** @brief Take a snapshot of the group statistics.
+ *
+ * @param[in]  group Group.
+ * @param[out] stats Snapshot of the group statistics.
+ */
+void nrf_rpc_stats_get(const struct nrf_rpc_group *group, struct nrf_rpc_group_stats *stats);
+
+/** @brief Reset the group statistics.
+ *
+ * Updates done concurrently with the reset may be lost.
+ *
+ * @param group Group.
+ */
+void nrf_rpc_stats_reset(const struct nrf_rpc_group *group);
+
+/** @brief Take a snapshot of the command context pool statistics.
+ *
+ * @param[out] stats Snapshot of the command context pool statistics.
+ */
+void nrf_rpc_stats_ctx_pool_get(struct nrf_rpc_stats_ctx_pool *stats);
+
+/** @brief Reset the command context pool statistics.
+ *
+ * The high-water mark is set to the number of contexts currently in use,
+ * and the other counters are cleared.
+ */
+void nrf_rpc_stats_ctx_pool_reset(void);
+
+/** @brief Estimate a percentile of the latency.
+ *
+ * @param latency    Latency statistics.
+ * @param percentile Percentile from 1 to 100.
+ *
+ * @return           Upper bound in microseconds of the histogram bucket that
+ *                   contains the percentile or 0 if there are no samples.
+ */
+uint32_t nrf_rpc_stats_latency_percentile(const struct nrf_rpc_stats_latency *latency,
+					  uint8_t percentile);
+
+/* Functions used internally by nRF RPC to update the statistics. */
+#ifdef CONFIG_NRF_RPC_STATS
+
+uint32_t _nrf_rpc_stats_timestamp(void);
+void _nrf_rpc_stats_bytes_out(const struct nrf_rpc_group *group, size_t len);
+void _nrf_rpc_stats_bytes_in(const struct nrf_rpc_group *group, size_t len);
+void _nrf_rpc_stats_cmd_sent(const struct nrf_rpc_group *group);
+void _nrf_rpc_stats_cmd_done(const struct nrf_rpc_group *group, uint8_t cmd, uint32_t start);
+void _nrf_rpc_stats_cmd_received(const struct nrf_rpc_group *group);
+void _nrf_rpc_stats_evt_sent(const struct nrf_rpc_group *group, uint8_t evt, uint32_t count);
+void _nrf_rpc_stats_evt_received(const struct nrf_rpc_group *group);
+void _nrf_rpc_stats_ack_received(const struct nrf_rpc_group *group, uint8_t evt);
+void _nrf_rpc_stats_ctx_alloc(void);
+void _nrf_rpc_stats_ctx_free(void);
+void _nrf_rpc_stats_ctx_cache_hit(void);
+void _nrf_rpc_stats_ctx_reclaimed(void);
+void _nrf_rpc_stats_ctx_wait(uint32_t start);
+
+#else
+
+static inline uint32_t _nrf_rpc_stats_timestamp(void) { return 0; }
+static inline void _nrf_rpc_stats_bytes_out(const struct nrf_rpc_group *group, size_t len) {}
+static inline void _nrf_rpc_stats_bytes_in(const struct nrf_rpc_group *group, size_t len) {}
+static inline void _nrf_rpc_stats_cmd_sent(const struct nrf_rpc_group *group) {}
+static inline void _nrf_rpc_stats_cmd_done(const struct nrf_rpc_group *group, uint8_t cmd,
+					   uint32_t start) {}
+static inline void _nrf_rpc_stats_cmd_received(const struct nrf_rpc_group *group) {}
+static inline void _nrf_rpc_stats_evt_sent(const struct nrf_rpc_group *group, uint8_t evt,
+					   uint32_t count) {}
+static inline void _nrf_rpc_stats_evt_received(const struct nrf_rpc_group *group) {}
+static inline void _nrf_rpc_stats_ack_received(const struct nrf_rpc_group *group, uint8_t evt) {}
+static inline void _nrf_rpc_stats_ctx_alloc(void) {}
+static inline void _nrf_rpc_stats_ctx_free(void) {}
+static inline void _nrf_rpc_stats_ctx_cache_hit(void) {}
+static inline void _nrf_rpc_stats_ctx_reclaimed(void) {}
+static inline void _nrf_rpc_stats_ctx_wait(uint32_t start) {}
+
+#endif /* CONFIG_NRF_RPC_STATS */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _NRF_RPC_STATS_H_ */
@@ -40,6 +40,13 @@ struct nrf_rpc_tr_api {
 		    void *context);
 
 	/** @brief Function for sending data over transport interface.
+	 *
+	 * The @p data always points to the beginning of a buffer returned by
+	 * @p tx_buf_alloc and @p length never exceeds the allocated size.
+	 * A transport that lends its own memory from @p tx_buf_alloc, for
+	 * example a slot of a shared memory ring, can therefore send the
+	 * packet in place by committing only the @p length, without copying
+	 * the data.
 	 *
 	 * @param[in] transport nRF RPC transport instance.
 	 * @param[in] data nRF RPC data to send.
@@ -58,6 +65,14 @@ struct nrf_rpc_tr_api {
 	 * (for example with ASSERT).
 	 *
 	 * Memory is deallocated by @p send function or @p tx_buf_free function.
+	 * nRF RPC calls exactly one of them for each buffer returned by this
+	 * function, also when the returned buffer is smaller than requested,
+	 * the group's transport is not initialized or sending is not possible,
+	 * provided that the user of @ref nrf_rpc_alloc_tx_buf either sends the
+	 * buffer or releases it with @ref nrf_rpc_free_tx_buf. The returned
+	 * buffer can therefore be a part of the transport's own memory, such as
+	 * a shared memory region. nRF RPC headers and the payload are encoded
+	 * directly into this buffer.
 	 *
 	 * @param[in] transport nRF RPC transport instance.
 	 * @param[in, out] size Requested buffer size as input. Allocated buffer size as output.
@@ -70,6 +85,7 @@ struct nrf_rpc_tr_api {
 	 *
 	 * This is only called when allocated packet was not sent, because normally
 	 * @p send function deallocates packet when it is no longer needed.
+	 * If @p send is called, it deallocates the packet also when it fails.
 	 *
 	 * @param[in] transport nRF RPC transport instance.
 	 * @param[in] buf Tx buffer to free.
@@ -37,6 +37,9 @@
 /* Maximum possible protocol version. */
 #define NRF_RPC_MAXIMUM_PROTOCOL_VERSION 15
 
+/* Size of the header preceding each event inside a batch: event id and 16-bit length. */
+#define NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE 3
+
 /* Context holding state of the command execution.
  * Context contains data required to receive response to the command and
  * receive recursice commands. When a thread is waiting for a response
@@ -54,6 +57,15 @@ struct nrf_rpc_cmd_ctx {
 	uint8_t use_count;	   /* Context usage counter. It increases
 				    * each time context is reused.
 				    */
+	bool async;		   /* Context is used by an asynchronous command
+				    * that no thread waits for.
+				    */
+	bool prio;		   /* The command that is being executed was
+				    * received over the priority lane, so the
+				    * response is sent over it.
+				    */
+	const struct nrf_rpc_group *group;
+				   /* Group of the asynchronous command. */
 	nrf_rpc_handler_t handler; /* Response handler provided be the user. */
 	void *handler_data;	   /* Pointer for the response handler. */
 	struct nrf_rpc_os_mutex mutex; /* Mutex for protecting all context
@@ -63,8 +75,34 @@ struct nrf_rpc_cmd_ctx {
 				    * receive callback and a thread that waits
 				    * for a response or a recursive commands.
 				    */
+#ifdef CONFIG_NRF_RPC_STATS
+	uint32_t start;		   /* Send time of the asynchronous command. */
+	uint8_t cmd;		   /* Id of the asynchronous command. */
+#endif
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	uint32_t cache_state;	   /* State of the context, see
+				    * enum cmd_ctx_cache_state. Accessed
+				    * atomically.
+				    */
+#endif
 };
 
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+
+/* States of a command context when the thread cache is used. */
+enum cmd_ctx_cache_state {
+	CMD_CTX_FREE,	/* Context is in the OS pool. */
+	CMD_CTX_IN_USE, /* Context is reserved and used. */
+	CMD_CTX_CACHED, /* Context is reserved, but not used. Any thread may take it. */
+};
+
+/* Thread local pointer to a cached context is marked with this bit, so that it is
+ * not taken for the context of the command that the thread executes.
+ */
+#define CMD_CTX_TLS_CACHED ((uintptr_t)1)
+
+#endif /* CONFIG_NRF_RPC_CMD_CTX_CACHE */
+
 /* Structure holding header information to encode or decode it. */
 struct header {
 	uint8_t dst;
@@ -119,6 +157,11 @@ struct internal_task {
 /* Pool of statically allocated command contexts. */
 static struct nrf_rpc_cmd_ctx cmd_ctx_pool[CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE];
 
+/* Number of contexts available in the OS pool minus the number of threads waiting
+ * for one. It is negative when the pool is exhausted. Accessed atomically.
+ */
+static int32_t cmd_ctx_pool_free = CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE;
+
 static struct nrf_rpc_os_event groups_init_event;
 
 /* Number of groups */
@@ -143,6 +186,13 @@ static struct nrf_rpc_os_event internal_task_consumed;
 static struct nrf_rpc_os_mutex cleanup_mutex;
 static struct nrf_rpc_cleanup_handler *cleanup_handlers;
 
+#ifdef CONFIG_NRF_RPC_RX_BUF_POOL
+/* Pool of receive buffers used to release transport buffers without waiting for decoding. */
+static uint8_t rx_buf_pool[CONFIG_NRF_RPC_RX_BUF_POOL_SIZE][CONFIG_NRF_RPC_RX_BUF_SIZE];
+static uint32_t rx_buf_pool_used;
+static struct nrf_rpc_os_mutex rx_buf_pool_mutex;
+#endif
+
 /* Array with all defiend groups */
 NRF_RPC_AUTO_ARR(nrf_rpc_groups_array, "grp");
 
@@ -167,18 +217,33 @@ static void free_rx_buf(const struct nrf_rpc_group *group, const uint8_t *packet
 	}
 }
 
+/* Release a buffer allocated with tx_buf_alloc that will not be passed to send. */
+static void tx_buf_release(const struct nrf_rpc_tr *transport, const uint8_t *buf)
+{
+	if (!transport->api->tx_buf_free) {
+		NRF_RPC_ASSERT(false);
+		return;
+	}
+
+	transport->api->tx_buf_free(transport, (void *)buf);
+}
+
 static int send(const struct nrf_rpc_group *group, const uint8_t *data, size_t length)
 {
 	if (!group->data->transport_initialized) {
 		NRF_RPC_ERR("Transport is not initialized");
+		tx_buf_release(group->transport, data);
 		return -NRF_ENODEV;
 	}
 
 	if (!group->transport->api->send) {
 		NRF_RPC_ASSERT(false);
+		tx_buf_release(group->transport, data);
 		return -NRF_EIO;
 	}
 
+	_nrf_rpc_stats_bytes_out(group, length);
+
 	return group->transport->api->send(group->transport, data, length);
 }
 
@@ -187,22 +252,300 @@ static inline bool auto_free_rx_buf(const struct nrf_rpc_tr *transport)
 	return (transport->api->rx_buf_free == NULL);
 }
 
-static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+
+/* Check if a command or event with the given id is sent over the priority lane. */
+static bool prio_lane_selected(const struct nrf_rpc_group *group, uint8_t type, uint8_t id)
+{
+	const uint32_t *ids = (type == NRF_RPC_PACKET_TYPE_CMD) ? group->data->prio_cmds :
+								 group->data->prio_evts;
+
+	return group->data->prio_transport_initialized && (ids[id / 32] & (1UL << (id % 32)));
+}
+
+/* Check if a packet was received over the priority transport of the group. */
+static bool prio_lane_received(const struct nrf_rpc_group *group,
+			       const struct nrf_rpc_tr *transport)
+{
+	return (transport == group->prio_transport) && (transport != group->transport);
+}
+
+/* Check if a packet is the one received over the priority transport that is being decoded. */
+static bool prio_lane_decoding(const struct nrf_rpc_group *group, const uint8_t *packet)
+{
+	return (packet != NULL) && (packet == group->data->prio_packet);
+}
+
+/* Send a packet encoded in a buffer of the group's transport over the priority transport. */
+static int prio_lane_send(const struct nrf_rpc_group *group, const uint8_t *data, size_t length)
+{
+	const struct nrf_rpc_tr *transport = group->prio_transport;
+	size_t size = length;
+	uint8_t *buf;
+
+	buf = transport->api->tx_buf_alloc(transport, &size);
+
+	if (buf != NULL && size >= length) {
+		memcpy(buf, data, length);
+	}
+
+	group->transport->api->tx_buf_free(group->transport, (void *)data);
+
+	if (buf == NULL) {
+		return -NRF_ENOMEM;
+	}
+
+	if (size < length) {
+		transport->api->tx_buf_free(transport, buf);
+		return -NRF_ENOMEM;
+	}
+
+	_nrf_rpc_stats_bytes_out(group, length);
+
+	return transport->api->send(transport, buf, length);
+}
+
+/* Fill the bitmaps of command and event IDs sent over the priority lane. */
+static void prio_lane_ids_build(const struct nrf_rpc_group *group)
+{
+	void *iter;
+	const struct _nrf_rpc_prio_id *prio_id;
+	uint32_t *ids;
+
+	memset(group->data->prio_cmds, 0, sizeof(group->data->prio_cmds));
+	memset(group->data->prio_evts, 0, sizeof(group->data->prio_evts));
+
+	for (NRF_RPC_AUTO_ARR_FOR(iter, prio_id, group->prio_array,
+				 const struct _nrf_rpc_prio_id)) {
+		ids = (prio_id->type == NRF_RPC_PACKET_TYPE_CMD) ? group->data->prio_cmds :
+								   group->data->prio_evts;
+		ids[prio_id->id / 32] |= 1UL << (prio_id->id % 32);
+	}
+}
+
+#else
+
+static inline bool prio_lane_selected(const struct nrf_rpc_group *group, uint8_t type, uint8_t id)
+{
+	return false;
+}
+
+static inline bool prio_lane_received(const struct nrf_rpc_group *group,
+				      const struct nrf_rpc_tr *transport)
+{
+	return false;
+}
+
+static inline bool prio_lane_decoding(const struct nrf_rpc_group *group, const uint8_t *packet)
+{
+	return false;
+}
+
+#endif /* CONFIG_NRF_RPC_PRIO_LANE */
+
+static int lane_send(const struct nrf_rpc_group *group, bool prio, const uint8_t *data,
+		     size_t length)
+{
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	if (prio) {
+		return prio_lane_send(group, data, length);
+	}
+#endif
+
+	return send(group, data, length);
+}
+
+#ifdef CONFIG_NRF_RPC_RX_BUF_POOL
+
+NRF_RPC_STATIC_ASSERT(CONFIG_NRF_RPC_RX_BUF_POOL_SIZE <= 32,
+		      "Receive buffer pool usage is tracked in a 32-bit mask");
+
+/* Copy packet to a free buffer from the receive buffer pool. Returns NULL if
+ * there is no free buffer or the packet does not fit.
+ */
+static const uint8_t *rx_buf_pool_copy(const uint8_t *packet, size_t len)
+{
+	uint32_t index;
+
+	if (len > CONFIG_NRF_RPC_RX_BUF_SIZE) {
+		return NULL;
+	}
+
+	nrf_rpc_os_mutex_lock(&rx_buf_pool_mutex);
+
+	for (index = 0; index < CONFIG_NRF_RPC_RX_BUF_POOL_SIZE; index++) {
+		if (!(rx_buf_pool_used & (1UL << index))) {
+			rx_buf_pool_used |= (1UL << index);
+			break;
+		}
+	}
+
+	nrf_rpc_os_mutex_unlock(&rx_buf_pool_mutex);
+
+	if (index == CONFIG_NRF_RPC_RX_BUF_POOL_SIZE) {
+		return NULL;
+	}
+
+	memcpy(rx_buf_pool[index], packet, len);
+
+	return rx_buf_pool[index];
+}
+
+/* Release packet if it belongs to the receive buffer pool. */
+static bool rx_buf_pool_release(const uint8_t *packet)
+{
+	uintptr_t offset = (uintptr_t)packet - (uintptr_t)rx_buf_pool;
+	uint32_t index = offset / CONFIG_NRF_RPC_RX_BUF_SIZE;
+
+	if (offset >= sizeof(rx_buf_pool)) {
+		return false;
+	}
+
+	NRF_RPC_ASSERT(offset % CONFIG_NRF_RPC_RX_BUF_SIZE == 0);
+
+	nrf_rpc_os_mutex_lock(&rx_buf_pool_mutex);
+	rx_buf_pool_used &= ~(1UL << index);
+	nrf_rpc_os_mutex_unlock(&rx_buf_pool_mutex);
+
+	return true;
+}
+
+#endif /* CONFIG_NRF_RPC_RX_BUF_POOL */
+
+/* Prepare the received packet to be handed off to another thread. Returns true if
+ * the transport thread must wait until the packet is decoded, because the transport
+ * frees it after the receive callback returns. The packet is copied to the receive
+ * buffer pool if possible, in which case the transport thread can return immediately.
+ */
+static bool rx_buf_hand_off(const struct nrf_rpc_tr *transport, const uint8_t **packet,
+			    size_t len)
+{
+	if (!auto_free_rx_buf(transport)) {
+		return false;
+	}
+
+#ifdef CONFIG_NRF_RPC_RX_BUF_POOL
+	const uint8_t *copy = rx_buf_pool_copy(*packet, len);
+
+	if (copy != NULL) {
+		*packet = copy;
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+
+static bool cmd_ctx_cache_claim(struct nrf_rpc_cmd_ctx *ctx)
+{
+	uint32_t expected = CMD_CTX_CACHED;
+
+	return __atomic_compare_exchange_n(&ctx->cache_state, &expected, CMD_CTX_IN_USE, false,
+					   __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/* Get the context cached by the calling thread, if no other thread took it. */
+static struct nrf_rpc_cmd_ctx *cmd_ctx_cache_get(void)
+{
+	uintptr_t tls = (uintptr_t)nrf_rpc_os_tls_get();
+	struct nrf_rpc_cmd_ctx *ctx = (struct nrf_rpc_cmd_ctx *)(tls & ~CMD_CTX_TLS_CACHED);
+
+	if (!(tls & CMD_CTX_TLS_CACHED) || !cmd_ctx_cache_claim(ctx)) {
+		return NULL;
+	}
+
+	_nrf_rpc_stats_ctx_cache_hit();
+
+	return ctx;
+}
+
+/* Take over a context cached by any thread. */
+static struct nrf_rpc_cmd_ctx *cmd_ctx_cache_reclaim(void)
+{
+	for (size_t i = 0; i < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE; i++) {
+		if (cmd_ctx_cache_claim(&cmd_ctx_pool[i])) {
+			_nrf_rpc_stats_ctx_reclaimed();
+			return &cmd_ctx_pool[i];
+		}
+	}
+
+	return NULL;
+}
+
+#endif /* CONFIG_NRF_RPC_CMD_CTX_CACHE */
+
+static void cmd_ctx_pool_release(struct nrf_rpc_cmd_ctx *ctx)
+{
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	__atomic_store_n(&ctx->cache_state, CMD_CTX_FREE, __ATOMIC_SEQ_CST);
+#endif
+	nrf_rpc_os_ctx_pool_release(ctx->id);
+	__atomic_add_fetch(&cmd_ctx_pool_free, 1, __ATOMIC_SEQ_CST);
+}
+
+static struct nrf_rpc_cmd_ctx *cmd_ctx_pool_reserve(void)
 {
 	struct nrf_rpc_cmd_ctx *ctx;
+	uint32_t start = 0;
 	uint32_t index;
+	bool wait;
+
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	ctx = cmd_ctx_cache_get();
+	if (ctx != NULL) {
+		return ctx;
+	}
+#endif
+
+	wait = (__atomic_sub_fetch(&cmd_ctx_pool_free, 1, __ATOMIC_SEQ_CST) < 0);
+
+	if (wait) {
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+		/* The pool is exhausted, but other threads may keep contexts that
+		 * they do not use. A thread that caches a context after this
+		 * point sees the negative counter and returns it to the pool.
+		 */
+		ctx = cmd_ctx_cache_reclaim();
+		if (ctx != NULL) {
+			__atomic_add_fetch(&cmd_ctx_pool_free, 1, __ATOMIC_SEQ_CST);
+			return ctx;
+		}
+#endif
+		start = _nrf_rpc_stats_timestamp();
+	}
 
 	index = nrf_rpc_os_ctx_pool_reserve();
 
 	NRF_RPC_ASSERT(index < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE);
 
+	if (wait) {
+		_nrf_rpc_stats_ctx_wait(start);
+	}
+
 	ctx = &cmd_ctx_pool[index];
+
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	__atomic_store_n(&ctx->cache_state, CMD_CTX_IN_USE, __ATOMIC_SEQ_CST);
+#endif
+
+	return ctx;
+}
+
+static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
+{
+	struct nrf_rpc_cmd_ctx *ctx;
+
+	ctx = cmd_ctx_pool_reserve();
 	nrf_rpc_os_mutex_lock(&ctx->mutex);
 	ctx->handler = NULL;
 	ctx->remote_id = NRF_RPC_ID_UNKNOWN;
 	ctx->use_count = 1;
+	ctx->prio = false;
 
 	nrf_rpc_os_tls_set(ctx);
+	_nrf_rpc_stats_ctx_alloc();
 
 	NRF_RPC_DBG("Command context %d allocated", ctx->id);
 
@@ -212,13 +555,50 @@ static struct nrf_rpc_cmd_ctx *cmd_ctx_alloc(void)
 static void cmd_ctx_free(struct nrf_rpc_cmd_ctx *ctx)
 {
 	nrf_rpc_os_mutex_unlock(&ctx->mutex);
+	_nrf_rpc_stats_ctx_free();
+
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	/* Keep the context for the next command of this thread, unless another
+	 * thread waits for a context. The state is published before the counter
+	 * is checked, so either this thread sees the waiting thread or the
+	 * waiting thread finds the cached context.
+	 */
+	__atomic_store_n(&ctx->cache_state, CMD_CTX_CACHED, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&cmd_ctx_pool_free, __ATOMIC_SEQ_CST) >= 0) {
+		nrf_rpc_os_tls_set((void *)((uintptr_t)ctx | CMD_CTX_TLS_CACHED));
+		return;
+	}
+
 	nrf_rpc_os_tls_set(NULL);
-	nrf_rpc_os_ctx_pool_release(ctx->id);
+
+	/* The waiting thread may have taken the context already. */
+	if (cmd_ctx_cache_claim(ctx)) {
+		cmd_ctx_pool_release(ctx);
+	}
+#else
+	nrf_rpc_os_tls_set(NULL);
+	cmd_ctx_pool_release(ctx);
+#endif
+}
+
+/* Get the context of the command that the calling thread executes or NULL. */
+static struct nrf_rpc_cmd_ctx *cmd_ctx_tls_get(void)
+{
+	uintptr_t tls = (uintptr_t)nrf_rpc_os_tls_get();
+
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	if (tls & CMD_CTX_TLS_CACHED) {
+		return NULL;
+	}
+#endif
+
+	return (struct nrf_rpc_cmd_ctx *)tls;
 }
 
 static struct nrf_rpc_cmd_ctx *cmd_ctx_reserve(void)
 {
-	struct nrf_rpc_cmd_ctx *ctx = nrf_rpc_os_tls_get();
+	struct nrf_rpc_cmd_ctx *ctx = cmd_ctx_tls_get();
 
 	if (ctx == NULL) {
 		return cmd_ctx_alloc();
@@ -237,6 +617,64 @@ static void cmd_ctx_release(struct nrf_rpc_cmd_ctx *ctx)
 	}
 }
 
+static struct nrf_rpc_cmd_ctx *cmd_ctx_async_alloc(const struct nrf_rpc_group *group,
+						   nrf_rpc_handler_t handler,
+						   void *handler_data)
+{
+	struct nrf_rpc_cmd_ctx *ctx;
+
+	/* The context is not associated with the calling thread, so its mutex
+	 * is held only while the context members are modified.
+	 */
+	ctx = cmd_ctx_pool_reserve();
+	nrf_rpc_os_mutex_lock(&ctx->mutex);
+	ctx->handler = handler;
+	ctx->handler_data = handler_data;
+	ctx->group = group;
+	ctx->remote_id = NRF_RPC_ID_UNKNOWN;
+	ctx->use_count = 1;
+	ctx->async = true;
+	nrf_rpc_os_mutex_unlock(&ctx->mutex);
+
+	_nrf_rpc_stats_ctx_alloc();
+
+	NRF_RPC_DBG("Asynchronous command context %d allocated", ctx->id);
+
+	return ctx;
+}
+
+/* Complete an asynchronous command. The context mutex must be locked by the caller
+ * and it is unlocked by this function.
+ */
+static void cmd_ctx_async_complete(struct nrf_rpc_cmd_ctx *ctx, const uint8_t *packet,
+				   size_t len)
+{
+	nrf_rpc_handler_t handler = ctx->handler;
+	void *handler_data = ctx->handler_data;
+	const struct nrf_rpc_group *group = ctx->group;
+
+	ctx->use_count = 0;
+	ctx->async = false;
+	ctx->handler = NULL;
+	nrf_rpc_os_mutex_unlock(&ctx->mutex);
+
+#ifdef CONFIG_NRF_RPC_STATS
+	if (packet != NULL) {
+		_nrf_rpc_stats_cmd_done(group, ctx->cmd, ctx->start);
+	}
+#endif
+
+	/* Release the context before calling the handler, so that it can send
+	 * another asynchronous command even if the pool was exhausted.
+	 */
+	_nrf_rpc_stats_ctx_free();
+	cmd_ctx_pool_release(ctx);
+
+	if (handler != NULL) {
+		handler(group, packet, len, handler_data);
+	}
+}
+
 static struct nrf_rpc_cmd_ctx *cmd_ctx_get_by_id(uint8_t id)
 {
 	if (id >= CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE) {
@@ -247,7 +685,7 @@ static struct nrf_rpc_cmd_ctx *cmd_ctx_get_by_id(uint8_t id)
 
 static struct nrf_rpc_cmd_ctx *cmd_ctx_get_current()
 {
-	struct nrf_rpc_cmd_ctx *ctx = nrf_rpc_os_tls_get();
+	struct nrf_rpc_cmd_ctx *ctx = cmd_ctx_tls_get();
 
 	NRF_RPC_ASSERT(ctx != NULL);
 
@@ -301,8 +739,9 @@ static inline void header_cmd_encode(uint8_t *packet, struct header *hdr)
 }
 
 /* Function simplifying sending a short packets */
-static int simple_send(const struct nrf_rpc_group *group, uint8_t dst, uint8_t type, uint8_t id,
-		       uint8_t group_id, uint8_t dst_group_id, const uint8_t *packet, size_t len)
+static int simple_send(const struct nrf_rpc_group *group, bool prio, uint8_t dst, uint8_t type,
+		       uint8_t id, uint8_t group_id, uint8_t dst_group_id, const uint8_t *packet,
+		       size_t len)
 {
 	struct header hdr;
 	uint8_t *tx_buf;
@@ -326,7 +765,7 @@ static int simple_send(const struct nrf_rpc_group *group, uint8_t dst, uint8_t t
 		memcpy(&tx_buf[NRF_RPC_HEADER_SIZE], packet, len);
 	}
 
-	return send(group, tx_buf, NRF_RPC_HEADER_SIZE + len);
+	return lane_send(group, prio, tx_buf, NRF_RPC_HEADER_SIZE + len);
 }
 
 static int group_init_send(const struct nrf_rpc_group *group)
@@ -425,46 +864,263 @@ static void internal_tx_handler(void)
 
 /* ======================== Receiving Packets ======================== */
 
-/* Find in array and execute command or event handler */
-static void handler_execute(uint8_t id, const uint8_t *packet, size_t len,
-			    const void *array,
-			    const struct nrf_rpc_group *group)
+#ifdef CONFIG_NRF_RPC_DECODER_INDEX
+
+/* Fill the lookup table mapping command or event ID to decoder position in array. */
+static int decoder_index_build(uint8_t *index, const void *array)
+{
+	void *iter;
+	const struct _nrf_rpc_decoder *decoder;
+	size_t position = 0;
+
+	memset(index, NRF_RPC_ID_UNKNOWN, NRF_RPC_ID_UNKNOWN);
+
+	for (NRF_RPC_AUTO_ARR_FOR(iter, decoder, array,
+				 const struct _nrf_rpc_decoder)) {
+
+		if (position >= NRF_RPC_ID_UNKNOWN) {
+			return -NRF_ENOMEM;
+		}
+
+		/* Keep the first decoder registered for an ID, like the linear search does.
+		 * A decoder with the reserved ID cannot be found, so it is not indexed.
+		 */
+		if (decoder->id != NRF_RPC_ID_UNKNOWN &&
+		    index[decoder->id] == NRF_RPC_ID_UNKNOWN) {
+			index[decoder->id] = position;
+		}
+
+		position++;
+	}
+
+	return 0;
+}
+
+/* Find a decoder using the group's lookup table */
+static const struct _nrf_rpc_decoder *decoder_find(uint8_t id, const void *array,
+						   const uint8_t *index)
+{
+	if (id >= NRF_RPC_ID_UNKNOWN || index[id] == NRF_RPC_ID_UNKNOWN) {
+		return NULL;
+	}
+
+	return &NRF_RPC_AUTO_ARR_GET(array, index[id], const struct _nrf_rpc_decoder);
+}
+
+#else
+
+/* Find a decoder by searching the array */
+static const struct _nrf_rpc_decoder *decoder_find(uint8_t id, const void *array,
+						   const uint8_t *index)
+{
+	void *iter;
+	const struct _nrf_rpc_decoder *decoder;
+
+	(void)index;
+
+	for (NRF_RPC_AUTO_ARR_FOR(iter, decoder, array,
+				 const struct _nrf_rpc_decoder)) {
+
+		if (id == decoder->id) {
+			return decoder;
+		}
+	}
+
+	return NULL;
+}
+
+#endif /* CONFIG_NRF_RPC_DECODER_INDEX */
+
+/* Find and execute command or event handler */
+static void handler_execute(uint8_t id, const uint8_t *packet, size_t len,
+			    const void *array, const uint8_t *index,
+			    const struct nrf_rpc_group *group)
+{
+	const struct _nrf_rpc_decoder *decoder;
+
+	NRF_RPC_ASSERT(packet_validate(packet));
+	NRF_RPC_ASSERT(array != NULL);
+
+	decoder = decoder_find(id, array, index);
+
+	if (decoder != NULL) {
+		decoder->handler(group, packet, len, decoder->handler_data);
+		return;
+	}
+
+	nrf_rpc_decoding_done(group, packet);
+
+	NRF_RPC_ERR("Unknown command or event received");
+
+	nrf_rpc_err(-NRF_ENOENT, NRF_RPC_ERR_SRC_RECV, group, id,
+		    (group->evt_array == array ? NRF_RPC_PACKET_TYPE_EVT :
+		     NRF_RPC_PACKET_TYPE_CMD));
+}
+
+static inline const uint8_t *group_cmd_index(const struct nrf_rpc_group *group)
+{
+#ifdef CONFIG_NRF_RPC_DECODER_INDEX
+	return group->data->cmd_index;
+#else
+	return NULL;
+#endif
+}
+
+static inline const uint8_t *group_evt_index(const struct nrf_rpc_group *group)
+{
+#ifdef CONFIG_NRF_RPC_DECODER_INDEX
+	return group->data->evt_index;
+#else
+	return NULL;
+#endif
+}
+
+/* Search for a group based on group_id */
+static const struct nrf_rpc_group *group_from_id(uint8_t group_id)
+{
+	if (group_id >= group_count) {
+		return NULL;
+	}
+
+	return &NRF_RPC_AUTO_ARR_GET(&nrf_rpc_groups_array, group_id,
+				    const struct nrf_rpc_group);
+}
+
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+
+/* Check if packet points to an event inside the batch currently decoded by the group. */
+static bool evt_batch_contains(const struct nrf_rpc_group *group, const uint8_t *packet)
+{
+	const uint8_t *batch = group->data->batch_packet;
+
+	return (batch != NULL) && (packet > batch) && (packet <= &batch[group->data->batch_len]);
+}
+
+/* Decode the header of the event at the given offset of the batch payload.
+ * Returns offset of the next event or 0 if the batch is malformed.
+ */
+static size_t evt_batch_item_get(const uint8_t *payload, size_t len, size_t offset,
+				 uint8_t *evt, size_t *evt_len)
+{
+	if (len - offset < NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE) {
+		return 0;
+	}
+
+	*evt = payload[offset];
+	*evt_len = payload[offset + 1] | ((size_t)payload[offset + 2] << 8);
+	offset += NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE;
+
+	if (len - offset < *evt_len) {
+		return 0;
+	}
+
+	return offset + *evt_len;
+}
+
+static int evt_batch_validate(const uint8_t *payload, size_t len, uint8_t count)
+{
+	size_t offset = 0;
+	uint8_t evt;
+	size_t evt_len;
+
+	for (uint8_t i = 0; i < count; i++) {
+		offset = evt_batch_item_get(payload, len, offset, &evt, &evt_len);
+		if (offset == 0) {
+			return -NRF_EBADMSG;
+		}
+	}
+
+	return (offset == len) ? 0 : -NRF_EBADMSG;
+}
+
+/* Send a single ACK packet that lists ids of all events from the batch. */
+static int evt_batch_ack_send(const struct nrf_rpc_group *group, const uint8_t *payload,
+			      size_t len, uint8_t count)
+{
+	struct header hdr;
+	uint8_t *tx_buf;
+	size_t offset = 0;
+	size_t evt_len;
+
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.type = NRF_RPC_PACKET_TYPE_ACK;
+	hdr.id = NRF_RPC_ID_UNKNOWN;
+	hdr.src_group_id = group->data->src_group_id;
+	hdr.dst_group_id = group->data->dst_group_id;
+
+	nrf_rpc_alloc_tx_buf(group, &tx_buf, count);
+	if (tx_buf == NULL) {
+		return -NRF_ENOMEM;
+	}
+
+	for (uint8_t i = 0; i < count; i++) {
+		offset = evt_batch_item_get(payload, len, offset, &tx_buf[i], &evt_len);
+	}
+
+	tx_buf -= NRF_RPC_HEADER_SIZE;
+
+	header_encode(tx_buf, &hdr);
+
+	return send(group, tx_buf, NRF_RPC_HEADER_SIZE + count);
+}
+
+/* Execute all events from the batch and release the batch packet. */
+static void evt_batch_execute(const struct nrf_rpc_group *group, const struct header *hdr,
+			      const uint8_t *packet, size_t len)
 {
-	void *iter;
-	const struct _nrf_rpc_decoder *decoder;
+	int err;
+	const uint8_t *payload = &packet[NRF_RPC_HEADER_SIZE];
+	size_t payload_len = len - NRF_RPC_HEADER_SIZE;
+	size_t offset = 0;
+	uint8_t evt;
+	size_t evt_len;
 
-	NRF_RPC_ASSERT(packet_validate(packet));
-	NRF_RPC_ASSERT(array != NULL);
+	err = evt_batch_validate(payload, payload_len, hdr->id);
+	if (err < 0) {
+		NRF_RPC_ERR("Malformed batch of events received");
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_RECV, group, hdr->id, hdr->type);
+		goto release;
+	}
 
-	for (NRF_RPC_AUTO_ARR_FOR(iter, decoder, array,
-				 const struct _nrf_rpc_decoder)) {
+	group->data->batch_packet = packet;
+	group->data->batch_len = len;
 
-		if (id == decoder->id) {
-			decoder->handler(group, packet, len, decoder->handler_data);
-			return;
+	for (uint8_t i = 0; i < hdr->id; i++) {
+		size_t next = evt_batch_item_get(payload, payload_len, offset, &evt, &evt_len);
+
+		if (next == 0) {
+			/* Not reached, the batch has been validated. */
+			break;
 		}
-	}
 
-	nrf_rpc_decoding_done(group, packet);
+		NRF_RPC_DBG("Executing batched event 0x%02X from group 0x%02X", evt,
+			    group->data->src_group_id);
+		_nrf_rpc_stats_evt_received(group);
+		handler_execute(evt, &payload[offset + NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE],
+				evt_len, group->evt_array, group_evt_index(group), group);
+		offset = next;
+	}
 
-	NRF_RPC_ERR("Unknown command or event received");
+	group->data->batch_packet = NULL;
 
-	nrf_rpc_err(-NRF_ENOENT, NRF_RPC_ERR_SRC_RECV, group, id,
-		    (group->evt_array == array ? NRF_RPC_PACKET_TYPE_EVT :
-		     NRF_RPC_PACKET_TYPE_CMD));
-}
+	err = evt_batch_ack_send(group, payload, payload_len, hdr->id);
+	if (err < 0) {
+		NRF_RPC_ERR("ACK send error");
+		nrf_rpc_err(err, NRF_RPC_ERR_SRC_SEND, group, NRF_RPC_ID_UNKNOWN,
+			    NRF_RPC_PACKET_TYPE_ACK);
+	}
 
-/* Search for a group based on group_id */
-static const struct nrf_rpc_group *group_from_id(uint8_t group_id)
-{
-	if (group_id >= group_count) {
-		return NULL;
+release:
+	/* Receive handler waits for the whole batch regardless of the transport type. */
+	if (!auto_free_rx_buf(group->transport)) {
+		free_rx_buf(group, packet);
 	}
 
-	return &NRF_RPC_AUTO_ARR_GET(&nrf_rpc_groups_array, group_id,
-				    const struct nrf_rpc_group);
+	nrf_rpc_os_event_set(&group->data->decode_done_event);
 }
 
+#endif /* CONFIG_NRF_RPC_EVT_BATCH */
+
 /* Parse incoming packet and execute if needed. */
 static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 				     const uint8_t *packet, size_t len)
@@ -473,6 +1129,8 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 	struct header hdr;
 	const struct nrf_rpc_group *group = NULL;
 	struct nrf_rpc_cmd_ctx *allocated_ctx = NULL;
+	bool prio;
+	bool old_prio;
 
 	/* Validate required parameters */
 	NRF_RPC_ASSERT(packet_validate(packet));
@@ -496,6 +1154,9 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 	/* It was already validated in receive handler, so ASSERT is enough. */
 	NRF_RPC_ASSERT(group != NULL);
 
+	/* Check the lane before the decoder releases the packet. */
+	prio = prio_lane_decoding(group, packet);
+
 	if (hdr.type == NRF_RPC_PACKET_TYPE_CMD) {
 
 		if (cmd_ctx == NULL) {
@@ -503,11 +1164,15 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 			cmd_ctx = allocated_ctx;
 		}
 		cmd_ctx->remote_id = hdr.src;
+		old_prio = cmd_ctx->prio;
+		cmd_ctx->prio = prio;
 		NRF_RPC_DBG("Executing command 0x%02X from group 0x%02X",
 			    hdr.id, group->data->src_group_id);
+		_nrf_rpc_stats_cmd_received(group);
 		handler_execute(hdr.id, &packet[NRF_RPC_HEADER_SIZE],
 				len - NRF_RPC_HEADER_SIZE, group->cmd_array,
-				group);
+				group_cmd_index(group), group);
+		cmd_ctx->prio = old_prio;
 		if (allocated_ctx != NULL) {
 			cmd_ctx_free(allocated_ctx);
 		}
@@ -517,10 +1182,11 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 		NRF_RPC_ASSERT(cmd_ctx == NULL);
 		NRF_RPC_DBG("Executing event 0x%02X from group 0x%02X", hdr.id,
 			    group->data->src_group_id);
+		_nrf_rpc_stats_evt_received(group);
 		handler_execute(hdr.id, &packet[NRF_RPC_HEADER_SIZE],
 				len - NRF_RPC_HEADER_SIZE, group->evt_array,
-				group);
-		err = simple_send(group, NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_ACK,
+				group_evt_index(group), group);
+		err = simple_send(group, prio, NRF_RPC_ID_UNKNOWN, NRF_RPC_PACKET_TYPE_ACK,
 				  hdr.id, group->data->src_group_id, group->data->dst_group_id,
 				  NULL, 0);
 		if (err < 0) {
@@ -529,6 +1195,13 @@ static uint8_t parse_incoming_packet(struct nrf_rpc_cmd_ctx *cmd_ctx,
 				    hdr.type);
 		}
 
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	} else if (hdr.type == NRF_RPC_PACKET_TYPE_EVT_BATCH) {
+
+		NRF_RPC_ASSERT(cmd_ctx == NULL);
+		evt_batch_execute(group, &hdr, packet, len);
+
+#endif
 	} else {
 
 		/* It was already validated in receive handler. */
@@ -698,6 +1371,10 @@ static void abort_all_ops(void)
 	for (int i = 0; i < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE; i++) {
 		struct nrf_rpc_cmd_ctx *ctx = &cmd_ctx_pool[i];
 		nrf_rpc_os_mutex_lock(&ctx->mutex);
+		if (ctx->use_count > 0 && ctx->async) {
+			cmd_ctx_async_complete(ctx, NULL, 0);
+			continue;
+		}
 		if (ctx->use_count > 0) {
 			nrf_rpc_os_msg_set(&ctx->recv_msg, NULL, 0);
 		}
@@ -705,12 +1382,80 @@ static void abort_all_ops(void)
 	}
 }
 
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+
+/* Mark a packet received over the priority transport as being decoded. */
+static void prio_lane_decode_begin(const struct nrf_rpc_group *group, const uint8_t *packet)
+{
+	nrf_rpc_os_event_reset(&group->data->prio_decode_done_event);
+	group->data->prio_packet = packet;
+}
+
+/* Wait until a packet received over the priority transport is decoded. */
+static void prio_lane_decode_wait(const struct nrf_rpc_group *group)
+{
+	nrf_rpc_os_event_wait(&group->data->prio_decode_done_event, NRF_RPC_OS_WAIT_FOREVER);
+	group->data->prio_packet = NULL;
+}
+
+#endif /* CONFIG_NRF_RPC_PRIO_LANE */
+
+/* Pass received packet to a thread from the thread pool. */
+static void rx_thread_pool_send(const struct nrf_rpc_group *group,
+				const struct nrf_rpc_tr *transport, const uint8_t *packet,
+				size_t len)
+{
+	bool wait;
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	/* The receive thread of the priority transport always waits until the packet is
+	 * decoded, and releases it afterwards. Each group has at most one such packet
+	 * at a time, so the decoding_done function can recognize it by its address.
+	 */
+	if (prio_lane_received(group, transport)) {
+		prio_lane_decode_begin(group, packet);
+		nrf_rpc_os_prio_thread_pool_send(packet, len);
+		prio_lane_decode_wait(group);
+
+		if (!auto_free_rx_buf(transport)) {
+			transport->api->rx_buf_free(transport, (void *)packet);
+		}
+
+		return;
+	}
+#endif
+
+	wait = rx_buf_hand_off(transport, &packet, len);
+
+	if (wait) {
+		nrf_rpc_os_event_reset(&group->data->decode_done_event);
+	}
+
+	nrf_rpc_os_thread_pool_send(packet, len);
+
+	if (wait) {
+		nrf_rpc_os_event_wait(&group->data->decode_done_event,
+				      NRF_RPC_OS_WAIT_FOREVER);
+	}
+}
+
+static void ack_handle(const struct nrf_rpc_group *group, uint8_t evt)
+{
+	_nrf_rpc_stats_ack_received(group, evt);
+
+	if (group->ack_handler != NULL) {
+		group->ack_handler(evt, group->ack_handler_data);
+	}
+}
+
 /* Callback from transport layer that handles incoming. */
 static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *packet, size_t len,
 			    void *context)
 {
 	int err;
 	int remote_err;
+	bool wait;
+	bool prio = false;
 	struct header hdr;
 	struct nrf_rpc_cmd_ctx *cmd_ctx = NULL;
 	const struct nrf_rpc_group *group = NULL;
@@ -724,6 +1469,7 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 	if (is_stopped &&
 	    (hdr.type == NRF_RPC_PACKET_TYPE_CMD ||
 	     hdr.type == NRF_RPC_PACKET_TYPE_EVT ||
+	     hdr.type == NRF_RPC_PACKET_TYPE_EVT_BATCH ||
 	     hdr.type == NRF_RPC_PACKET_TYPE_ACK ||
 	     hdr.type == NRF_RPC_PACKET_TYPE_RSP)) {
 		// drop only selected types of packets
@@ -735,6 +1481,7 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 
 	if (hdr.type == NRF_RPC_PACKET_TYPE_CMD ||
 	    hdr.type == NRF_RPC_PACKET_TYPE_EVT ||
+	    hdr.type == NRF_RPC_PACKET_TYPE_EVT_BATCH ||
 	    hdr.type == NRF_RPC_PACKET_TYPE_ACK ||
 	    hdr.type == NRF_RPC_PACKET_TYPE_RSP ||
 	    hdr.type == NRF_RPC_PACKET_TYPE_ERR) {
@@ -746,15 +1493,21 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 			goto cleanup_and_exit;
 		}
 
+		prio = prio_lane_received(group, transport);
+
 		/*
 		 * Mark the transport as initialized in case `nrf_rpc_init` is preempted before
 		 * doing this and then a packet is received. Without this line, sending a response
 		 * to this packet would fail.
 		 */
-		group->data->transport_initialized = true;
+		if (!prio) {
+			group->data->transport_initialized = true;
+		}
+
+		_nrf_rpc_stats_bytes_in(group, len);
 	}
 
-	NRF_RPC_DBG("Received %d bytes packet from %d to %d, type 0x%02X, "
+	NRF_RPC_DBG("Received %zu bytes packet from %d to %d, type 0x%02X, "
 		    "cmd/evt/cnt 0x%02X, grp %d (%s)", len, hdr.src, hdr.dst,
 		    hdr.type, hdr.id, hdr.src_group_id,
 		    (group != NULL) ? group->strid : "unknown");
@@ -791,9 +1544,24 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 			goto cleanup_and_exit;
 		}
 
+		if (cmd_ctx->async) {
+			if (hdr.type == NRF_RPC_PACKET_TYPE_RSP) {
+				cmd_ctx_async_complete(cmd_ctx, &packet[NRF_RPC_HEADER_SIZE],
+						       len - NRF_RPC_HEADER_SIZE);
+				goto cleanup_and_exit;
+			}
+
+			/* No thread waits for commands in this conversation, so execute
+			 * the command in the same way as if its destination was unknown.
+			 */
+			nrf_rpc_os_mutex_unlock(&cmd_ctx->mutex);
+			rx_thread_pool_send(group, transport, packet, len);
+			return;
+		}
+
 		if (cmd_ctx->handler != NULL &&
 		    hdr.type == NRF_RPC_PACKET_TYPE_RSP &&
-		    auto_free_rx_buf(transport)) {
+		    (auto_free_rx_buf(transport) || prio)) {
 			cmd_ctx->handler(group, &packet[NRF_RPC_HEADER_SIZE],
 					 len - NRF_RPC_HEADER_SIZE,
 					 cmd_ctx->handler_data);
@@ -802,15 +1570,26 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 			nrf_rpc_os_mutex_unlock(&cmd_ctx->mutex);
 			goto cleanup_and_exit;
 
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+		} else if (prio) {
+			prio_lane_decode_begin(group, packet);
+			nrf_rpc_os_msg_set(&cmd_ctx->recv_msg, packet, len);
+			nrf_rpc_os_mutex_unlock(&cmd_ctx->mutex);
+			prio_lane_decode_wait(group);
+			goto cleanup_and_exit;
+#endif
+
 		} else {
-			if (auto_free_rx_buf(transport)) {
+			wait = rx_buf_hand_off(transport, &packet, len);
+
+			if (wait) {
 				nrf_rpc_os_event_reset(&group->data->decode_done_event);
 			}
 
 			nrf_rpc_os_msg_set(&cmd_ctx->recv_msg, packet, len);
 			nrf_rpc_os_mutex_unlock(&cmd_ctx->mutex);
 
-			if (auto_free_rx_buf(transport)) {
+			if (wait) {
 				nrf_rpc_os_event_wait(&group->data->decode_done_event,
 						      NRF_RPC_OS_WAIT_FOREVER);
 			}
@@ -819,22 +1598,34 @@ static void receive_handler(const struct nrf_rpc_tr *transport, const uint8_t *p
 
 	case NRF_RPC_PACKET_TYPE_EVT:
 		/* or NRF_RPC_PACKET_TYPE_CMD with unknown destination. */
-		if (auto_free_rx_buf(transport)) {
-			nrf_rpc_os_event_reset(&group->data->decode_done_event);
-		}
-
-		nrf_rpc_os_thread_pool_send(packet, len);
+		rx_thread_pool_send(group, transport, packet, len);
+		return;
 
-		if (auto_free_rx_buf(transport)) {
-			nrf_rpc_os_event_wait(&group->data->decode_done_event,
-					      NRF_RPC_OS_WAIT_FOREVER);
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	case NRF_RPC_PACKET_TYPE_EVT_BATCH:
+		if (prio) {
+			NRF_RPC_ERR("Batch of events received over the priority lane");
+			err = -NRF_EBADMSG;
+			break;
 		}
 
+		/* Events point inside the batch packet, so it must be kept until
+		 * all of them are decoded, whatever the transport type is.
+		 */
+		nrf_rpc_os_event_reset(&group->data->decode_done_event);
+		nrf_rpc_os_thread_pool_send(packet, len);
+		nrf_rpc_os_event_wait(&group->data->decode_done_event, NRF_RPC_OS_WAIT_FOREVER);
 		return;
+#endif
 
 	case NRF_RPC_PACKET_TYPE_ACK:
-		if (group->ack_handler != NULL) {
-			group->ack_handler(hdr.id, group->ack_handler_data);
+		if (IS_ENABLED(CONFIG_NRF_RPC_EVT_BATCH) && len > NRF_RPC_HEADER_SIZE) {
+			/* Cumulative ACK of a batch of events. */
+			for (size_t i = NRF_RPC_HEADER_SIZE; i < len; i++) {
+				ack_handle(group, packet[i]);
+			}
+		} else {
+			ack_handle(group, hdr.id);
 		}
 		break;
 
@@ -877,7 +1668,28 @@ void nrf_rpc_decoding_done(const struct nrf_rpc_group *group, const uint8_t *pac
 {
 	const uint8_t *full_packet = &packet[-NRF_RPC_HEADER_SIZE];
 
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	if (packet != NULL && evt_batch_contains(group, packet)) {
+		/* The batch packet is released after all its events are decoded. */
+		return;
+	}
+#endif
+
 	if (packet != NULL) {
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+		if (prio_lane_decoding(group, full_packet)) {
+			/* The receive thread of the priority transport releases the packet. */
+			nrf_rpc_os_event_set(&group->data->prio_decode_done_event);
+			return;
+		}
+#endif
+
+#ifdef CONFIG_NRF_RPC_RX_BUF_POOL
+		if (rx_buf_pool_release(full_packet)) {
+			return;
+		}
+#endif
+
 		if (auto_free_rx_buf(group->transport)) {
 			nrf_rpc_os_event_set(&group->data->decode_done_event);
 		} else {
@@ -957,6 +1769,7 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 	size_t *rsp_len = NULL;
 	struct nrf_rpc_cmd_ctx *cmd_ctx;
 	uint64_t processing_time;
+	uint32_t start;
 
 	NRF_RPC_ASSERT(group != NULL);
 	NRF_RPC_ASSERT((cmd & 0xFF) != NRF_RPC_ID_UNKNOWN);
@@ -978,6 +1791,8 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 	if (is_stopped) {
 		err = -NRF_EPERM;
 		nrf_rpc_os_mutex_unlock(&cleanup_mutex);
+		/* The packet will not be passed to the transport, so release it here. */
+		nrf_rpc_free_tx_buf(group, packet);
 	} else {
 
 		cmd_ctx = cmd_ctx_reserve();
@@ -1001,16 +1816,24 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 			processing_time = nrf_rpc_os_timestamp_get_now();
 		}
 
-		err = send(group, full_packet, len + NRF_RPC_HEADER_SIZE);
+		_nrf_rpc_stats_cmd_sent(group);
+		start = _nrf_rpc_stats_timestamp();
+
+		err = lane_send(group, prio_lane_selected(group, NRF_RPC_PACKET_TYPE_CMD, hdr.id),
+				full_packet, len + NRF_RPC_HEADER_SIZE);
 
 		if (err >= 0) {
 			err = wait_for_response(group, cmd_ctx, rsp_packet, rsp_len);
 		}
 
+		if (err >= 0) {
+			_nrf_rpc_stats_cmd_done(group, hdr.id, start);
+		}
+
 		if(IS_ENABLED(CONFIG_NRF_RPC_COMMAND_TIME_MEASURE)) {
 			processing_time = nrf_rpc_os_timestamp_get_now() - processing_time;
 			NRF_RPC_INF("Command 0x%02X from group 0x%02X execution time %llums", cmd,
-			group->data->src_group_id, processing_time);
+			group->data->src_group_id, (unsigned long long)processing_time);
 		}
 		else {
 			(void)processing_time;
@@ -1025,6 +1848,62 @@ int nrf_rpc_cmd_common(const struct nrf_rpc_group *group, uint32_t cmd,
 	return err;
 }
 
+int nrf_rpc_cmd_async(const struct nrf_rpc_group *group, uint8_t cmd, uint8_t *packet,
+		      size_t len, nrf_rpc_handler_t handler, void *handler_data)
+{
+	int err;
+	struct header hdr;
+	struct nrf_rpc_cmd_ctx *cmd_ctx;
+	uint8_t *full_packet = &packet[-NRF_RPC_HEADER_SIZE];
+
+	NRF_RPC_ASSERT(group != NULL);
+	NRF_RPC_ASSERT(cmd != NRF_RPC_ID_UNKNOWN);
+	NRF_RPC_ASSERT(packet_validate(packet));
+	NRF_RPC_ASSERT(handler != NULL);
+
+	nrf_rpc_os_mutex_lock(&cleanup_mutex);
+	if (is_stopped) {
+		nrf_rpc_os_mutex_unlock(&cleanup_mutex);
+		/* The packet will not be passed to the transport, so release it here. */
+		nrf_rpc_free_tx_buf(group, packet);
+		return -NRF_EPERM;
+	}
+
+	cmd_ctx = cmd_ctx_async_alloc(group, handler, handler_data);
+	nrf_rpc_os_mutex_unlock(&cleanup_mutex);
+
+	/* Each asynchronous command starts a new conversation. */
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.src = cmd_ctx->id;
+	hdr.id = cmd;
+	hdr.src_group_id = group->data->src_group_id;
+	hdr.dst_group_id = group->data->dst_group_id;
+	header_cmd_encode(full_packet, &hdr);
+
+	NRF_RPC_DBG("Sending asynchronous command 0x%02X from group 0x%02X", cmd,
+		    group->data->src_group_id);
+
+#ifdef CONFIG_NRF_RPC_STATS
+	cmd_ctx->cmd = cmd;
+	cmd_ctx->start = _nrf_rpc_stats_timestamp();
+#endif
+	_nrf_rpc_stats_cmd_sent(group);
+
+	err = lane_send(group, prio_lane_selected(group, NRF_RPC_PACKET_TYPE_CMD, cmd), full_packet,
+			len + NRF_RPC_HEADER_SIZE);
+	if (err < 0) {
+		nrf_rpc_os_mutex_lock(&cmd_ctx->mutex);
+		cmd_ctx->use_count = 0;
+		cmd_ctx->async = false;
+		cmd_ctx->handler = NULL;
+		nrf_rpc_os_mutex_unlock(&cmd_ctx->mutex);
+		_nrf_rpc_stats_ctx_free();
+		cmd_ctx_pool_release(cmd_ctx);
+	}
+
+	return err;
+}
+
 void nrf_rpc_cmd_common_no_err(const struct nrf_rpc_group *group, uint32_t cmd,
 			       uint8_t *packet, size_t len, void *ptr1,
 			       void *ptr2)
@@ -1062,7 +1941,10 @@ int nrf_rpc_evt(const struct nrf_rpc_group *group, uint8_t evt, uint8_t *packet,
 	NRF_RPC_DBG("Sending event 0x%02X from group 0x%02X", evt,
 		    group->data->src_group_id);
 
-	err = send(group, full_packet, len + NRF_RPC_HEADER_SIZE);
+	_nrf_rpc_stats_evt_sent(group, evt, 1);
+
+	err = lane_send(group, prio_lane_selected(group, NRF_RPC_PACKET_TYPE_EVT, evt), full_packet,
+			len + NRF_RPC_HEADER_SIZE);
 
 	return err;
 }
@@ -1080,6 +1962,136 @@ void nrf_rpc_evt_no_err(const struct nrf_rpc_group *group, uint8_t evt,
 	}
 }
 
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+
+int nrf_rpc_evt_batch_begin(const struct nrf_rpc_group *group, struct nrf_rpc_evt_batch *batch,
+			    size_t capacity)
+{
+	NRF_RPC_ASSERT(group != NULL);
+	NRF_RPC_ASSERT(batch != NULL);
+
+	batch->group = group;
+	batch->capacity = capacity;
+	batch->len = 0;
+	batch->count = 0;
+
+	nrf_rpc_alloc_tx_buf(group, &batch->packet, capacity);
+	if (batch->packet == NULL) {
+		return -NRF_ENOMEM;
+	}
+
+	return 0;
+}
+
+int nrf_rpc_evt_batch_add(struct nrf_rpc_evt_batch *batch, uint8_t evt, const uint8_t *data,
+			  size_t len)
+{
+	int err;
+	uint8_t *item;
+	size_t item_len = NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE + len;
+
+	NRF_RPC_ASSERT(batch != NULL);
+	NRF_RPC_ASSERT(evt != NRF_RPC_ID_UNKNOWN);
+
+	if (item_len > batch->capacity || len > UINT16_MAX) {
+		return -NRF_EMSGSIZE;
+	}
+
+	if (batch->packet == NULL ||
+	    batch->len + item_len > batch->capacity ||
+	    batch->count >= CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT) {
+		err = nrf_rpc_evt_batch_send(batch);
+		if (err < 0) {
+			return err;
+		}
+
+		err = nrf_rpc_evt_batch_begin(batch->group, batch, batch->capacity);
+		if (err < 0) {
+			return err;
+		}
+	}
+
+	item = &batch->packet[batch->len];
+	item[0] = evt;
+	item[1] = (uint8_t)len;
+	item[2] = (uint8_t)(len >> 8);
+
+	if (len > 0) {
+		memcpy(&item[NRF_RPC_EVT_BATCH_ITEM_HEADER_SIZE], data, len);
+	}
+
+	batch->len += item_len;
+	batch->count++;
+
+#if CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US > 0
+	if (batch->count == 1) {
+		batch->start_us = nrf_rpc_os_timestamp_us_get_now();
+	}
+#endif
+
+	return nrf_rpc_evt_batch_flush_expired(batch);
+}
+
+int nrf_rpc_evt_batch_send(struct nrf_rpc_evt_batch *batch)
+{
+	int err;
+	struct header hdr;
+	const struct nrf_rpc_group *group = batch->group;
+	uint8_t *full_packet;
+
+	if (batch->packet == NULL) {
+		return 0;
+	}
+
+	if (batch->count == 0) {
+		nrf_rpc_free_tx_buf(group, batch->packet);
+		batch->packet = NULL;
+		return 0;
+	}
+
+	full_packet = &batch->packet[-NRF_RPC_HEADER_SIZE];
+
+	hdr.dst = NRF_RPC_ID_UNKNOWN;
+	hdr.type = NRF_RPC_PACKET_TYPE_EVT_BATCH;
+	hdr.id = batch->count;
+	hdr.src_group_id = group->data->src_group_id;
+	hdr.dst_group_id = group->data->dst_group_id;
+	header_encode(full_packet, &hdr);
+
+	NRF_RPC_DBG("Sending batch of %d events from group 0x%02X", batch->count,
+		    group->data->src_group_id);
+
+	_nrf_rpc_stats_evt_sent(group, NRF_RPC_ID_UNKNOWN, batch->count);
+
+	err = send(group, full_packet, batch->len + NRF_RPC_HEADER_SIZE);
+
+	batch->packet = NULL;
+
+	return err;
+}
+
+int nrf_rpc_evt_batch_flush_expired(struct nrf_rpc_evt_batch *batch)
+{
+	NRF_RPC_ASSERT(batch != NULL);
+
+#if CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US > 0
+	if (batch->packet == NULL || batch->count == 0) {
+		return 0;
+	}
+
+	if (nrf_rpc_os_timestamp_us_get_now() - batch->start_us <
+	    CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US) {
+		return 0;
+	}
+
+	return nrf_rpc_evt_batch_send(batch);
+#else
+	return 0;
+#endif
+}
+
+#endif /* CONFIG_NRF_RPC_EVT_BATCH */
+
 /* ======================== Response sending ======================== */
 
 int nrf_rpc_rsp(const struct nrf_rpc_group *group, uint8_t *packet, size_t len)
@@ -1102,7 +2114,7 @@ int nrf_rpc_rsp(const struct nrf_rpc_group *group, uint8_t *packet, size_t len)
 
 	NRF_RPC_DBG("Sending response");
 
-	err = send(group, full_packet, len + NRF_RPC_HEADER_SIZE);
+	err = lane_send(group, cmd_ctx->prio, full_packet, len + NRF_RPC_HEADER_SIZE);
 
 	return err;
 }
@@ -1142,6 +2154,13 @@ int nrf_rpc_setup(nrf_rpc_err_handler_t err_handler, nrf_rpc_group_bound_handler
 
 	nrf_rpc_os_mutex_init(&cleanup_mutex);
 
+#ifdef CONFIG_NRF_RPC_RX_BUF_POOL
+	err = nrf_rpc_os_mutex_init(&rx_buf_pool_mutex);
+	if (err < 0) {
+		return err;
+	}
+#endif
+
 	global_err_handler = err_handler;
 	global_bound_handler = bound_handler;
 
@@ -1163,15 +2182,40 @@ int nrf_rpc_setup(nrf_rpc_err_handler_t err_handler, nrf_rpc_group_bound_handler
 
 		NRF_RPC_ASSERT(transport != NULL);
 
+#ifdef CONFIG_NRF_RPC_DECODER_INDEX
+		err = decoder_index_build(data->cmd_index, group->cmd_array);
+		if (err < 0) {
+			NRF_RPC_ERR("Too many command decoders in group '%s'", group->strid);
+			return err;
+		}
+
+		err = decoder_index_build(data->evt_index, group->evt_array);
+		if (err < 0) {
+			NRF_RPC_ERR("Too many event decoders in group '%s'", group->strid);
+			return err;
+		}
+#endif
+
 		/* Initialize all groups' members before starting transports to avoid the risk of
 		 * receiving a packet for a group that hasn't been initialized yet in case a single
 		 * transport is used across multiple groups. */
-		if (auto_free_rx_buf(transport)) {
+		if (auto_free_rx_buf(transport) || IS_ENABLED(CONFIG_NRF_RPC_EVT_BATCH)) {
 			err = nrf_rpc_os_event_init(&data->decode_done_event);
 			if (err < 0) {
 				return err;
 			}
 		}
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+		if (group->prio_transport != NULL) {
+			prio_lane_ids_build(group);
+
+			err = nrf_rpc_os_event_init(&data->prio_decode_done_event);
+			if (err < 0) {
+				return err;
+			}
+		}
+#endif
 	}
 
 	group_count = group_id;
@@ -1230,6 +2274,20 @@ int nrf_rpc_bind(void)
 			group->data->transport_initialized = true;
 		}
 
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+		/* Commands and events use the group's transport if the priority one fails. */
+		if (group->prio_transport != NULL && group->prio_transport != transport &&
+		    !data->prio_transport_initialized) {
+			err = group->prio_transport->api->init(group->prio_transport,
+							       receive_handler, NULL);
+			if (err) {
+				NRF_RPC_ERR("Failed to initialize priority transport, err: %d", err);
+			} else {
+				data->prio_transport_initialized = true;
+			}
+		}
+#endif
+
 		if (group->flags & NRF_RPC_FLAGS_INITIATOR) {
 			err = group_init_send(group);
 			if (err) {
@@ -1395,7 +2453,7 @@ void nrf_rpc_err_impl(int code, enum nrf_rpc_err_src src,
 	}
 
 	if ((src == NRF_RPC_ERR_SRC_RECV) && group) {
-		simple_send(group, packet_type, NRF_RPC_PACKET_TYPE_ERR, id, src_group_id,
+		simple_send(group, false, packet_type, NRF_RPC_PACKET_TYPE_ERR, id, src_group_id,
 			    dst_group_id, (const uint8_t *)&code, sizeof(code));
 	}
 
@@ -1452,6 +2510,7 @@ void nrf_rpc_alloc_tx_buf(const struct nrf_rpc_group *group, uint8_t **buf, size
 
 	if (req_size < (len + NRF_RPC_HEADER_SIZE)) {
 		NRF_RPC_ASSERT(false);
+		tx_buf_release(group->transport, packet);
 
 		return;
 	}
@@ -1461,19 +2520,12 @@ void nrf_rpc_alloc_tx_buf(const struct nrf_rpc_group *group, uint8_t **buf, size
 
 void nrf_rpc_free_tx_buf(const struct nrf_rpc_group *group, uint8_t *buf)
 {
-	if (!group->transport->api->tx_buf_free) {
-		NRF_RPC_ASSERT(false);
-
-		return;
-	}
-
-	if (!group->data->transport_initialized) {
-		NRF_RPC_ERR("Transport is not initialized");
+	if (buf == NULL) {
 		return;
 	}
 
-	/* We need to subtract packet header placeholder. */
-	buf -= NRF_RPC_HEADER_SIZE;
-
-	group->transport->api->tx_buf_free(group->transport, buf);
+	/* The buffer was allocated by the transport, so it is released even if the group
+	 * lost its transport in the meantime. We need to subtract packet header placeholder.
+	 */
+	tx_buf_release(group->transport, buf - NRF_RPC_HEADER_SIZE);
 }
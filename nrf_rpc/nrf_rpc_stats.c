@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf_rpc.h>
+#include <nrf_rpc_stats.h>
+
+/* All counters are updated with relaxed atomic operations. They are independent
+ * of each other, so no ordering between them is required.
+ */
+#define STATS_ADD(_var, _val) __atomic_fetch_add(&(_var), (_val), __ATOMIC_RELAXED)
+
+/* Content of the ACK slot: valid flag, 23-bit timestamp and event id. */
+#define ACK_SLOT_VALID		 0x80000000UL
+#define ACK_SLOT_TIMESTAMP_MASK	 0x007FFFFFUL
+#define ACK_SLOT_TIMESTAMP_SHIFT 8
+#define ACK_SLOT_ID_MASK	 0xFFUL
+
+static struct nrf_rpc_stats_ctx_pool ctx_pool;
+
+static void atomic_max(uint32_t *var, uint32_t value)
+{
+	uint32_t old = __atomic_load_n(var, __ATOMIC_RELAXED);
+
+	while (value > old &&
+	       !__atomic_compare_exchange_n(var, &old, value, true, __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED)) {
+	}
+}
+
+static void latency_record(struct nrf_rpc_stats_latency *latency, uint32_t us)
+{
+	uint32_t bucket = (us == 0) ? 0 : 32 - __builtin_clz(us);
+
+	if (bucket >= NRF_RPC_STATS_LATENCY_BUCKETS) {
+		bucket = NRF_RPC_STATS_LATENCY_BUCKETS - 1;
+	}
+
+	STATS_ADD(latency->count, 1);
+	STATS_ADD(latency->sum_us, us);
+	STATS_ADD(latency->histogram[bucket], 1);
+	atomic_max(&latency->max_us, us);
+
+	/* Minimum is stored inverted, so that zero-initialized statistics
+	 * report UINT32_MAX when there are no samples.
+	 */
+	atomic_max(&latency->min_us, ~us);
+}
+
+static struct nrf_rpc_group_stats *group_stats(const struct nrf_rpc_group *group)
+{
+	return &group->data->stats;
+}
+
+uint32_t _nrf_rpc_stats_timestamp(void)
+{
+	return nrf_rpc_os_timestamp_us_get_now();
+}
+
+void _nrf_rpc_stats_bytes_out(const struct nrf_rpc_group *group, size_t len)
+{
+	STATS_ADD(group_stats(group)->bytes_out, len);
+}
+
+void _nrf_rpc_stats_bytes_in(const struct nrf_rpc_group *group, size_t len)
+{
+	STATS_ADD(group_stats(group)->bytes_in, len);
+}
+
+void _nrf_rpc_stats_cmd_sent(const struct nrf_rpc_group *group)
+{
+	STATS_ADD(group_stats(group)->cmds_sent, 1);
+}
+
+void _nrf_rpc_stats_cmd_done(const struct nrf_rpc_group *group, uint8_t cmd, uint32_t start)
+{
+	uint32_t us = nrf_rpc_os_timestamp_us_get_now() - start;
+
+	latency_record(&group_stats(group)->cmd_latency, us);
+
+#ifdef CONFIG_NRF_RPC_STATS_PER_CMD
+	if (cmd < NRF_RPC_ID_UNKNOWN) {
+		struct nrf_rpc_stats_cmd *cmd_stats = &group_stats(group)->cmd[cmd];
+
+		STATS_ADD(cmd_stats->count, 1);
+		STATS_ADD(cmd_stats->sum_us, us);
+		atomic_max(&cmd_stats->max_us, us);
+	}
+#else
+	(void)cmd;
+#endif
+}
+
+void _nrf_rpc_stats_cmd_received(const struct nrf_rpc_group *group)
+{
+	STATS_ADD(group_stats(group)->cmds_received, 1);
+}
+
+void _nrf_rpc_stats_evt_sent(const struct nrf_rpc_group *group, uint8_t evt, uint32_t count)
+{
+	struct nrf_rpc_group_stats *stats = group_stats(group);
+	uint32_t timestamp;
+
+	STATS_ADD(stats->evts_sent, count);
+
+	if (evt == NRF_RPC_ID_UNKNOWN) {
+		return;
+	}
+
+	/* A slot may be overwritten by another event before the ACK arrives. Such
+	 * samples are lost, which is acceptable for statistics.
+	 */
+	timestamp = nrf_rpc_os_timestamp_us_get_now() & ACK_SLOT_TIMESTAMP_MASK;
+	__atomic_store_n(&stats->_ack_slots[evt % NRF_RPC_STATS_ACK_SLOTS],
+			 ACK_SLOT_VALID | (timestamp << ACK_SLOT_TIMESTAMP_SHIFT) | evt,
+			 __ATOMIC_RELAXED);
+}
+
+void _nrf_rpc_stats_evt_received(const struct nrf_rpc_group *group)
+{
+	STATS_ADD(group_stats(group)->evts_received, 1);
+}
+
+void _nrf_rpc_stats_ack_received(const struct nrf_rpc_group *group, uint8_t evt)
+{
+	struct nrf_rpc_group_stats *stats = group_stats(group);
+	uint32_t *slot = &stats->_ack_slots[evt % NRF_RPC_STATS_ACK_SLOTS];
+	uint32_t value = __atomic_load_n(slot, __ATOMIC_RELAXED);
+	uint32_t sent;
+
+	STATS_ADD(stats->acks_received, 1);
+
+	if (!(value & ACK_SLOT_VALID) || (value & ACK_SLOT_ID_MASK) != evt) {
+		return;
+	}
+
+	if (!__atomic_compare_exchange_n(slot, &value, 0, false, __ATOMIC_RELAXED,
+					 __ATOMIC_RELAXED)) {
+		return;
+	}
+
+	sent = (value >> ACK_SLOT_TIMESTAMP_SHIFT) & ACK_SLOT_TIMESTAMP_MASK;
+	latency_record(&stats->ack_latency,
+		       (nrf_rpc_os_timestamp_us_get_now() - sent) & ACK_SLOT_TIMESTAMP_MASK);
+}
+
+void _nrf_rpc_stats_ctx_alloc(void)
+{
+	atomic_max(&ctx_pool.high_water,
+		   __atomic_add_fetch(&ctx_pool.in_use, 1, __ATOMIC_RELAXED));
+}
+
+void _nrf_rpc_stats_ctx_free(void)
+{
+	__atomic_fetch_sub(&ctx_pool.in_use, 1, __ATOMIC_RELAXED);
+}
+
+void _nrf_rpc_stats_ctx_cache_hit(void)
+{
+	STATS_ADD(ctx_pool.cache_hits, 1);
+}
+
+void _nrf_rpc_stats_ctx_reclaimed(void)
+{
+	STATS_ADD(ctx_pool.reclaimed, 1);
+}
+
+void _nrf_rpc_stats_ctx_wait(uint32_t start)
+{
+	uint32_t us = nrf_rpc_os_timestamp_us_get_now() - start;
+
+	STATS_ADD(ctx_pool.waits, 1);
+	STATS_ADD(ctx_pool.wait_us, us);
+	atomic_max(&ctx_pool.max_wait_us, us);
+}
+
+void nrf_rpc_stats_get(const struct nrf_rpc_group *group, struct nrf_rpc_group_stats *stats)
+{
+	memcpy(stats, group_stats(group), sizeof(*stats));
+
+	stats->cmd_latency.min_us = ~stats->cmd_latency.min_us;
+	stats->ack_latency.min_us = ~stats->ack_latency.min_us;
+}
+
+void nrf_rpc_stats_reset(const struct nrf_rpc_group *group)
+{
+	memset(group_stats(group), 0, sizeof(struct nrf_rpc_group_stats));
+}
+
+void nrf_rpc_stats_ctx_pool_get(struct nrf_rpc_stats_ctx_pool *stats)
+{
+	memcpy(stats, &ctx_pool, sizeof(*stats));
+}
+
+void nrf_rpc_stats_ctx_pool_reset(void)
+{
+	__atomic_store_n(&ctx_pool.high_water,
+			 __atomic_load_n(&ctx_pool.in_use, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+	__atomic_store_n(&ctx_pool.cache_hits, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&ctx_pool.reclaimed, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&ctx_pool.waits, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&ctx_pool.wait_us, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&ctx_pool.max_wait_us, 0, __ATOMIC_RELAXED);
+}
+
+uint32_t nrf_rpc_stats_latency_percentile(const struct nrf_rpc_stats_latency *latency,
+					  uint8_t percentile)
+{
+	uint32_t total = 0;
+	uint32_t target;
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < NRF_RPC_STATS_LATENCY_BUCKETS; i++) {
+		total += latency->histogram[i];
+	}
+
+	if (total == 0) {
+		return 0;
+	}
+
+	target = (uint32_t)(((uint64_t)total * percentile + 99) / 100);
+
+	for (size_t i = 0; i < NRF_RPC_STATS_LATENCY_BUCKETS; i++) {
+		sum += latency->histogram[i];
+
+		if (sum >= target) {
+			uint32_t upper = (i == 0) ? 0 : (uint32_t)((1ULL << i) - 1);
+
+			return (upper < latency->max_us) ? upper : latency->max_us;
+		}
+	}
+
+	return latency->max_us;
+}
@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* nRF RPC host benchmark.
+ *
+ * The benchmark forks into a client and a server process connected with
+ * the socket pair transport. For each combination of payload size and number
+ * of client threads, the client measures:
+ *  - commands: each thread sends commands that the server echoes back,
+ *  - events: each thread sends events and the client waits for all ACKs,
+ *  - mix: commands as above, while flood threads keep sending events,
+ *  - evtb: events as above, packed into batches, with CONFIG_NRF_RPC_EVT_BATCH.
+ *
+ * Then it measures the dispatch: one thread sends empty commands to groups
+ * with 1, 16, 64 and 254 command decoders (tests d1 to d254). The echo decoder
+ * sorts last in each group, so the server compares it with all the others
+ * unless CONFIG_NRF_RPC_DECODER_INDEX is enabled.
+ *
+ * The mix test shows how commands are delayed by bulk traffic. With
+ * CONFIG_NRF_RPC_PRIO_LANE, the group gets a second socket pair as its
+ * priority transport and the echo command is sent over it.
+ *
+ * Round trip and ACK latency percentiles, and the command context pool usage
+ * and contention come from the nRF RPC statistics.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <stdatomic.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <nrf_rpc.h>
+#include <nrf_rpc_stats.h>
+
+#include "nrf_rpc_socketpair.h"
+
+#define BENCH_CMD_ECHO 0x01
+#define BENCH_EVT_SINK 0x01
+#define BENCH_CMD_DISP 0x01
+
+#define BENCH_MAX_RUNS 16
+
+struct bench_run {
+	size_t size;
+	uint32_t iterations;
+};
+
+static void bench_ack_handler(uint8_t id, void *handler_data);
+static void bench_err_handler(const struct nrf_rpc_err_report *report);
+
+NRF_RPC_SOCKETPAIR_TRANSPORT(bench_tr);
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+NRF_RPC_SOCKETPAIR_TRANSPORT(bench_prio_tr);
+NRF_RPC_GROUP_DEFINE_PRIO(bench_group, "bench", &bench_tr, &bench_prio_tr, bench_ack_handler,
+			  NULL, NULL);
+NRF_RPC_PRIO_CMD(bench_group, bench_echo, BENCH_CMD_ECHO);
+#else
+NRF_RPC_GROUP_DEFINE(bench_group, "bench", &bench_tr, bench_ack_handler, NULL, NULL);
+#endif
+
+static pthread_mutex_t acks_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t acks_cond = PTHREAD_COND_INITIALIZER;
+static uint32_t acks;
+static volatile uint32_t failures;
+
+/* Busy time of the event decoder on the server, in microseconds. */
+static uint32_t sink_delay_us;
+
+static atomic_bool flood_stop;
+static atomic_uint flood_sent;
+
+static double seconds_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ======================== Server ======================== */
+
+static void echo_handler(const struct nrf_rpc_group *group, const uint8_t *packet, size_t len,
+			 void *handler_data)
+{
+	uint8_t *rsp;
+
+	nrf_rpc_alloc_tx_buf(group, &rsp, len);
+	memcpy(rsp, packet, len);
+	nrf_rpc_decoding_done(group, packet);
+
+	if (nrf_rpc_rsp(group, rsp, len) < 0) {
+		failures++;
+	}
+}
+
+NRF_RPC_CMD_DECODER(bench_group, bench_echo, BENCH_CMD_ECHO, echo_handler, NULL);
+
+static void sink_handler(const struct nrf_rpc_group *group, const uint8_t *packet, size_t len,
+			 void *handler_data)
+{
+	double end;
+
+	nrf_rpc_decoding_done(group, packet);
+
+	/* Simulate an event that takes a while to process. */
+	if (sink_delay_us > 0) {
+		end = seconds_now() + sink_delay_us / 1e6;
+		while (seconds_now() < end) {
+		}
+	}
+}
+
+NRF_RPC_EVT_DECODER(bench_group, bench_sink, BENCH_EVT_SINK, sink_handler, NULL);
+
+static void fill_handler(const struct nrf_rpc_group *group, const uint8_t *packet, size_t len,
+			 void *handler_data)
+{
+	/* The dispatch test never sends these commands. */
+	nrf_rpc_decoding_done(group, packet);
+	failures++;
+}
+
+/* Groups of the dispatch test. Each has filler decoders with IDs from
+ * 0x02 up and the echo decoder with a name that sorts after them.
+ */
+#define BENCH_DISP_GROUP(_name)							\
+	NRF_RPC_GROUP_DEFINE(_name, #_name, &bench_tr, NULL, NULL, NULL);		\
+	NRF_RPC_CMD_DECODER(_name, _name##_last, BENCH_CMD_DISP, echo_handler, NULL)
+
+#define BENCH_FILL(_group, _hi, _lo) \
+	NRF_RPC_CMD_DECODER(_group, _group##_fill_##_hi##_lo, 0x##_hi##_lo, fill_handler, NULL);
+
+#define BENCH_FILL_2_TO_7(_group, _hi)							\
+	BENCH_FILL(_group, _hi, 2) BENCH_FILL(_group, _hi, 3) BENCH_FILL(_group, _hi, 4)	\
+	BENCH_FILL(_group, _hi, 5) BENCH_FILL(_group, _hi, 6) BENCH_FILL(_group, _hi, 7)
+
+#define BENCH_FILL_8_TO_E(_group, _hi)							\
+	BENCH_FILL(_group, _hi, 8) BENCH_FILL(_group, _hi, 9) BENCH_FILL(_group, _hi, A)	\
+	BENCH_FILL(_group, _hi, B) BENCH_FILL(_group, _hi, C) BENCH_FILL(_group, _hi, D)	\
+	BENCH_FILL(_group, _hi, E)
+
+/* Fillers 0x_hi0 to 0x_hiE. */
+#define BENCH_FILL_ROW(_group, _hi)							\
+	BENCH_FILL(_group, _hi, 0) BENCH_FILL(_group, _hi, 1)				\
+	BENCH_FILL_2_TO_7(_group, _hi) BENCH_FILL_8_TO_E(_group, _hi)
+
+/* Fillers 0x_hi0 to 0x_hiF. */
+#define BENCH_FILL_FULL_ROW(_group, _hi) \
+	BENCH_FILL_ROW(_group, _hi) BENCH_FILL(_group, _hi, F)
+
+BENCH_DISP_GROUP(bench_d1);
+
+/* 15 fillers */
+BENCH_DISP_GROUP(bench_d16);
+BENCH_FILL_2_TO_7(bench_d16, 0)
+BENCH_FILL_8_TO_E(bench_d16, 0)
+BENCH_FILL(bench_d16, 0, F)
+BENCH_FILL(bench_d16, 1, 0)
+
+/* 63 fillers */
+BENCH_DISP_GROUP(bench_d64);
+BENCH_FILL_2_TO_7(bench_d64, 0)
+BENCH_FILL_8_TO_E(bench_d64, 0)
+BENCH_FILL(bench_d64, 0, F)
+BENCH_FILL_FULL_ROW(bench_d64, 1)
+BENCH_FILL_FULL_ROW(bench_d64, 2)
+BENCH_FILL_FULL_ROW(bench_d64, 3)
+
+/* 253 fillers, all IDs other than 0x00, the echo one and the reserved one */
+BENCH_DISP_GROUP(bench_d254);
+BENCH_FILL_2_TO_7(bench_d254, 0)
+BENCH_FILL_8_TO_E(bench_d254, 0)
+BENCH_FILL(bench_d254, 0, F)
+BENCH_FILL_FULL_ROW(bench_d254, 1)
+BENCH_FILL_FULL_ROW(bench_d254, 2)
+BENCH_FILL_FULL_ROW(bench_d254, 3)
+BENCH_FILL_FULL_ROW(bench_d254, 4)
+BENCH_FILL_FULL_ROW(bench_d254, 5)
+BENCH_FILL_FULL_ROW(bench_d254, 6)
+BENCH_FILL_FULL_ROW(bench_d254, 7)
+BENCH_FILL_FULL_ROW(bench_d254, 8)
+BENCH_FILL_FULL_ROW(bench_d254, 9)
+BENCH_FILL_FULL_ROW(bench_d254, A)
+BENCH_FILL_FULL_ROW(bench_d254, B)
+BENCH_FILL_FULL_ROW(bench_d254, C)
+BENCH_FILL_FULL_ROW(bench_d254, D)
+BENCH_FILL_FULL_ROW(bench_d254, E)
+BENCH_FILL_ROW(bench_d254, F)
+
+static const struct {
+	const char *name;
+	const struct nrf_rpc_group *group;
+} disp_groups[] = {
+	{"d1", &bench_d1},
+	{"d16", &bench_d16},
+	{"d64", &bench_d64},
+	{"d254", &bench_d254},
+};
+
+/* ======================== Client ======================== */
+
+static void bench_ack_handler(uint8_t id, void *handler_data)
+{
+	pthread_mutex_lock(&acks_mutex);
+	acks++;
+	pthread_cond_signal(&acks_cond);
+	pthread_mutex_unlock(&acks_mutex);
+}
+
+static void bench_err_handler(const struct nrf_rpc_err_report *report)
+{
+	fprintf(stderr, "nRF RPC error %d, source %d, packet type %d, id %d\n", report->code,
+		report->src, report->packet_type, report->id);
+	failures++;
+}
+
+static void *cmd_thread(void *arg)
+{
+	const struct bench_run *run = arg;
+	const uint8_t *rsp;
+	size_t rsp_len;
+	uint8_t *packet;
+
+	for (uint32_t i = 0; i < run->iterations; i++) {
+		nrf_rpc_alloc_tx_buf(&bench_group, &packet, run->size);
+		memset(packet, (uint8_t)i, run->size);
+
+		if (nrf_rpc_cmd_rsp(&bench_group, BENCH_CMD_ECHO, packet, run->size, &rsp,
+				    &rsp_len) < 0) {
+			failures++;
+			continue;
+		}
+
+		if (rsp_len != run->size || (rsp_len > 0 && rsp[rsp_len - 1] != (uint8_t)i)) {
+			failures++;
+		}
+
+		nrf_rpc_decoding_done(&bench_group, rsp);
+	}
+
+	return NULL;
+}
+
+static void *evt_thread(void *arg)
+{
+	const struct bench_run *run = arg;
+	uint8_t *packet;
+
+	for (uint32_t i = 0; i < run->iterations; i++) {
+		nrf_rpc_alloc_tx_buf(&bench_group, &packet, run->size);
+		memset(packet, (uint8_t)i, run->size);
+
+		if (nrf_rpc_evt(&bench_group, BENCH_EVT_SINK, packet, run->size) < 0) {
+			failures++;
+		}
+	}
+
+	return NULL;
+}
+
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+static void *evt_batch_thread(void *arg)
+{
+	const struct bench_run *run = arg;
+	struct nrf_rpc_evt_batch batch;
+	uint8_t data[run->size + 1];
+
+	/* Make the batches full when they reach the maximum number of events. */
+	if (nrf_rpc_evt_batch_begin(&bench_group, &batch, CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT *
+				    (run->size + 3)) < 0) {
+		failures++;
+		return NULL;
+	}
+
+	for (uint32_t i = 0; i < run->iterations; i++) {
+		memset(data, (uint8_t)i, run->size);
+
+		if (nrf_rpc_evt_batch_add(&batch, BENCH_EVT_SINK, data, run->size) < 0) {
+			failures++;
+		}
+	}
+
+	if (nrf_rpc_evt_batch_send(&batch) < 0) {
+		failures++;
+	}
+
+	return NULL;
+}
+#endif
+
+static void *flood_thread(void *arg)
+{
+	const struct bench_run *run = arg;
+	uint8_t *packet;
+
+	while (!atomic_load(&flood_stop)) {
+		nrf_rpc_alloc_tx_buf(&bench_group, &packet, run->size);
+		memset(packet, 0, run->size);
+
+		if (nrf_rpc_evt(&bench_group, BENCH_EVT_SINK, packet, run->size) < 0) {
+			failures++;
+		} else {
+			atomic_fetch_add(&flood_sent, 1);
+		}
+	}
+
+	return NULL;
+}
+
+static void acks_reset(void)
+{
+	pthread_mutex_lock(&acks_mutex);
+	acks = 0;
+	pthread_mutex_unlock(&acks_mutex);
+}
+
+static void acks_wait(uint32_t expected)
+{
+	pthread_mutex_lock(&acks_mutex);
+	while (acks < expected) {
+		pthread_cond_wait(&acks_cond, &acks_mutex);
+	}
+	pthread_mutex_unlock(&acks_mutex);
+}
+
+static double run_threads(void *(*fn)(void *), struct bench_run *run, uint32_t threads,
+			  uint32_t expected_acks)
+{
+	pthread_t tid[threads];
+	double start;
+
+	start = seconds_now();
+
+	for (uint32_t i = 0; i < threads; i++) {
+		pthread_create(&tid[i], NULL, fn, run);
+	}
+
+	for (uint32_t i = 0; i < threads; i++) {
+		pthread_join(tid[i], NULL);
+	}
+
+	acks_wait(expected_acks);
+
+	return seconds_now() - start;
+}
+
+static double run_mix(struct bench_run *run, uint32_t threads, uint32_t flood_threads)
+{
+	pthread_t tid[flood_threads];
+	double elapsed;
+
+	atomic_store(&flood_stop, false);
+	atomic_store(&flood_sent, 0);
+	acks_reset();
+
+	for (uint32_t i = 0; i < flood_threads; i++) {
+		pthread_create(&tid[i], NULL, flood_thread, run);
+	}
+
+	elapsed = run_threads(cmd_thread, run, threads, 0);
+
+	atomic_store(&flood_stop, true);
+
+	for (uint32_t i = 0; i < flood_threads; i++) {
+		pthread_join(tid[i], NULL);
+	}
+
+	/* Do not let the ACKs of the flood leak into the next run. */
+	acks_wait(atomic_load(&flood_sent));
+
+	return elapsed;
+}
+
+static void print_result(const char *name, struct bench_run *run, uint32_t threads,
+			 double elapsed, const struct nrf_rpc_stats_latency *latency)
+{
+	struct nrf_rpc_stats_ctx_pool pool;
+	uint32_t ops = run->iterations * threads;
+
+	nrf_rpc_stats_ctx_pool_get(&pool);
+
+	printf("%-4s %7zu %7u %9u %10.0f %8.2f %8u %8u %8u %8u %6u %8u %8u %8u %10u\n",
+	       name, run->size, threads, ops, ops / elapsed,
+	       ops * (double)run->size / elapsed / 1e6,
+	       nrf_rpc_stats_latency_percentile(latency, 50),
+	       nrf_rpc_stats_latency_percentile(latency, 90),
+	       nrf_rpc_stats_latency_percentile(latency, 99),
+	       latency->max_us, pool.high_water, pool.cache_hits, pool.reclaimed, pool.waits,
+	       pool.wait_us);
+}
+
+static void stats_reset(void)
+{
+	nrf_rpc_stats_reset(&bench_group);
+	nrf_rpc_stats_ctx_pool_reset();
+}
+
+static void disp_run(uint32_t iterations)
+{
+	struct bench_run run = { .size = 0, .iterations = iterations };
+	struct nrf_rpc_group_stats stats;
+	const struct nrf_rpc_group *group;
+	const uint8_t *rsp;
+	size_t rsp_len;
+	uint8_t *packet;
+	double start;
+
+	for (size_t i = 0; i < sizeof(disp_groups) / sizeof(disp_groups[0]); i++) {
+		group = disp_groups[i].group;
+
+		nrf_rpc_stats_reset(group);
+		nrf_rpc_stats_ctx_pool_reset();
+		start = seconds_now();
+
+		for (uint32_t j = 0; j < iterations; j++) {
+			nrf_rpc_alloc_tx_buf(group, &packet, 0);
+
+			if (nrf_rpc_cmd_rsp(group, BENCH_CMD_DISP, packet, 0, &rsp, &rsp_len) < 0) {
+				failures++;
+				continue;
+			}
+
+			nrf_rpc_decoding_done(group, rsp);
+		}
+
+		nrf_rpc_stats_get(group, &stats);
+		print_result(disp_groups[i].name, &run, 1, seconds_now() - start,
+			     &stats.cmd_latency);
+	}
+}
+
+static void bench_run(struct bench_run *run, uint32_t threads, uint32_t flood_threads)
+{
+	struct nrf_rpc_group_stats stats;
+	double elapsed;
+
+	stats_reset();
+	elapsed = run_threads(cmd_thread, run, threads, 0);
+	nrf_rpc_stats_get(&bench_group, &stats);
+	print_result("cmd", run, threads, elapsed, &stats.cmd_latency);
+
+	stats_reset();
+	acks_reset();
+	elapsed = run_threads(evt_thread, run, threads, run->iterations * threads);
+	nrf_rpc_stats_get(&bench_group, &stats);
+	print_result("evt", run, threads, elapsed, &stats.ack_latency);
+
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	stats_reset();
+	acks_reset();
+	elapsed = run_threads(evt_batch_thread, run, threads, run->iterations * threads);
+	nrf_rpc_stats_get(&bench_group, &stats);
+	print_result("evtb", run, threads, elapsed, &stats.ack_latency);
+#endif
+
+	if (flood_threads > 0) {
+		stats_reset();
+		elapsed = run_mix(run, threads, flood_threads);
+		nrf_rpc_stats_get(&bench_group, &stats);
+		print_result("mix", run, threads, elapsed, &stats.cmd_latency);
+	}
+}
+
+static int parse_list(const char *arg, uint32_t *list, int max)
+{
+	char *end;
+	int count = 0;
+
+	while (*arg != '\0' && count < max) {
+		list[count++] = strtoul(arg, &end, 0);
+		if (end == arg || (*end != ',' && *end != '\0')) {
+			return -1;
+		}
+		arg = (*end == ',') ? end + 1 : end;
+	}
+
+	return count;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [-n iterations] [-s size[,size...]] [-t threads[,threads...]]\n"
+		"          [-f flood_threads] [-d delay_us]\n"
+		"  -n  Commands and events sent by each thread in each run (default 10000)\n"
+		"  -s  Payload sizes in bytes (default 0,64,1024)\n"
+		"  -t  Numbers of client threads (default 1,4,16)\n"
+		"  -f  Event flood threads of the mix test (default 0, test disabled)\n"
+		"  -d  Time the server spends on each event in microseconds (default 0)\n",
+		name);
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t sizes[BENCH_MAX_RUNS] = {0, 64, 1024};
+	uint32_t threads[BENCH_MAX_RUNS] = {1, 4, 16};
+	int size_count = 3;
+	int thread_count = 3;
+	uint32_t iterations = 10000;
+	uint32_t flood_threads = 0;
+	struct bench_run run;
+	int fds[2];
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	int prio_fds[2];
+#endif
+	pid_t server;
+	int opt;
+	int err;
+
+	while ((opt = getopt(argc, argv, "n:s:t:f:d:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			size_count = parse_list(optarg, sizes, BENCH_MAX_RUNS);
+			break;
+		case 't':
+			thread_count = parse_list(optarg, threads, BENCH_MAX_RUNS);
+			break;
+		case 'f':
+			flood_threads = strtoul(optarg, NULL, 0);
+			break;
+		case 'd':
+			sink_delay_us = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+
+		if (size_count <= 0 || thread_count <= 0) {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds) < 0) {
+		perror("socketpair");
+		return 1;
+	}
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, prio_fds) < 0) {
+		perror("socketpair");
+		return 1;
+	}
+#endif
+
+	server = fork();
+	if (server < 0) {
+		perror("fork");
+		return 1;
+	}
+
+	if (server == 0) {
+		close(fds[0]);
+		nrf_rpc_socketpair_fd_set(&bench_tr, fds[1]);
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+		close(prio_fds[0]);
+		nrf_rpc_socketpair_fd_set(&bench_prio_tr, prio_fds[1]);
+#endif
+
+		err = nrf_rpc_init(bench_err_handler);
+		if (err < 0) {
+			fprintf(stderr, "Server initialization failed: %d\n", err);
+			return 1;
+		}
+
+		/* Serve until the client terminates the process. */
+		while (true) {
+			pause();
+		}
+	}
+
+	close(fds[1]);
+	nrf_rpc_socketpair_fd_set(&bench_tr, fds[0]);
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	close(prio_fds[1]);
+	nrf_rpc_socketpair_fd_set(&bench_prio_tr, prio_fds[0]);
+#endif
+
+	err = nrf_rpc_init(bench_err_handler);
+	if (err < 0) {
+		fprintf(stderr, "Client initialization failed: %d\n", err);
+		kill(server, SIGTERM);
+		return 1;
+	}
+
+	printf("cmd_ctx pool %d, thread pool %d, %u iterations per thread\n",
+	       CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE, CONFIG_NRF_RPC_THREAD_POOL_SIZE, iterations);
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	printf("priority lane: echo command, prio thread pool %d\n",
+	       CONFIG_NRF_RPC_PRIO_THREAD_POOL_SIZE);
+#endif
+#ifdef CONFIG_NRF_RPC_CMD_CTX_CACHE
+	printf("command contexts cached in threads\n");
+#endif
+#ifdef CONFIG_NRF_RPC_EVT_BATCH
+	printf("event batches of up to %d events, flush deadline %d us\n",
+	       CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT, CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US);
+#endif
+	printf("%-4s %7s %7s %9s %10s %8s %8s %8s %8s %8s %6s %8s %8s %8s %10s\n",
+	       "test", "size", "threads", "ops", "ops/s", "MB/s", "p50_us", "p90_us", "p99_us",
+	       "max_us", "ctx_hw", "hits", "reclaim", "waits", "wait_us");
+
+	for (int i = 0; i < size_count; i++) {
+		for (int j = 0; j < thread_count; j++) {
+			run.size = sizes[i];
+			run.iterations = iterations;
+			bench_run(&run, threads[j], flood_threads);
+		}
+	}
+
+	disp_run(iterations);
+
+	kill(server, SIGTERM);
+	waitpid(server, NULL, 0);
+
+	if (failures > 0) {
+		fprintf(stderr, "%u operations failed\n", failures);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_BENCH_CONFIG_H_
+#define NRF_RPC_BENCH_CONFIG_H_
+
+/* Configuration of nRF RPC for the host benchmark. It replaces Kconfig and
+ * uses the Kconfig defaults, with statistics enabled. Each value can be
+ * overridden from the compiler command line.
+ */
+
+#ifndef CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE
+#define CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE 8
+#endif
+
+#ifndef CONFIG_NRF_RPC_THREAD_POOL_SIZE
+#define CONFIG_NRF_RPC_THREAD_POOL_SIZE 3
+#endif
+
+#if defined(CONFIG_NRF_RPC_PRIO_LANE) && !defined(CONFIG_NRF_RPC_PRIO_THREAD_POOL_SIZE)
+#define CONFIG_NRF_RPC_PRIO_THREAD_POOL_SIZE 1
+#endif
+
+#if defined(CONFIG_NRF_RPC_EVT_BATCH) && !defined(CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT)
+#define CONFIG_NRF_RPC_EVT_BATCH_MAX_COUNT 16
+#endif
+
+#if defined(CONFIG_NRF_RPC_EVT_BATCH) && !defined(CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US)
+#define CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US 0
+#endif
+
+#if defined(CONFIG_NRF_RPC_RX_BUF_POOL) && !defined(CONFIG_NRF_RPC_RX_BUF_POOL_SIZE)
+#define CONFIG_NRF_RPC_RX_BUF_POOL_SIZE 4
+#endif
+
+#if defined(CONFIG_NRF_RPC_RX_BUF_POOL) && !defined(CONFIG_NRF_RPC_RX_BUF_SIZE)
+#define CONFIG_NRF_RPC_RX_BUF_SIZE 128
+#endif
+
+#ifndef CONFIG_NRF_RPC_GROUP_INIT_WAIT_TIME
+#define CONFIG_NRF_RPC_GROUP_INIT_WAIT_TIME 1000
+#endif
+
+#ifndef CONFIG_NRF_RPC_GROUP_DEFAULT_INITIATOR
+#define CONFIG_NRF_RPC_GROUP_DEFAULT_INITIATOR 1
+#endif
+
+#ifndef CONFIG_NRF_RPC_GROUP_DEFAULT_WAIT_ON_INIT
+#define CONFIG_NRF_RPC_GROUP_DEFAULT_WAIT_ON_INIT 1
+#endif
+
+#ifndef CONFIG_NRF_RPC_STATS
+#define CONFIG_NRF_RPC_STATS 1
+#endif
+
+#ifndef CONFIG_NRF_RPC_LOG_LEVEL
+#define CONFIG_NRF_RPC_LOG_LEVEL 1
+#endif
+
+#endif /* NRF_RPC_BENCH_CONFIG_H_ */
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_LOG_H_
+#define NRF_RPC_LOG_H_
+
+#include <stdio.h>
+
+/**
+ * @defgroup nrf_rpc_log_posix POSIX logging functionality for nRF RPC
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Logging to the standard error stream.
+ *
+ * Messages with a level lower than or equal to @c CONFIG_NRF_RPC_LOG_LEVEL
+ * are printed: 1 - ERR, 2 - WRN, 3 - INF, 4 - DBG. Memory dumps are not
+ * printed.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_NRF_RPC_LOG_LEVEL
+#define CONFIG_NRF_RPC_LOG_LEVEL 1
+#endif
+
+#define _NRF_RPC_LOG(_level, _prefix, ...)					\
+	do {									\
+		if (CONFIG_NRF_RPC_LOG_LEVEL >= (_level)) {			\
+			fprintf(stderr, "nrf_rpc: " _prefix __VA_ARGS__);	\
+			fputc('\n', stderr);					\
+		}								\
+	} while (0)
+
+#define NRF_RPC_ERR(...) _NRF_RPC_LOG(1, "<err> ", __VA_ARGS__)
+#define NRF_RPC_WRN(...) _NRF_RPC_LOG(2, "<wrn> ", __VA_ARGS__)
+#define NRF_RPC_INF(...) _NRF_RPC_LOG(3, "<inf> ", __VA_ARGS__)
+#define NRF_RPC_DBG(...) _NRF_RPC_LOG(4, "<dbg> ", __VA_ARGS__)
+
+#define NRF_RPC_DUMP_ERR(memory, length, text)
+#define NRF_RPC_DUMP_WRN(memory, length, text)
+#define NRF_RPC_DUMP_INF(memory, length, text)
+#define NRF_RPC_DUMP_DBG(memory, length, text)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_LOG_H_ */
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <nrf_rpc_errno.h>
+#include <nrf_rpc_common.h>
+
+#include "nrf_rpc_os.h"
+
+NRF_RPC_STATIC_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE > 0 &&
+		      CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 32,
+		      "Command context pool must have between 1 and 32 contexts");
+
+#define CTX_POOL_MASK ((uint32_t)(((uint64_t)1 << CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE) - 1))
+
+static nrf_rpc_os_work_t work_callback;
+
+/* Thread pool. A single work item is handed over at a time to one of the idle
+ * threads, so the sender waits until a thread is available.
+ */
+struct thread_pool {
+	pthread_mutex_t mutex;
+	pthread_cond_t work_cond;
+	pthread_cond_t idle_cond;
+	uint32_t idle;
+	bool pending;
+	const uint8_t *data;
+	size_t len;
+};
+
+#define THREAD_POOL_INITIALIZER {				\
+	.mutex = PTHREAD_MUTEX_INITIALIZER,			\
+	.work_cond = PTHREAD_COND_INITIALIZER,			\
+	.idle_cond = PTHREAD_COND_INITIALIZER,			\
+}
+
+static struct thread_pool pool = THREAD_POOL_INITIALIZER;
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+static struct thread_pool prio_pool = THREAD_POOL_INITIALIZER;
+#endif
+
+static struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	uint32_t free_mask;
+	struct nrf_rpc_os_ctx_pool_stats stats;
+} ctx_pool = {
+	.mutex = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+	.free_mask = CTX_POOL_MASK,
+};
+
+static __thread void *tls;
+
+static uint64_t monotonic_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static void deadline_get(struct timespec *deadline, int32_t timeout)
+{
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+
+	deadline->tv_sec += timeout / 1000;
+	deadline->tv_nsec += (long)(timeout % 1000) * 1000000;
+	if (deadline->tv_nsec >= 1000000000) {
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000;
+	}
+}
+
+static int cond_init(pthread_cond_t *cond)
+{
+	pthread_condattr_t attr;
+	int err;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	err = pthread_cond_init(cond, &attr);
+	pthread_condattr_destroy(&attr);
+
+	return err ? -NRF_ENOMEM : 0;
+}
+
+static void *pool_thread(void *arg)
+{
+	struct thread_pool *pool = arg;
+	const uint8_t *data;
+	size_t len;
+
+	pthread_mutex_lock(&pool->mutex);
+
+	while (true) {
+		pool->idle++;
+		pthread_cond_broadcast(&pool->idle_cond);
+
+		while (!pool->pending) {
+			pthread_cond_wait(&pool->work_cond, &pool->mutex);
+		}
+
+		data = pool->data;
+		len = pool->len;
+		pool->pending = false;
+		pthread_cond_broadcast(&pool->idle_cond);
+		pthread_mutex_unlock(&pool->mutex);
+
+		work_callback(data, len);
+
+		pthread_mutex_lock(&pool->mutex);
+	}
+
+	return NULL;
+}
+
+static int pool_start(struct thread_pool *pool, size_t size)
+{
+	pthread_t thread;
+
+	for (size_t i = 0; i < size; i++) {
+		if (pthread_create(&thread, NULL, pool_thread, pool)) {
+			return -NRF_ENOMEM;
+		}
+
+		pthread_detach(thread);
+	}
+
+	return 0;
+}
+
+static void pool_send(struct thread_pool *pool, const uint8_t *data, size_t len)
+{
+	pthread_mutex_lock(&pool->mutex);
+
+	while (pool->idle == 0 || pool->pending) {
+		pthread_cond_wait(&pool->idle_cond, &pool->mutex);
+	}
+
+	pool->idle--;
+	pool->data = data;
+	pool->len = len;
+	pool->pending = true;
+	pthread_cond_signal(&pool->work_cond);
+
+	pthread_mutex_unlock(&pool->mutex);
+}
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
+{
+	int err;
+
+	NRF_RPC_ASSERT(callback != NULL);
+
+	if (work_callback != NULL) {
+		return 0;
+	}
+
+	work_callback = callback;
+
+	err = pool_start(&pool, CONFIG_NRF_RPC_THREAD_POOL_SIZE);
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+	if (err == 0) {
+		err = pool_start(&prio_pool, CONFIG_NRF_RPC_PRIO_THREAD_POOL_SIZE);
+	}
+#endif
+
+	return err;
+}
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
+{
+	pool_send(&pool, data, len);
+}
+
+#ifdef CONFIG_NRF_RPC_PRIO_LANE
+void nrf_rpc_os_prio_thread_pool_send(const uint8_t *data, size_t len)
+{
+	pool_send(&prio_pool, data, len);
+}
+#endif
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
+{
+	if (pthread_mutex_init(&event->mutex, NULL)) {
+		return -NRF_ENOMEM;
+	}
+
+	event->set = false;
+
+	return cond_init(&event->cond);
+}
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	event->set = true;
+	pthread_cond_signal(&event->cond);
+	pthread_mutex_unlock(&event->mutex);
+}
+
+int nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event, int32_t timeout)
+{
+	struct timespec deadline;
+	int err = 0;
+
+	if (timeout != NRF_RPC_OS_WAIT_FOREVER) {
+		deadline_get(&deadline, timeout);
+	}
+
+	pthread_mutex_lock(&event->mutex);
+
+	while (!event->set && err != ETIMEDOUT) {
+		if (timeout == NRF_RPC_OS_WAIT_FOREVER) {
+			pthread_cond_wait(&event->cond, &event->mutex);
+		} else {
+			err = pthread_cond_timedwait(&event->cond, &event->mutex, &deadline);
+		}
+	}
+
+	if (event->set) {
+		event->set = false;
+		err = 0;
+	}
+
+	pthread_mutex_unlock(&event->mutex);
+
+	return err ? -NRF_EAGAIN : 0;
+}
+
+void nrf_rpc_os_event_reset(struct nrf_rpc_os_event *event)
+{
+	pthread_mutex_lock(&event->mutex);
+	event->set = false;
+	pthread_mutex_unlock(&event->mutex);
+}
+
+int nrf_rpc_os_mutex_init(struct nrf_rpc_os_mutex *mutex)
+{
+	pthread_mutexattr_t attr;
+	int err;
+
+	/* The Zephyr mutex, which nRF RPC was designed for, is recursive. */
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	err = pthread_mutex_init(&mutex->mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+
+	return err ? -NRF_ENOMEM : 0;
+}
+
+void nrf_rpc_os_mutex_lock(struct nrf_rpc_os_mutex *mutex)
+{
+	pthread_mutex_lock(&mutex->mutex);
+}
+
+void nrf_rpc_os_mutex_unlock(struct nrf_rpc_os_mutex *mutex)
+{
+	pthread_mutex_unlock(&mutex->mutex);
+}
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg)
+{
+	if (pthread_mutex_init(&msg->mutex, NULL)) {
+		return -NRF_ENOMEM;
+	}
+
+	msg->data = NULL;
+	msg->len = 0;
+	msg->set = false;
+
+	return cond_init(&msg->cond);
+}
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len)
+{
+	pthread_mutex_lock(&msg->mutex);
+	msg->data = data;
+	msg->len = len;
+	msg->set = true;
+	pthread_cond_signal(&msg->cond);
+	pthread_mutex_unlock(&msg->mutex);
+}
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, struct nrf_rpc_os_mutex *mutex,
+			const uint8_t **data, size_t *len)
+{
+	/* The message mutex is taken before the context mutex is released, so
+	 * a message set in between is not missed.
+	 */
+	pthread_mutex_lock(&msg->mutex);
+	pthread_mutex_unlock(&mutex->mutex);
+
+	while (!msg->set) {
+		pthread_cond_wait(&msg->cond, &msg->mutex);
+	}
+
+	*data = msg->data;
+	*len = msg->len;
+	msg->set = false;
+
+	pthread_mutex_unlock(&msg->mutex);
+	pthread_mutex_lock(&mutex->mutex);
+}
+
+void *nrf_rpc_os_tls_get(void)
+{
+	return tls;
+}
+
+void nrf_rpc_os_tls_set(void *data)
+{
+	tls = data;
+}
+
+uint64_t nrf_rpc_os_timestamp_get_now(void)
+{
+	return monotonic_us() / 1000;
+}
+
+uint32_t nrf_rpc_os_timestamp_us_get_now(void)
+{
+	return (uint32_t)monotonic_us();
+}
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void)
+{
+	uint64_t start;
+	uint32_t wait;
+	uint32_t index;
+
+	pthread_mutex_lock(&ctx_pool.mutex);
+
+	if (ctx_pool.free_mask == 0) {
+		start = monotonic_us();
+		ctx_pool.stats.waits++;
+
+		while (ctx_pool.free_mask == 0) {
+			pthread_cond_wait(&ctx_pool.cond, &ctx_pool.mutex);
+		}
+
+		wait = (uint32_t)(monotonic_us() - start);
+		ctx_pool.stats.wait_us += wait;
+		if (wait > ctx_pool.stats.max_wait_us) {
+			ctx_pool.stats.max_wait_us = wait;
+		}
+	}
+
+	index = (uint32_t)__builtin_ctz(ctx_pool.free_mask);
+	ctx_pool.free_mask &= ~((uint32_t)1 << index);
+	ctx_pool.stats.reserved++;
+
+	pthread_mutex_unlock(&ctx_pool.mutex);
+
+	return index;
+}
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index)
+{
+	NRF_RPC_ASSERT(index < CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE);
+
+	pthread_mutex_lock(&ctx_pool.mutex);
+	NRF_RPC_ASSERT((ctx_pool.free_mask & ((uint32_t)1 << index)) == 0);
+	ctx_pool.free_mask |= (uint32_t)1 << index;
+	pthread_cond_signal(&ctx_pool.cond);
+	pthread_mutex_unlock(&ctx_pool.mutex);
+}
+
+void nrf_rpc_os_ctx_pool_stats_get(struct nrf_rpc_os_ctx_pool_stats *stats)
+{
+	pthread_mutex_lock(&ctx_pool.mutex);
+	*stats = ctx_pool.stats;
+	pthread_mutex_unlock(&ctx_pool.mutex);
+}
+
+void nrf_rpc_os_ctx_pool_stats_reset(void)
+{
+	pthread_mutex_lock(&ctx_pool.mutex);
+	memset(&ctx_pool.stats, 0, sizeof(ctx_pool.stats));
+	pthread_mutex_unlock(&ctx_pool.mutex);
+}
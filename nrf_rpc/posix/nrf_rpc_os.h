@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_OS_H_
+#define NRF_RPC_OS_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup nrf_rpc_os_posix POSIX OS-dependent functionality for nRF RPC
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief Implementation of the nRF RPC OS abstraction layer with POSIX threads.
+ *
+ * The port allows running nRF RPC in a regular Linux process, for example to
+ * benchmark it on a host machine. The configuration that is normally provided
+ * by Kconfig must be provided as @c CONFIG_* preprocessor definitions.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __used
+#define __used __attribute__((__used__))
+#endif
+
+#ifndef IS_ENABLED
+/* Same as the Zephyr macro: evaluates to 1 if the option is defined as 1,
+ * and to 0 if it is not defined.
+ */
+#define _NRF_RPC_OS_XXXX1 _NRF_RPC_OS_YYYY,
+#define _NRF_RPC_OS_IS_ENABLED3(_ignore, _val, ...) _val
+#define _NRF_RPC_OS_IS_ENABLED2(_arg) _NRF_RPC_OS_IS_ENABLED3(_arg 1, 0)
+#define _NRF_RPC_OS_IS_ENABLED1(_val) _NRF_RPC_OS_IS_ENABLED2(_NRF_RPC_OS_XXXX##_val)
+#define IS_ENABLED(_option) _NRF_RPC_OS_IS_ENABLED1(_option)
+#endif
+
+#define NRF_RPC_OS_WAIT_FOREVER -1
+#define NRF_RPC_OS_NO_WAIT 0
+
+struct nrf_rpc_os_event {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	bool set;
+};
+
+struct nrf_rpc_os_mutex {
+	pthread_mutex_t mutex;
+};
+
+struct nrf_rpc_os_msg {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	const uint8_t *data;
+	size_t len;
+	bool set;
+};
+
+/** @brief Command context pool contention counters of the POSIX port. */
+struct nrf_rpc_os_ctx_pool_stats {
+	/** @brief Number of contexts reserved. */
+	uint32_t reserved;
+
+	/** @brief Number of reservations that waited because the pool was empty. */
+	uint32_t waits;
+
+	/** @brief Total time spent waiting for a context in microseconds. */
+	uint64_t wait_us;
+
+	/** @brief Longest wait for a context in microseconds. */
+	uint32_t max_wait_us;
+};
+
+typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
+
+int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
+
+void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
+
+void nrf_rpc_os_prio_thread_pool_send(const uint8_t *data, size_t len);
+
+int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event);
+
+void nrf_rpc_os_event_set(struct nrf_rpc_os_event *event);
+
+int nrf_rpc_os_event_wait(struct nrf_rpc_os_event *event, int32_t timeout);
+
+void nrf_rpc_os_event_reset(struct nrf_rpc_os_event *event);
+
+int nrf_rpc_os_mutex_init(struct nrf_rpc_os_mutex *mutex);
+
+void nrf_rpc_os_mutex_lock(struct nrf_rpc_os_mutex *mutex);
+
+void nrf_rpc_os_mutex_unlock(struct nrf_rpc_os_mutex *mutex);
+
+int nrf_rpc_os_msg_init(struct nrf_rpc_os_msg *msg);
+
+void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
+			size_t len);
+
+void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, struct nrf_rpc_os_mutex *mutex,
+			const uint8_t **data, size_t *len);
+
+void *nrf_rpc_os_tls_get(void);
+
+void nrf_rpc_os_tls_set(void *data);
+
+uint64_t nrf_rpc_os_timestamp_get_now(void);
+
+uint32_t nrf_rpc_os_timestamp_us_get_now(void);
+
+uint32_t nrf_rpc_os_ctx_pool_reserve(void);
+
+void nrf_rpc_os_ctx_pool_release(uint32_t index);
+
+/** @brief Get the command context pool contention counters.
+ *
+ * This function is specific to the POSIX port.
+ *
+ * @param[out] stats Counters.
+ */
+void nrf_rpc_os_ctx_pool_stats_get(struct nrf_rpc_os_ctx_pool_stats *stats);
+
+/** @brief Reset the command context pool contention counters.
+ *
+ * This function is specific to the POSIX port.
+ */
+void nrf_rpc_os_ctx_pool_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_OS_H_ */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <nrf_rpc_log.h>
+#include <nrf_rpc_errno.h>
+
+#include "nrf_rpc_socketpair.h"
+
+static void *rx_thread(void *arg)
+{
+	struct nrf_rpc_socketpair *instance = arg;
+	ssize_t size;
+	ssize_t received;
+	uint8_t *buf;
+
+	while (true) {
+		/* Get the length of the next message without consuming it. */
+		size = recv(instance->fd, NULL, 0, MSG_PEEK | MSG_TRUNC);
+		if (size < 0 && errno == EINTR) {
+			continue;
+		}
+
+		if (size <= 0) {
+			break;
+		}
+
+		buf = malloc(size);
+		if (buf == NULL) {
+			NRF_RPC_ERR("Cannot allocate %zd bytes for a received packet", size);
+			break;
+		}
+
+		received = recv(instance->fd, buf, size, 0);
+		if (received != size) {
+			free(buf);
+			break;
+		}
+
+		instance->receive_cb(instance->transport, buf, size, instance->receive_ctx);
+	}
+
+	NRF_RPC_DBG("Socket pair transport closed");
+
+	return NULL;
+}
+
+static int tr_init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
+		void *context)
+{
+	struct nrf_rpc_socketpair *instance = transport->ctx;
+
+	/* The transport can be shared by several groups. */
+	if (instance->initialized) {
+		return 0;
+	}
+
+	if (instance->fd < 0) {
+		NRF_RPC_ERR("Socket pair transport has no socket");
+		return -NRF_EINVAL;
+	}
+
+	instance->receive_cb = receive_cb;
+	instance->receive_ctx = context;
+	instance->transport = transport;
+
+	if (pthread_create(&instance->rx_thread, NULL, rx_thread, instance)) {
+		return -NRF_ENOMEM;
+	}
+
+	instance->initialized = true;
+
+	return 0;
+}
+
+static int tr_send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	struct nrf_rpc_socketpair *instance = transport->ctx;
+	ssize_t sent;
+
+	do {
+		sent = send(instance->fd, data, length, MSG_NOSIGNAL);
+	} while (sent < 0 && errno == EINTR);
+
+	free((void *)data);
+
+	return (sent == (ssize_t)length) ? 0 : -NRF_EIO;
+}
+
+static void *tr_tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
+{
+	void *buf = malloc(*size);
+
+	NRF_RPC_ASSERT(buf != NULL);
+
+	return buf;
+}
+
+static void tr_tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
+{
+	free(buf);
+}
+
+static void tr_rx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
+{
+	free(buf);
+}
+
+const struct nrf_rpc_tr_api nrf_rpc_socketpair_api = {
+	.init = tr_init,
+	.send = tr_send,
+	.tx_buf_alloc = tr_tx_buf_alloc,
+	.tx_buf_free = tr_tx_buf_free,
+	.rx_buf_free = tr_rx_buf_free,
+};
+
+void nrf_rpc_socketpair_fd_set(const struct nrf_rpc_tr *transport, int fd)
+{
+	struct nrf_rpc_socketpair *instance = transport->ctx;
+
+	instance->fd = fd;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_SOCKETPAIR_H_
+#define NRF_RPC_SOCKETPAIR_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#include <nrf_rpc_tr.h>
+
+/**
+ * @defgroup nrf_rpc_socketpair nRF RPC socket pair transport
+ * @{
+ * @ingroup nrf_rpc
+ *
+ * @brief nRF RPC transport over a POSIX sequenced-packet socket.
+ *
+ * The transport is meant for running both sides of nRF RPC on a host
+ * machine, for example in two processes connected with a socket pair created
+ * by @c socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds) before @c fork(). Each
+ * nRF RPC packet is sent as a single socket message, so no additional framing
+ * is needed.
+ *
+ * Received packets are stored in buffers allocated from the heap. They are
+ * released with the @c rx_buf_free function when nRF RPC no longer needs them,
+ * so the receive thread does not wait until a packet is decoded.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Socket pair transport instance. */
+struct nrf_rpc_socketpair {
+	/** Socket descriptor. */
+	int fd;
+
+	/** True if the receive thread was started. */
+	bool initialized;
+
+	/** Receive thread. */
+	pthread_t rx_thread;
+
+	/** nRF RPC receive callback. */
+	nrf_rpc_tr_receive_handler_t receive_cb;
+
+	/** Context of the receive callback. */
+	void *receive_ctx;
+
+	/** Transport structure that uses this instance. */
+	const struct nrf_rpc_tr *transport;
+};
+
+extern const struct nrf_rpc_tr_api nrf_rpc_socketpair_api;
+
+/** @brief Define a socket pair transport.
+ *
+ * The socket descriptor must be assigned with @ref nrf_rpc_socketpair_fd_set
+ * before nRF RPC is initialized.
+ *
+ * @param _name Name of the nRF RPC transport.
+ */
+#define NRF_RPC_SOCKETPAIR_TRANSPORT(_name)					\
+	static struct nrf_rpc_socketpair _name##_instance = {			\
+		.fd = -1,							\
+	};									\
+										\
+	static const struct nrf_rpc_tr _name = {				\
+		.api = &nrf_rpc_socketpair_api,					\
+		.ctx = &_name##_instance,					\
+	}
+
+/** @brief Assign a socket to the transport.
+ *
+ * @param transport Transport defined with @ref NRF_RPC_SOCKETPAIR_TRANSPORT.
+ * @param fd        Connected @c SOCK_SEQPACKET socket descriptor.
+ */
+void nrf_rpc_socketpair_fd_set(const struct nrf_rpc_tr *transport, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* NRF_RPC_SOCKETPAIR_H_ */
@@ -66,6 +66,20 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
  */
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+/** @brief Send work to the priority thread pool.
+ *
+ * The function is used only when @kconfig{CONFIG_NRF_RPC_PRIO_LANE} is enabled.
+ * It works in the same way as @ref nrf_rpc_os_thread_pool_send, but it uses
+ * a separate pool of @kconfig{CONFIG_NRF_RPC_PRIO_THREAD_POOL_SIZE} threads,
+ * so that the work is not delayed by the work sent to the main thread pool.
+ * The threads call the callback provided in @ref nrf_rpc_os_init.
+ *
+ * @param data Data pointer to pass. Data is passed as a pointer, no copying is
+ *             done.
+ * @param len  Length of the `data`.
+ */
+void nrf_rpc_os_prio_thread_pool_send(const uint8_t *data, size_t len);
+
 /** @brief Initialize event passing structure.
  *
  * @param event Event structure to initialize.
@@ -181,6 +195,16 @@ void nrf_rpc_os_tls_set(void *data);
  */
 uint64_t nrf_rpc_os_timestamp_get_now(void);
 
+/** @brief Get the current timestamp value with microsecond resolution.
+ *
+ * The function is used only when @kconfig{CONFIG_NRF_RPC_STATS} is enabled or
+ * @kconfig{CONFIG_NRF_RPC_EVT_BATCH_FLUSH_TIMEOUT_US} is not 0.
+ * The value may wrap around.
+ *
+ * @return Current timestamp in microseconds.
+ */
+uint32_t nrf_rpc_os_timestamp_us_get_now(void);
+
 /** @brief Reserve one context from command context pool.
  *
  * If there is no available context then this function waits for it.